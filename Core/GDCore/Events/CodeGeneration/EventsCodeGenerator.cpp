@@ -1,7 +1,9 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
 #include "GDCore/Events/CodeGeneration/ExpressionsCodeGeneration.h"
@@ -14,14 +16,67 @@
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/VersionWrapper.h"
 
 using namespace std;
 
 namespace gd {
 
+namespace {
+/**
+ * Serialize the external events and the events of layouts linked by the
+ * events, and by the events they link to.
+ */
+void SerializeLinkedEventsTo(const gd::Project& project,
+                             const gd::EventsList& events,
+                             std::set<gd::String>& linkedNames,
+                             gd::SerializerElement& element) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent& event = events.GetEvent(i);
+    if (event.CanHaveSubEvents())
+      SerializeLinkedEventsTo(
+          project, event.GetSubEvents(), linkedNames, element);
+
+    const gd::LinkEvent* linkEvent = dynamic_cast<const gd::LinkEvent*>(&event);
+    if (!linkEvent || !linkedNames.insert(linkEvent->GetTarget()).second)
+      continue;
+
+    const gd::String& target = linkEvent->GetTarget();
+    const gd::EventsList* linkedEvents = NULL;
+    if (project.HasExternalEventsNamed(target))
+      linkedEvents = &project.GetExternalEvents(target).GetEvents();
+    else if (project.HasLayoutNamed(target))
+      linkedEvents = &project.GetLayout(target).GetEvents();
+    if (!linkedEvents) continue;
+
+    gd::SerializerElement& linkedElement = element.AddChild("events");
+    linkedElement.SetAttribute("target", target);
+    linkedEvents->SerializeTo(linkedElement.AddChild("events"));
+    SerializeLinkedEventsTo(project, *linkedEvents, linkedNames, element);
+  }
+}
+
+/**
+ * 64 bits FNV-1a hash: unlike std::hash, it is the same on every platform and
+ * with every compiler, so that it can be stored.
+ */
+std::uint64_t HashString(const std::string& str) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+}  // namespace
+
 /**
  * Generate call using a relational operator.
  * Relational operator position is deduced from parameters type.
@@ -864,6 +919,58 @@ void EventsCodeGenerator::DeleteUselessEvents(gd::EventsList& events) {
   }
 }
 
+gd::String EventsCodeGenerator::GenerateSceneEventsCompleteCodeHash(
+    const gd::Project& project,
+    const gd::Layout& scene,
+    const gd::EventsList& events,
+    const gd::String& projectData,
+    bool compilationForRuntime) {
+  // Instances and other properties of the scene are not used by events, and
+  // are left out so that editing them does not change the hash.
+  gd::SerializerElement element;
+  element.SetAttribute("compilationForRuntime", compilationForRuntime);
+  element.SetAttribute("scene", scene.GetName());
+  element.SetAttribute("project", projectData);
+  events.SerializeTo(element.AddChild("events"));
+
+  std::set<gd::String> linkedNames;
+  gd::SerializerElement& linkedEventsElement = element.AddChild("linkedEvents");
+  linkedEventsElement.ConsiderAsArrayOf("events");
+  SerializeLinkedEventsTo(project, events, linkedNames, linkedEventsElement);
+
+  scene.SerializeObjectsTo(element.AddChild("objects"));
+  scene.GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
+  scene.GetVariables().SerializeTo(element.AddChild("variables"));
+
+  return gd::String::From(HashString(gd::Serializer::ToJSON(element).Raw()));
+}
+
+gd::String EventsCodeGenerator::SerializeProjectForEventsCodeHash(
+    const gd::Project& project) {
+  gd::SerializerElement element;
+  element.SetAttribute("gdVersion", gd::VersionWrapper::FullString());
+  project.SerializeObjectsTo(element.AddChild("globalObjects"));
+  project.GetObjectGroups().SerializeTo(
+      element.AddChild("globalObjectsGroups"));
+  project.GetVariables().SerializeTo(element.AddChild("globalVariables"));
+
+  // Extensions are part of GDevelop, except the ones made with events, whose
+  // instructions can change with the project.
+  gd::SerializerElement& extensionsElement = element.AddChild("extensions");
+  extensionsElement.ConsiderAsArrayOf("extension");
+  for (auto& extensionName : project.GetUsedExtensions())
+    extensionsElement.AddChild("extension").SetValue(extensionName);
+  gd::SerializerElement& eventsFunctionsExtensionsElement =
+      element.AddChild("eventsFunctionsExtensions");
+  eventsFunctionsExtensionsElement.ConsiderAsArrayOf(
+      "eventsFunctionsExtension");
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount(); ++i)
+    project.GetEventsFunctionsExtension(i).SerializeTo(
+        eventsFunctionsExtensionsElement.AddChild("eventsFunctionsExtension"));
+
+  return gd::Serializer::ToJSON(element);
+}
+
 /**
  * Call preprocessing method of each event
  */
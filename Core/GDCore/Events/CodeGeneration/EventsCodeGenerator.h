@@ -11,6 +11,7 @@
 #include <vector>
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionNodesArena.h"
 #include "GDCore/String.h"
 namespace gd {
 class EventsList;
@@ -47,6 +48,36 @@ class GD_CORE_API EventsCodeGenerator {
    */
   static void DeleteUselessEvents(gd::EventsList& events);
 
+  /**
+   * \brief Compute a hash of everything used to generate the code of the
+   * events of a scene: the events and the events they link to, the objects,
+   * groups and variables of the scene, and the project data.
+   *
+   * As long as the hash does not change, the platform generates the same code
+   * for the scene, so the hash can be used to cache the code.
+   *
+   * \param projectData The parts of the project used by the events of all the
+   * scenes, returned by SerializeProjectForEventsCodeHash.
+   */
+  static gd::String GenerateSceneEventsCompleteCodeHash(
+      const gd::Project& project,
+      const gd::Layout& scene,
+      const gd::EventsList& events,
+      const gd::String& projectData,
+      bool compilationForRuntime = false);
+
+  /**
+   * \brief Serialize the parts of the project used by the events of all the
+   * scenes (global objects, groups and variables, extensions and version of
+   * GDevelop), to be passed to GenerateSceneEventsCompleteCodeHash.
+   *
+   * \note Serializing variables modifies them (see gd::Variable::GetString),
+   * so this must not be called by several threads at once: call it once and
+   * share the result to hash the scenes in parallel.
+   */
+  static gd::String SerializeProjectForEventsCodeHash(
+      const gd::Project& project);
+
   /**
    * \brief Construct a code generator for the specified
    * platform/project/layout.
@@ -329,6 +360,14 @@ class GD_CORE_API EventsCodeGenerator {
    */
   const gd::Platform& GetPlatform() const { return platform; }
 
+  /**
+   * \brief Get the arena in which the nodes of the expressions parsed to
+   * generate the code are allocated.
+   */
+  gd::ExpressionNodesArena& GetExpressionNodesArena() {
+    return expressionNodesArena;
+  }
+
   /**
    * \brief Convert a group name to the full list of objects contained in the
    * group.
@@ -742,6 +781,9 @@ class GD_CORE_API EventsCodeGenerator {
   size_t maxCustomConditionsDepth;  ///< The maximum depth value for all the
                                     ///< custom conditions created.
   size_t maxConditionsListsSize;  ///< The maximum size of a list of conditions.
+  gd::ExpressionNodesArena
+      expressionNodesArena;  ///< The memory reused for the nodes of all the
+                             ///< expressions parsed during code generation.
 };
 
 }  // namespace gd
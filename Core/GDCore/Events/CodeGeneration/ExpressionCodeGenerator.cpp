@@ -138,6 +138,9 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
   gd::ExpressionParser2 parser(codeGenerator.GetPlatform(),
                                codeGenerator.GetGlobalObjectsAndGroups(),
                                codeGenerator.GetObjectsAndGroups());
+  // The tree is destroyed once the code is generated: its memory is reused for
+  // the next expressions.
+  parser.SetNodesArena(&codeGenerator.GetExpressionNodesArena());
   auto node = parser.ParseExpression(type, expression, objectName);
   gd::ExpressionValidator validator;
   node->Visit(validator);
@@ -403,6 +406,7 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
         ExpressionParser2 parser(codeGenerator.GetPlatform(),
                                  codeGenerator.GetGlobalObjectsAndGroups(),
                                  codeGenerator.GetObjectsAndGroups());
+        parser.SetNodesArena(&codeGenerator.GetExpressionNodesArena());
         auto node = parser.ParseExpression(parameterMetadata.GetType(),
                                            parameterMetadata.GetDefaultValue());
 
@@ -0,0 +1,97 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionNodesArena.h"
+#include <algorithm>
+#include <new>
+
+namespace {
+/**
+ * Stored before each allocation, so that the memory can be released in the
+ * arena it was allocated in. Its size keeps the allocations aligned as the heap
+ * does.
+ */
+union AllocationHeader {
+  gd::ExpressionNodesArena *arena;
+  std::max_align_t alignment;
+};
+
+thread_local gd::ExpressionNodesArena *currentArena = nullptr;
+}  // namespace
+
+namespace gd {
+
+ExpressionNodesArena::ExpressionNodesArena(std::size_t blockSize_)
+    : blockSize(blockSize_),
+      currentBlock(0),
+      currentOffset(0),
+      allocationsCount(0) {}
+
+std::size_t ExpressionNodesArena::GetReservedSize() const {
+  std::size_t reservedSize = 0;
+  for (auto &block : blocks) reservedSize += block.size;
+
+  return reservedSize;
+}
+
+void *ExpressionNodesArena::Allocate(std::size_t size) {
+  std::size_t allocationSize = sizeof(AllocationHeader) + size;
+  AllocationHeader *header = static_cast<AllocationHeader *>(
+      currentArena ? currentArena->AllocateInBlocks(allocationSize)
+                   : ::operator new(allocationSize));
+  header->arena = currentArena;
+  return header + 1;
+}
+
+void ExpressionNodesArena::Deallocate(void *memory) {
+  if (!memory) return;
+
+  AllocationHeader *header = static_cast<AllocationHeader *>(memory) - 1;
+  if (header->arena)
+    header->arena->Release();
+  else
+    ::operator delete(header);
+}
+
+void *ExpressionNodesArena::AllocateInBlocks(std::size_t size) {
+  // Keep the next allocations aligned.
+  size = (size + sizeof(AllocationHeader) - 1) / sizeof(AllocationHeader) *
+         sizeof(AllocationHeader);
+
+  while (currentBlock < blocks.size() &&
+         currentOffset + size > blocks[currentBlock].size) {
+    currentBlock++;
+    currentOffset = 0;
+  }
+  if (currentBlock == blocks.size()) {
+    Block block;
+    block.size = std::max(blockSize, size);
+    block.memory.reset(new char[block.size]);
+    blocks.push_back(std::move(block));
+  }
+
+  void *memory = blocks[currentBlock].memory.get() + currentOffset;
+  currentOffset += size;
+  allocationsCount++;
+  return memory;
+}
+
+void ExpressionNodesArena::Release() {
+  allocationsCount--;
+  if (allocationsCount == 0) {
+    // All the trees are destroyed: the blocks can be reused from the start.
+    currentBlock = 0;
+    currentOffset = 0;
+  }
+}
+
+ExpressionNodesArena::Scope::Scope(ExpressionNodesArena *arena)
+    : previousArena(currentArena) {
+  currentArena = arena;
+}
+
+ExpressionNodesArena::Scope::~Scope() { currentArena = previousArena; }
+
+}  // namespace gd
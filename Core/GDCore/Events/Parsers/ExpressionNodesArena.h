@@ -0,0 +1,91 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONNODESARENA_H
+#define GDCORE_EXPRESSIONNODESARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief Reusable memory in which gd::ExpressionParser2 can allocate the nodes
+ * (and their diagnostics) of the trees of the parsed expressions, instead of
+ * allocating each node on the heap.
+ *
+ * Nodes are still owned by std::unique_ptr, so that trees are used exactly as
+ * trees allocated on the heap. Memory is taken from blocks one node after the
+ * other, and the blocks are reused for the next expressions as soon as all the
+ * nodes allocated in the arena are destroyed.
+ *
+ * An arena must be used by a single thread at a time, and must outlive all the
+ * nodes allocated in it.
+ *
+ * \see gd::ExpressionParser2::SetNodesArena
+ */
+class GD_CORE_API ExpressionNodesArena {
+ public:
+  ExpressionNodesArena(std::size_t blockSize = 16 * 1024);
+  ExpressionNodesArena(const ExpressionNodesArena &) = delete;
+  ExpressionNodesArena &operator=(const ExpressionNodesArena &) = delete;
+  ~ExpressionNodesArena(){};
+
+  /**
+   * \brief Return the number of nodes and diagnostics currently allocated in
+   * the arena.
+   */
+  std::size_t GetAllocationsCount() const { return allocationsCount; };
+
+  /**
+   * \brief Return the memory reserved by the arena, in bytes.
+   */
+  std::size_t GetReservedSize() const;
+
+  /**
+   * \brief Allocate memory for a node, in the arena used by the current thread
+   * (see gd::ExpressionNodesArena::Scope) or on the heap if there is none.
+   */
+  static void *Allocate(std::size_t size);
+
+  /**
+   * \brief Release memory allocated with Allocate.
+   */
+  static void Deallocate(void *memory);
+
+  /**
+   * \brief Use an arena to allocate the nodes created by the current thread
+   * until the scope is destroyed. Use nullptr to allocate the nodes on the
+   * heap.
+   */
+  class GD_CORE_API Scope {
+   public:
+    Scope(ExpressionNodesArena *arena);
+    ~Scope();
+
+   private:
+    ExpressionNodesArena *previousArena;
+  };
+
+ private:
+  void *AllocateInBlocks(std::size_t size);
+  void Release();
+
+  struct Block {
+    std::unique_ptr<char[]> memory;
+    std::size_t size;
+  };
+
+  std::vector<Block> blocks;
+  std::size_t blockSize;
+  std::size_t currentBlock;      ///< The block in which memory is taken.
+  std::size_t currentOffset;     ///< The first free byte of the block.
+  std::size_t allocationsCount;  ///< The number of allocations not released.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONNODESARENA_H
@@ -32,13 +32,34 @@ gd::String ExpressionParser2::TERM_OPERATORS = "/*";
 gd::String ExpressionParser2::UNARY_OPERATORS = "+-";
 gd::String ExpressionParser2::WHITESPACES = " \n\r";
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
+const std::array<unsigned char, 0x80> ExpressionParser2::CHARACTERS_CLASSES =
+    ExpressionParser2::ComputeCharactersClasses();
+
+std::array<unsigned char, 0x80> ExpressionParser2::ComputeCharactersClasses() {
+  std::array<unsigned char, 0x80> classes;
+  classes.fill(0);
+  auto addClass = [&classes](const gd::String &characters,
+                             unsigned char characterClass) {
+    for (char character : characters.Raw())
+      classes[static_cast<unsigned char>(character)] |= characterClass;
+  };
+
+  addClass(WHITESPACES, WHITESPACE_CHARACTER);
+  addClass(PARAMETERS_SEPARATOR, NOT_IN_IDENTIFIER_CHARACTER);
+  addClass(DOT, NOT_IN_IDENTIFIER_CHARACTER);
+  addClass(QUOTE, NOT_IN_IDENTIFIER_CHARACTER);
+  addClass(BRACKETS, NOT_IN_IDENTIFIER_CHARACTER);
+  addClass(EXPRESSION_OPERATORS, NOT_IN_IDENTIFIER_CHARACTER);
+  addClass(TERM_OPERATORS, NOT_IN_IDENTIFIER_CHARACTER);
+  return classes;
+}
 
 ExpressionParser2::ExpressionParser2(
     const gd::Platform& platform_,
     const gd::ObjectsContainer& globalObjectsContainer_,
     const gd::ObjectsContainer& objectsContainer_)
-    : expression(""),
-      currentPosition(0),
+    : currentPosition(0),
+      nodesArena(nullptr),
       platform(platform_),
       globalObjectsContainer(globalObjectsContainer_),
       objectsContainer(objectsContainer_) {}
@@ -6,7 +6,9 @@
 #ifndef GDCORE_EXPRESSIONPARSER2_H
 #define GDCORE_EXPRESSIONPARSER2_H
 
+#include <array>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include "ExpressionParser2Node.h"
@@ -33,6 +35,11 @@ namespace gd {
  * parser by refactoring out the dependency on gd::MetadataProvider (injecting
  * instead functions to be called to query supported functions).
  *
+ * The expression is decoded once into its code points before being parsed, so
+ * that characters are read in constant time and the parsing time is linear in
+ * the length of the expression. Positions of nodes and diagnostics are
+ * expressed in code points.
+ *
  * \see gd::ExpressionParserDiagnostic
  * \see gd::ExpressionNode
  */
@@ -58,12 +65,27 @@ class GD_CORE_API ExpressionParser2 {
       const gd::String &type,
       const gd::String &expression_,
       const gd::String &objectName = "") {
-    expression = expression_;
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
+    ExpressionNodesArena::Scope nodesArenaScope(nodesArena);
     return Start(type, objectName);
   }
 
+  /**
+   * \brief Allocate the nodes of the next parsed expressions in the given
+   * arena, or on the heap if \a nodesArena_ is nullptr (the default).
+   *
+   * Useful to parse a lot of expressions one after the other: when the tree of
+   * an expression is destroyed before the next expression is parsed, the same
+   * memory is reused for all the trees.
+   *
+   * \warning The arena must outlive the trees of the parsed expressions.
+   */
+  void SetNodesArena(ExpressionNodesArena *nodesArena_) {
+    nodesArena = nodesArena_;
+  }
+
  private:
   /** \name Grammar
    * Each method is a part of the grammar.
@@ -426,7 +448,7 @@ class GD_CORE_API ExpressionParser2 {
 
   std::pair<std::vector<std::unique_ptr<ExpressionNode>>,
             std::unique_ptr<gd::ExpressionParserError>>
-  Parameters(std::vector<gd::ParameterMetadata> parameterMetadata,
+  Parameters(const std::vector<gd::ParameterMetadata> &parameterMetadata,
              const gd::String &objectName = "",
              const gd::String &behaviorName = "") {
     std::vector<std::unique_ptr<ExpressionNode>> parameters;
@@ -504,7 +526,7 @@ class GD_CORE_API ExpressionParser2 {
     if (type == "number") {
       if (operatorChar == '+' || operatorChar == '-' || operatorChar == '/' ||
           operatorChar == '*') {
-        return gd::make_unique<ExpressionParserDiagnostic>();
+        return nullptr;
       }
 
       return gd::make_unique<ExpressionParserError>(
@@ -514,7 +536,7 @@ class GD_CORE_API ExpressionParser2 {
           GetCurrentPosition());
     } else if (type == "string") {
       if (operatorChar == '+') {
-        return gd::make_unique<ExpressionParserDiagnostic>();
+        return nullptr;
       }
 
       return gd::make_unique<ExpressionParserError>(
@@ -535,14 +557,14 @@ class GD_CORE_API ExpressionParser2 {
           GetCurrentPosition());
     }
 
-    return gd::make_unique<ExpressionParserDiagnostic>();
+    return nullptr;
   }
 
   std::unique_ptr<ExpressionParserDiagnostic> ValidateUnaryOperator(
       const gd::String &type, gd::String::value_type operatorChar) {
     if (type == "number") {
       if (operatorChar == '+' || operatorChar == '-') {
-        return gd::make_unique<ExpressionParserDiagnostic>();
+        return nullptr;
       }
 
       return gd::make_unique<ExpressionParserError>(
@@ -571,7 +593,7 @@ class GD_CORE_API ExpressionParser2 {
           GetCurrentPosition());
     }
 
-    return gd::make_unique<ExpressionParserDiagnostic>();
+    return nullptr;
   }
   ///@}
 
@@ -583,7 +605,7 @@ class GD_CORE_API ExpressionParser2 {
 
   void SkipWhitespace() {
     while (currentPosition < expression.size() &&
-           WHITESPACES.find(expression[currentPosition]) != gd::String::npos) {
+           IsWhitespace(expression[currentPosition])) {
       currentPosition++;
     }
   }
@@ -603,60 +625,64 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   bool IsAnyChar(const gd::String &allowedCharacters) {
-    if (currentPosition < expression.size() &&
-        allowedCharacters.find(expression[currentPosition]) !=
-            gd::String::npos) {
-      return true;
-    }
+    if (currentPosition >= expression.size()) return false;
+
+    // The sets of characters used by the grammar are ASCII: look for the
+    // character in the bytes, without decoding the set.
+    gd::String::value_type character = expression[currentPosition];
+    if (character < 0x80)
+      return allowedCharacters.Raw().find(static_cast<char>(character)) !=
+             std::string::npos;
 
-    return false;
+    return allowedCharacters.find(character) != gd::String::npos;
   }
 
   bool IsIdentifierAllowedChar() {
-    if (currentPosition < expression.size() &&
-        PARAMETERS_SEPARATOR.find(expression[currentPosition]) ==
-            gd::String::npos &&
-        DOT.find(expression[currentPosition]) == gd::String::npos &&
-        QUOTE.find(expression[currentPosition]) == gd::String::npos &&
-        BRACKETS.find(expression[currentPosition]) == gd::String::npos &&
-        EXPRESSION_OPERATORS.find(expression[currentPosition]) ==
-            gd::String::npos &&
-        TERM_OPERATORS.find(expression[currentPosition]) == gd::String::npos) {
-      return true;
-    }
+    return currentPosition < expression.size() &&
+           !HasCharacterClass(expression[currentPosition],
+                              NOT_IN_IDENTIFIER_CHARACTER);
+  }
 
-    return false;
+  bool IsWhitespace(gd::String::value_type character) {
+    return HasCharacterClass(character, WHITESPACE_CHARACTER);
   }
 
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    const std::string &separator = NAMESPACE_SEPARATOR.Raw();
+    if (currentPosition + separator.size() > expression.size()) return false;
+
+    for (std::size_t i = 0; i < separator.size(); ++i) {
+      if (expression[currentPosition + i] !=
+          static_cast<gd::String::value_type>(separator[i]))
+        return false;
+    }
+
+    return true;
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
 
   gd::String ReadIdentifierName() {
-    gd::String name;
+    size_t nameStartPosition = currentPosition;
     while (currentPosition < expression.size() &&
            (IsIdentifierAllowedChar()
             // Allow whitespace in identifier name for compatibility
             || expression[currentPosition] == ' ')) {
-      name += expression[currentPosition];
       currentPosition++;
     }
 
     // Trim whitespace at the end (we allow them for compatibility inside
     // the name, but after the last character that is not whitespace, they
     // should be ignore again).
-    size_t lastCharacterPos = name.find_last_not_of(WHITESPACES);
-    if (!name.empty() && (lastCharacterPos + 1) < name.size()) {
-      name.erase(lastCharacterPos + 1);
+    size_t nameEndPosition = currentPosition;
+    while (nameEndPosition > nameStartPosition &&
+           IsWhitespace(expression[nameEndPosition - 1])) {
+      nameEndPosition--;
     }
 
-    return name;
+    return GetSubstring(nameStartPosition, nameEndPosition);
   }
 
   std::unique_ptr<TextNode> ReadText();
@@ -664,28 +690,35 @@ class GD_CORE_API ExpressionParser2 {
   std::unique_ptr<NumberNode> ReadNumber();
 
   std::unique_ptr<EmptyNode> ReadUntilWhitespace(gd::String type) {
-    gd::String text;
+    size_t textStartPosition = currentPosition;
     while (currentPosition < expression.size() &&
-           WHITESPACES.find(expression[currentPosition]) == gd::String::npos) {
-      text += expression[currentPosition];
+           !IsWhitespace(expression[currentPosition])) {
       currentPosition++;
     }
 
-    return gd::make_unique<EmptyNode>(type, text);
+    return gd::make_unique<EmptyNode>(
+        type, GetSubstring(textStartPosition, currentPosition));
   }
 
   std::unique_ptr<EmptyNode> ReadUntilEnd(gd::String type) {
-    gd::String text;
-    while (currentPosition < expression.size()) {
-      text += expression[currentPosition];
-      currentPosition++;
-    }
+    size_t textStartPosition = currentPosition;
+    currentPosition = expression.size();
 
-    return gd::make_unique<EmptyNode>(type, text);
+    return gd::make_unique<EmptyNode>(
+        type, GetSubstring(textStartPosition, currentPosition));
   }
 
   size_t GetCurrentPosition() { return currentPosition; }
 
+  /**
+   * \brief Return the characters of the expression between the two positions
+   * (the end position being excluded).
+   */
+  gd::String GetSubstring(size_t startPosition, size_t endPosition) {
+    return gd::String::FromUTF32(
+        expression.substr(startPosition, endPosition - startPosition));
+  }
+
   gd::String::value_type GetCurrentChar() {
     if (currentPosition < expression.size()) {
       return expression[currentPosition];
@@ -739,8 +772,29 @@ class GD_CORE_API ExpressionParser2 {
     return !behaviorName.empty() ? 2 : (!objectName.empty() ? 1 : 0);
   }
 
-  gd::String expression;
+  /** \name Characters classes
+   * Classes of the ASCII characters, so that characters are classified with a
+   * single lookup in CHARACTERS_CLASSES.
+   */
+  ///@{
+  enum CharacterClass : unsigned char {
+    WHITESPACE_CHARACTER = 1 << 0,
+    NOT_IN_IDENTIFIER_CHARACTER = 1 << 1,
+  };
+
+  static bool HasCharacterClass(gd::String::value_type character,
+                                unsigned char characterClass) {
+    return character < CHARACTERS_CLASSES.size() &&
+           (CHARACTERS_CLASSES[character] & characterClass) != 0;
+  }
+
+  static std::array<unsigned char, 0x80> ComputeCharactersClasses();
+  static const std::array<unsigned char, 0x80> CHARACTERS_CLASSES;
+  ///@}
+
+  std::u32string expression;  ///< The code points of the parsed expression.
   std::size_t currentPosition;
+  ExpressionNodesArena *nodesArena;
 
   const gd::Platform &platform;
   const gd::ObjectsContainer &globalObjectsContainer;
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <vector>
+#include "ExpressionNodesArena.h"
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -24,11 +25,19 @@ namespace gd {
  * \brief A diagnostic that can be attached to a gd::ExpressionNode.
  */
 struct ExpressionParserDiagnostic {
+  virtual ~ExpressionParserDiagnostic(){};
   virtual bool IsError() { return false; }
   virtual const gd::String &GetMessage() { return noMessage; }
   virtual size_t GetStartPosition() { return 0; }
   virtual size_t GetEndPosition() { return 0; }
 
+  static void *operator new(std::size_t size) {
+    return ExpressionNodesArena::Allocate(size);
+  }
+  static void operator delete(void *memory) {
+    ExpressionNodesArena::Deallocate(memory);
+  }
+
  private:
   static gd::String noMessage;
 };
@@ -74,6 +83,17 @@ struct ExpressionNode {
   virtual ~ExpressionNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
 
+  /**
+   * Nodes are allocated in the arena used by the parser, if any.
+   * \see gd::ExpressionNodesArena
+   */
+  static void *operator new(std::size_t size) {
+    return ExpressionNodesArena::Allocate(size);
+  }
+  static void operator delete(void *memory) {
+    ExpressionNodesArena::Deallocate(memory);
+  }
+
   std::unique_ptr<ExpressionParserDiagnostic> diagnostic;
 };
 
@@ -8,7 +8,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/String.h"
 
-EventsCodeNameMangler *EventsCodeNameMangler::_singleton = NULL;
+std::atomic<EventsCodeNameMangler *> EventsCodeNameMangler::_singleton(NULL);
 
 gd::String EventsCodeNameMangler::GetMangledObjectsListName(
     const gd::String &originalObjectName) {
@@ -55,16 +55,20 @@ gd::String ManObjListName(const gd::String &objectName) {
 }
 
 EventsCodeNameMangler *EventsCodeNameMangler::Get() {
-  if (NULL == _singleton) _singleton = new EventsCodeNameMangler;
+  EventsCodeNameMangler *singleton = _singleton;
+  if (NULL == singleton) {
+    EventsCodeNameMangler *newSingleton = new EventsCodeNameMangler;
+    if (_singleton.compare_exchange_strong(singleton, newSingleton))
+      singleton = newSingleton;
+    else
+      delete newSingleton;  // Created by another thread in the meantime.
+  }
 
-  return (static_cast<EventsCodeNameMangler *>(_singleton));
+  return singleton;
 }
 
 void EventsCodeNameMangler::DestroySingleton() {
-  if (NULL != _singleton) {
-    delete _singleton;
-    _singleton = NULL;
-  }
+  delete _singleton.exchange(NULL);
 }
 
 #endif
@@ -6,6 +6,7 @@
 #if defined(GD_IDE_ONLY)
 #ifndef EVENTSCODENAMEMANGLER_H
 #define EVENTSCODENAMEMANGLER_H
+#include <atomic>
 #include "GDCore/String.h"
 
 /**
@@ -34,7 +35,9 @@ class GD_CORE_API EventsCodeNameMangler {
  private:
   EventsCodeNameMangler(){};
   virtual ~EventsCodeNameMangler(){};
-  static EventsCodeNameMangler *_singleton;
+  static std::atomic<EventsCodeNameMangler *>
+      _singleton;  ///< Atomic as events of several scenes can be generated in
+                   ///< parallel.
 };
 
 /**
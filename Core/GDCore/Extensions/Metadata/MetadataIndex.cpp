@@ -0,0 +1,83 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+
+namespace gd {
+
+namespace {
+template <class T>
+void AddAll(MetadataIndex::Metadata<T>& index,
+            const gd::PlatformExtension& extension,
+            const std::map<gd::String, T>& allMetadata) {
+  for (auto& it : allMetadata) index.Add(it.first, extension, it.second);
+}
+}  // namespace
+
+void MetadataIndex::AddExtension(gd::PlatformExtension& extension) {
+  std::vector<gd::String> objectsTypes = extension.GetExtensionObjectsTypes();
+  std::vector<gd::String> behaviorsTypes = extension.GetBehaviorsTypes();
+  for (auto& objectType : objectsTypes)
+    objects.Add(objectType, extension, extension.GetObjectMetadata(objectType));
+  for (auto& behaviorType : behaviorsTypes)
+    behaviors.Add(
+        behaviorType, extension, extension.GetBehaviorMetadata(behaviorType));
+
+  AddAll(actions.free, extension, extension.GetAllActions());
+  AddAll(actions.any, extension, extension.GetAllActions());
+  AddAll(conditions.free, extension, extension.GetAllConditions());
+  AddAll(conditions.any, extension, extension.GetAllConditions());
+  AddAll(expressions.free, extension, extension.GetAllExpressions());
+  AddAll(strExpressions.free, extension, extension.GetAllStrExpressions());
+
+  for (auto& objectType : objectsTypes) {
+    auto& objectActions = extension.GetAllActionsForObject(objectType);
+    auto& objectConditions = extension.GetAllConditionsForObject(objectType);
+    AddAll(actions.objects[objectType], extension, objectActions);
+    AddAll(actions.any, extension, objectActions);
+    AddAll(conditions.objects[objectType], extension, objectConditions);
+    AddAll(conditions.any, extension, objectConditions);
+    AddAll(expressions.objects[objectType],
+           extension,
+           extension.GetAllExpressionsForObject(objectType));
+    AddAll(strExpressions.objects[objectType],
+           extension,
+           extension.GetAllStrExpressionsForObject(objectType));
+  }
+
+  for (auto& behaviorType : behaviorsTypes) {
+    auto& behaviorActions = extension.GetAllActionsForBehavior(behaviorType);
+    auto& behaviorConditions =
+        extension.GetAllConditionsForBehavior(behaviorType);
+    AddAll(actions.behaviors[behaviorType], extension, behaviorActions);
+    AddAll(actions.any, extension, behaviorActions);
+    AddAll(conditions.behaviors[behaviorType], extension, behaviorConditions);
+    AddAll(conditions.any, extension, behaviorConditions);
+    AddAll(expressions.behaviors[behaviorType],
+           extension,
+           extension.GetAllExpressionsForBehavior(behaviorType));
+    AddAll(strExpressions.behaviors[behaviorType],
+           extension,
+           extension.GetAllStrExpressionsForBehavior(behaviorType));
+  }
+}
+
+void MetadataIndex::Clear() {
+  objects.Clear();
+  behaviors.Clear();
+  actions.Clear();
+  conditions.Clear();
+  expressions.Clear();
+  strExpressions.Clear();
+}
+
+}  // namespace gd
+#endif
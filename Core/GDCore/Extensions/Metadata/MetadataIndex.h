@@ -0,0 +1,178 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#ifndef GDCORE_METADATAINDEX_H
+#define GDCORE_METADATAINDEX_H
+#include <unordered_map>
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/String.h"
+namespace gd {
+class BehaviorMetadata;
+class ExpressionMetadata;
+class InstructionMetadata;
+class ObjectMetadata;
+class PlatformExtension;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Index of the metadata of the objects, behaviors, instructions and
+ * expressions declared by the extensions of a platform, used by
+ * gd::MetadataProvider to find metadata without going through all the
+ * extensions.
+ *
+ * The index is built by gd::Platform when first used after extensions are
+ * added or removed: extensions must not be changed once the platform is used
+ * to find metadata. If several extensions declare the same type, the first
+ * added extension is used, as when the extensions are searched in order.
+ *
+ * \see gd::MetadataProvider
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API MetadataIndex {
+ public:
+  /**
+   * \brief Metadata indexed by their type.
+   */
+  template <class T>
+  class Metadata {
+   public:
+    /**
+     * \brief Return the metadata of the specified type, or NULL if there is
+     * none.
+     */
+    const ExtensionAndMetadata<T>* Find(const gd::String& type) const {
+      auto it = metadata.find(type);
+      return it != metadata.end() ? &it->second : NULL;
+    }
+
+    /**
+     * \brief Add the metadata, unless there is already one with this type.
+     */
+    void Add(const gd::String& type,
+             const gd::PlatformExtension& extension,
+             const T& metadata_) {
+      metadata.emplace(type, ExtensionAndMetadata<T>(extension, metadata_));
+    }
+
+    void Clear() { metadata.clear(); }
+
+   private:
+    std::unordered_map<gd::String, ExtensionAndMetadata<T>> metadata;
+  };
+
+  /**
+   * \brief Metadata of the instructions or expressions of a kind (actions,
+   * conditions...).
+   */
+  template <class T>
+  class Functions {
+   public:
+    /**
+     * \brief Return the metadata of a function not related to an object or a
+     * behavior, or NULL if there is none.
+     */
+    const ExtensionAndMetadata<T>* FindFree(const gd::String& type) const {
+      return free.Find(type);
+    }
+
+    /**
+     * \brief Return the metadata of a function, whether it is related to an
+     * object or a behavior or not, or NULL if there is none.
+     */
+    const ExtensionAndMetadata<T>* FindAny(const gd::String& type) const {
+      return any.Find(type);
+    }
+
+    /**
+     * \brief Return the metadata of a function of the specified object type
+     * or, if there is none, of the base object. Return NULL if there is none.
+     */
+    const ExtensionAndMetadata<T>* FindForObject(const gd::String& objectType,
+                                                 const gd::String& type) const {
+      return FindInScope(objects, objectType, type);
+    }
+
+    /**
+     * \brief Return the metadata of a function of the specified behavior type
+     * or, if there is none, of the base behavior. Return NULL if there is none.
+     */
+    const ExtensionAndMetadata<T>* FindForBehavior(
+        const gd::String& behaviorType, const gd::String& type) const {
+      return FindInScope(behaviors, behaviorType, type);
+    }
+
+   private:
+    friend class MetadataIndex;
+
+    static const ExtensionAndMetadata<T>* FindInScope(
+        const std::unordered_map<gd::String, Metadata<T>>& scopes,
+        const gd::String& scope,
+        const gd::String& type) {
+      auto it = scopes.find(scope);
+      if (it != scopes.end()) {
+        const ExtensionAndMetadata<T>* metadata = it->second.Find(type);
+        if (metadata) return metadata;
+      }
+
+      it = scopes.find("");
+      return it != scopes.end() ? it->second.Find(type) : NULL;
+    }
+
+    void Clear() {
+      free.Clear();
+      any.Clear();
+      objects.clear();
+      behaviors.clear();
+    }
+
+    Metadata<T> free;  ///< Functions not related to an object or a behavior.
+    Metadata<T> any;   ///< All the functions, searched in each extension in
+                       ///< this order: free, objects, behaviors functions.
+    std::unordered_map<gd::String, Metadata<T>>
+        objects;  ///< Functions of objects, by object type ("" for the base
+                  ///< object).
+    std::unordered_map<gd::String, Metadata<T>>
+        behaviors;  ///< Functions of behaviors, by behavior type.
+  };
+
+  /**
+   * \brief Add to the index the metadata declared by an extension.
+   */
+  void AddExtension(gd::PlatformExtension& extension);
+
+  /**
+   * \brief Remove all the metadata from the index.
+   */
+  void Clear();
+
+  const Metadata<ObjectMetadata>& GetObjects() const { return objects; }
+  const Metadata<BehaviorMetadata>& GetBehaviors() const { return behaviors; }
+  const Functions<InstructionMetadata>& GetActions() const { return actions; }
+  const Functions<InstructionMetadata>& GetConditions() const {
+    return conditions;
+  }
+  const Functions<ExpressionMetadata>& GetExpressions() const {
+    return expressions;
+  }
+  const Functions<ExpressionMetadata>& GetStrExpressions() const {
+    return strExpressions;
+  }
+
+ private:
+  Metadata<ObjectMetadata> objects;
+  Metadata<BehaviorMetadata> behaviors;
+  Functions<InstructionMetadata> actions;
+  Functions<InstructionMetadata> conditions;
+  Functions<ExpressionMetadata> expressions;
+  Functions<ExpressionMetadata> strExpressions;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_METADATAINDEX_H
+#endif
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
@@ -23,19 +24,26 @@ gd::ExpressionMetadata MetadataProvider::badExpressionMetadata;
 gd::ExpressionMetadata MetadataProvider::badStrExpressionMetadata;
 gd::PlatformExtension MetadataProvider::badExtension;
 
+namespace {
+/**
+ * Return the metadata found in the index of the platform, or the bad metadata
+ * if nothing was found.
+ */
+template <class T>
+ExtensionAndMetadata<T> FoundOrBad(const ExtensionAndMetadata<T>* found,
+                                   const gd::PlatformExtension& badExtension,
+                                   const T& badMetadata) {
+  return found ? *found : ExtensionAndMetadata<T>(badExtension, badMetadata);
+}
+}  // namespace
+
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto behaviorTypes = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < behaviorTypes.size(); ++j) {
-      if (behaviorTypes[j] == behaviorType)
-        return ExtensionAndMetadata<BehaviorMetadata>(
-            *extension, extension->GetBehaviorMetadata(behaviorType));
-    }
-  }
-
-  return ExtensionAndMetadata<BehaviorMetadata>(badExtension, badBehaviorInfo);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetBehaviors().Find(behaviorType),
+      badExtension,
+      badBehaviorInfo);
 }
 
 const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
@@ -46,16 +54,9 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionObjectsTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == objectType)
-        return ExtensionAndMetadata<ObjectMetadata>(
-            *extension, extension->GetObjectMetadata(objectType));
-    }
-  }
-
-  return ExtensionAndMetadata<ObjectMetadata>(badExtension, badObjectInfo);
+  return FoundOrBad(platform.GetMetadataIndex().GetObjects().Find(objectType),
+                    badExtension,
+                    badObjectInfo);
 }
 
 const ObjectMetadata& MetadataProvider::GetObjectMetadata(
@@ -66,34 +67,10 @@ const ObjectMetadata& MetadataProvider::GetObjectMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
-    }
-  }
-
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetActions().FindAny(actionType),
+      badExtension,
+      badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
@@ -104,34 +81,10 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjetsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjetsConditions.find(conditionType) != allObjetsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjetsConditions.find(conditionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
-    }
-  }
-
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetConditions().FindAny(conditionType),
+      badExtension,
+      badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
@@ -143,29 +96,11 @@ const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectExpressions =
-          extension->GetAllExpressionsForObject(objectType);
-      if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allObjectExpressions =
-        extension->GetAllExpressionsForObject("");
-    if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetExpressions().FindForObject(objectType,
+                                                                 exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
@@ -177,29 +112,11 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& autos = extension->GetBehaviorsTypes();
-    if (find(autos.begin(), autos.end(), autoType) != autos.end()) {
-      const auto& allAutoExpressions =
-          extension->GetAllExpressionsForBehavior(autoType);
-      if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allAutoExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allAutoExpressions =
-        extension->GetAllExpressionsForBehavior("");
-    if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allAutoExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetExpressions().FindForBehavior(autoType,
+                                                                   exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
@@ -211,16 +128,10 @@ const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetExpressions().FindFree(exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
@@ -231,30 +142,11 @@ const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectStrExpressions =
-          extension->GetAllStrExpressionsForObject(objectType);
-      if (allObjectStrExpressions.find(exprType) !=
-          allObjectStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allObjectStrExpressions =
-        extension->GetAllStrExpressionsForObject("");
-    if (allObjectStrExpressions.find(exprType) != allObjectStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badStrExpressionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetStrExpressions().FindForObject(objectType,
+                                                                    exprType),
+      badExtension,
+      badStrExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
@@ -267,31 +159,11 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& autos = extension->GetBehaviorsTypes();
-    if (find(autos.begin(), autos.end(), autoType) != autos.end()) {
-      const auto& allBehaviorStrExpressions =
-          extension->GetAllStrExpressionsForBehavior(autoType);
-      if (allBehaviorStrExpressions.find(exprType) !=
-          allBehaviorStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allBehaviorStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allBehaviorStrExpressions =
-        extension->GetAllStrExpressionsForBehavior("");
-    if (allBehaviorStrExpressions.find(exprType) !=
-        allBehaviorStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allBehaviorStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badStrExpressionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetStrExpressions().FindForBehavior(autoType,
+                                                                      exprType),
+      badExtension,
+      badStrExpressionMetadata);
 }
 
 const gd::ExpressionMetadata&
@@ -306,16 +178,10 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllStrExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badStrExpressionMetadata);
+  return FoundOrBad(
+      platform.GetMetadataIndex().GetStrExpressions().FindFree(exprType),
+      badExtension,
+      badStrExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
@@ -325,195 +191,79 @@ const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
 
 bool MetadataProvider::HasAction(const gd::Platform& platform,
                                  gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActions();
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetActions().FindFree(name) != NULL;
 }
 
 bool MetadataProvider::HasObjectAction(const gd::Platform& platform,
                                        gd::String objectType,
                                        gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForObject(objectType);
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForObject("");
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetActions().FindForObject(
+             objectType, name) != NULL;
 }
 
 bool MetadataProvider::HasBehaviorAction(const gd::Platform& platform,
                                          gd::String behaviorType,
                                          gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForBehavior(behaviorType);
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForBehavior("");
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetActions().FindForBehavior(
+             behaviorType, name) != NULL;
 }
 
 bool MetadataProvider::HasCondition(const gd::Platform& platform,
                                     gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditions();
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetConditions().FindFree(name) != NULL;
 }
 
 bool MetadataProvider::HasObjectCondition(const gd::Platform& platform,
                                           gd::String objectType,
                                           gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditionsForObject(objectType);
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditionsForObject("");
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetConditions().FindForObject(
+             objectType, name) != NULL;
 }
 
 bool MetadataProvider::HasBehaviorCondition(const gd::Platform& platform,
                                             gd::String behaviorType,
                                             gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& conditions =
-        extension->GetAllConditionsForBehavior(behaviorType);
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditionsForBehavior("");
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetConditions().FindForBehavior(
+             behaviorType, name) != NULL;
 }
 
 bool MetadataProvider::HasExpression(const gd::Platform& platform,
                                      gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressions();
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetExpressions().FindFree(name) != NULL;
 }
 
 bool MetadataProvider::HasObjectExpression(const gd::Platform& platform,
                                            gd::String objectType,
                                            gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressionsForObject(objectType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressionsForObject("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetExpressions().FindForObject(
+             objectType, name) != NULL;
 }
 
 bool MetadataProvider::HasBehaviorExpression(const gd::Platform& platform,
                                              gd::String behaviorType,
                                              gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions =
-        extension->GetAllExpressionsForBehavior(behaviorType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressionsForBehavior("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetExpressions().FindForBehavior(
+             behaviorType, name) != NULL;
 }
 
 bool MetadataProvider::HasStrExpression(const gd::Platform& platform,
                                         gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllStrExpressions();
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetStrExpressions().FindFree(name) !=
+         NULL;
 }
 
 bool MetadataProvider::HasObjectStrExpression(const gd::Platform& platform,
                                               gd::String objectType,
                                               gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions =
-        extension->GetAllStrExpressionsForObject(objectType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllStrExpressionsForObject("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetStrExpressions().FindForObject(
+             objectType, name) != NULL;
 }
 
 bool MetadataProvider::HasBehaviorStrExpression(const gd::Platform& platform,
                                                 gd::String behaviorType,
                                                 gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions =
-        extension->GetAllStrExpressionsForBehavior(behaviorType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllStrExpressionsForBehavior("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return platform.GetMetadataIndex().GetStrExpressions().FindForBehavior(
+             behaviorType, name) != NULL;
 }
 
 MetadataProvider::~MetadataProvider() {}
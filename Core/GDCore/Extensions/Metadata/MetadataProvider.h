@@ -55,6 +55,9 @@ class ExtensionAndMetadata {
  * \brief Allow to easily get metadata for instructions (i.e actions and
  * conditions), expressions, objects and behaviors.
  *
+ * Metadata are found in constant time using the index of the platform (see
+ * gd::Platform::GetMetadataIndex).
+ *
  * \ingroup PlatformDefinition
  */
 class GD_CORE_API MetadataProvider {
@@ -15,7 +15,11 @@ using namespace std;
 
 namespace gd {
 
+#if defined(GD_IDE_ONLY)
+Platform::Platform() : metadataIndexBuilt(false) {}
+#else
 Platform::Platform() {}
+#endif
 
 Platform::~Platform() {}
 
@@ -30,6 +34,9 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+#if defined(GD_IDE_ONLY)
+  InvalidateMetadataIndex();
+#endif
 
   // Load all creation/destruction functions for objects provided by the
   // extension
@@ -61,7 +68,33 @@ void Platform::RemoveExtension(const gd::String& name) {
                                      return extension->GetName() == name;
                                    }),
                          extensionsLoaded.end());
+
+#if defined(GD_IDE_ONLY)
+  InvalidateMetadataIndex();
+#endif
+}
+
+#if defined(GD_IDE_ONLY)
+const gd::MetadataIndex& Platform::GetMetadataIndex() const {
+  if (!metadataIndexBuilt.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(metadataIndexMutex);
+    if (!metadataIndexBuilt.load(std::memory_order_relaxed)) {
+      metadataIndex.reset(new gd::MetadataIndex);
+      for (auto& extension : extensionsLoaded)
+        metadataIndex->AddExtension(*extension);
+      metadataIndexBuilt.store(true, std::memory_order_release);
+    }
+  }
+
+  return *metadataIndex;
+}
+
+void Platform::InvalidateMetadataIndex() {
+  std::lock_guard<std::mutex> lock(metadataIndexMutex);
+  metadataIndexBuilt.store(false, std::memory_order_release);
+  metadataIndex.reset();
 }
+#endif
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
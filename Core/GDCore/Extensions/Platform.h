@@ -10,6 +10,11 @@
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
+#if defined(GD_IDE_ONLY)
+#include <atomic>
+#include <mutex>
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
+#endif
 
 namespace gd {
 class InstructionsMetadataHolder;
@@ -123,6 +128,17 @@ class GD_CORE_API Platform {
    * anymore.
    */
   virtual void RemoveExtension(const gd::String& name);
+
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Get the index of the metadata declared by the extensions.
+   *
+   * The index is built by the first call after an extension is added or
+   * removed, so that platforms never queried for metadata don't hold it.
+   * \see gd::MetadataProvider
+   */
+  const gd::MetadataIndex& GetMetadataIndex() const;
+#endif
   ///@}
 
   /** \name Factory method
@@ -173,6 +189,19 @@ class GD_CORE_API Platform {
       extensionsLoaded;  ///< Extensions of the platform
   std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Drop the index of the metadata, so that it's built again when
+   * needed.
+   */
+  void InvalidateMetadataIndex();
+
+  mutable std::unique_ptr<gd::MetadataIndex>
+      metadataIndex;  ///< Index of the metadata of extensions, built lazily.
+  mutable std::atomic<bool> metadataIndexBuilt;  ///< True if metadataIndex
+                                                 ///< is up to date.
+  mutable std::mutex metadataIndexMutex;  ///< Protects the build of the index.
+#endif
 };
 
 }  // namespace gd
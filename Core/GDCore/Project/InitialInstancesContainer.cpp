@@ -10,6 +10,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Serialization/JSONReader.h"
 #include "GDCore/Serialization/SerializerElement.h"
 
 using namespace std;
@@ -36,6 +37,27 @@ void InitialInstancesContainer::UnserializeFrom(
   }
 }
 
+void InitialInstancesContainer::UnserializeFrom(gd::JSONReader& reader) {
+  if (reader.PeekValueType() != gd::JSONReader::Array) {
+    SerializerElement element;
+    reader.ReadElement(element);
+    UnserializeFrom(element);
+    return;
+  }
+
+  initialInstances.clear();
+
+  // Only one instance at a time is stored in an element.
+  reader.EnterArray();
+  while (reader.NextElement()) {
+    SerializerElement instanceElement;
+    reader.ReadElement(instanceElement);
+
+    initialInstances.emplace_back();
+    initialInstances.back().UnserializeFrom(instanceElement);
+  }
+}
+
 void InitialInstancesContainer::IterateOverInstances(
     gd::InitialInstanceFunctor& func) {
   for (auto& instance : initialInstances) func(instance);
@@ -17,6 +17,7 @@ class Project;
 }
 namespace gd {
 class SerializerElement;
+class JSONReader;
 }
 
 namespace gd {
@@ -100,6 +101,14 @@ class GD_CORE_API InitialInstancesContainer {
   void IterateOverInstancesWithZOrdering(InitialInstanceFunctor &func,
                                          const gd::String &layer);
 
+  /**
+   * \brief Exchange the instances of the container with the instances of
+   * \a other, without copying them.
+   */
+  void Swap(InitialInstancesContainer &other) {
+    initialInstances.swap(other.initialInstances);
+  }
+
 #if defined(GD_IDE_ONLY)
   /**
    * \brief Insert the specified \a instance into the list and return a
@@ -174,6 +183,12 @@ class GD_CORE_API InitialInstancesContainer {
    * \brief Unserialize the instances container.
    */
   virtual void UnserializeFrom(const SerializerElement &element);
+
+  /**
+   * \brief Unserialize the instances container, reading the instances one by
+   * one from a JSON document.
+   */
+  void UnserializeFrom(gd::JSONReader &reader);
   ///@}
 
  private:
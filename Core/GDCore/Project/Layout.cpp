@@ -19,6 +19,7 @@
 #include "GDCore/Project/ObjectGroup.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/JSONReader.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/PolymorphicClone.h"
@@ -33,7 +34,10 @@ gd::BehaviorsSharedData Layout::badBehaviorSharedData;
 Layout::Layout(const Layout& other) { Init(other); }
 
 Layout& Layout::operator=(const Layout& other) {
-  if (this != &other) Init(other);
+  if (this != &other) {
+    if (name != other.name) namesIndexLink.NotifyRenamed();
+    Init(other);
+  }
 
   return *this;
 }
@@ -63,7 +67,9 @@ Layout::Layout()
 }
 
 void Layout::SetName(const gd::String& name_) {
+  if (name_ == name) return;
   name = name_;
+  namesIndexLink.NotifyRenamed();
   mangledName = gd::SceneNameMangler::GetMangledSceneName(name);
 };
 
@@ -384,8 +390,38 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
 }
 
+void Layout::UnserializeFrom(gd::Project& project, gd::JSONReader& reader) {
+  SerializerElement element;
+  gd::InitialInstancesContainer instances;
+  ReadFromJSON(reader, element, instances);
+
+  UnserializeFrom(project, element);
+  initialInstances.Swap(instances);
+}
+
+void Layout::ReadFromJSON(gd::JSONReader& reader,
+                          SerializerElement& element,
+                          gd::InitialInstancesContainer& instances) {
+  if (!reader.EnterObject()) {
+    reader.ReadElement(element);
+    return;
+  }
+
+  gd::String name;
+  while (reader.NextMember(name)) {
+    if (name == "instances" || name == "Positions") {
+      // The element gets an empty list, the instances being given separately.
+      element.AddChild(name).ConsiderAsArray();
+      instances.UnserializeFrom(reader);
+    } else {
+      reader.ReadElement(element.AddChild(name));
+    }
+  }
+}
+
 void Layout::Init(const Layout& other) {
-  SetName(other.name);
+  name = other.name;
+  mangledName = other.mangledName;
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
   backgroundColorB = other.backgroundColorB;
@@ -401,6 +437,7 @@ void Layout::Init(const Layout& other) {
   variables = other.GetVariables();
 
   initialObjects = gd::Clone(other.initialObjects);
+  RebuildObjectsNamesIndex();
 
   behaviorsInitialSharedDatas.clear();
   for (std::map<gd::String,
@@ -17,6 +17,7 @@
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 #if defined(GD_IDE_ONLY)
 #include "GDCore/IDE/Dialogs/LayoutEditorCanvas/LayoutEditorCanvasOptions.h"
 #endif
@@ -25,6 +26,7 @@ class BaseEvent;
 class Object;
 class Project;
 class InitialInstancesContainer;
+class JSONReader;
 }
 class TiXmlElement;
 class BaseProfiler;
@@ -69,6 +71,12 @@ class GD_CORE_API Layout : public ObjectsContainer {
    */
   const gd::String& GetMangledName() const { return mangledName; };
 
+  /**
+   * \brief Return the link to the index of the project storing the layout.
+   * \note Used by gd::Project.
+   */
+  NamesIndexLink& GetNamesIndexLink() { return namesIndexLink; }
+
   /**
    * Set the background color
    */
@@ -398,6 +406,24 @@ class GD_CORE_API Layout : public ObjectsContainer {
    * \brief Unserialize the layout.
    */
   void UnserializeFrom(gd::Project& project, const SerializerElement& element);
+
+  /**
+   * \brief Unserialize the layout, reading it from a JSON document.
+   *
+   * The instances are unserialized while they are read, so that they are never
+   * all stored in a SerializerElement.
+   */
+  void UnserializeFrom(gd::Project& project, gd::JSONReader& reader);
+
+  /**
+   * \brief Read a layout from a JSON document into \a element, except for its
+   * instances which are unserialized directly into \a instances.
+   *
+   * \see gd::Layout::UnserializeFrom(gd::Project&, gd::JSONReader&)
+   */
+  static void ReadFromJSON(gd::JSONReader& reader,
+                           SerializerElement& element,
+                           gd::InitialInstancesContainer& instances);
 ///@}
 
 // TODO: GD C++ Platform specific code below
@@ -481,6 +507,8 @@ class GD_CORE_API Layout : public ObjectsContainer {
  private:
   gd::String name;         ///< Scene name
   gd::String mangledName;  ///< The scene name mangled by SceneNameMangler
+  NamesIndexLink namesIndexLink;  ///< Link to the index of the project of the
+                                  ///< layout, invalidated by renames.
   unsigned int backgroundColorR;     ///< Background color Red component
   unsigned int backgroundColorG;     ///< Background color Green component
   unsigned int backgroundColorB;     ///< Background color Blue component
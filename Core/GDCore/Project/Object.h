@@ -13,6 +13,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
@@ -46,7 +47,10 @@ class GD_CORE_API Object {
    * Assignment operator. Calls Init().
    */
   Object& operator=(const gd::Object& object) {
-    if ((this) != &object) Init(object);
+    if ((this) != &object) {
+      if (name != object.name) namesIndexLink.NotifyRenamed();
+      Init(object);
+    }
     return *this;
   }
 
@@ -74,12 +78,22 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_) {
+    if (name_ == name) return;
+    name = name_;
+    namesIndexLink.NotifyRenamed();
+  };
 
   /** \brief Return the name of the object.
    */
   const gd::String& GetName() const { return name; };
 
+  /**
+   * \brief Return the link to the index of the container storing the object.
+   * \note Used by gd::ObjectsContainer.
+   */
+  NamesIndexLink& GetNamesIndexLink() { return namesIndexLink; }
+
   /** \brief Change the type of the object.
    */
   void SetType(const gd::String& type_) { type = type_; }
@@ -293,6 +307,8 @@ class GD_CORE_API Object {
                   ///< ownership of the object
   gd::VariablesContainer
       objectVariables;  ///< List of the variables of the object
+  NamesIndexLink namesIndexLink;  ///< Link to the index of the container of
+                                  ///< the object, invalidated by renames.
 
   /**
    * \brief Derived objects can redefine this method to load custom attributes.
@@ -16,6 +16,29 @@ ObjectsContainer::ObjectsContainer() {}
 
 ObjectsContainer::~ObjectsContainer() {}
 
+void ObjectsContainer::RebuildObjectsNamesIndex() {
+  objectsNamesIndex.Rebuild(
+      initialObjects,
+      [](const std::unique_ptr<gd::Object>& object) -> const gd::String& {
+        return object->GetName();
+      });
+  for (auto& object : initialObjects)
+    object->GetNamesIndexLink().Link(objectsNamesIndex);
+}
+
+void ObjectsContainer::AddToObjectsNamesIndex(std::size_t position) {
+  // The positions of the next objects change if the object is not the last
+  // one.
+  if (position + 1 != initialObjects.size()) {
+    RebuildObjectsNamesIndex();
+    return;
+  }
+
+  gd::Object& object = *initialObjects[position];
+  object.GetNamesIndexLink().Link(objectsNamesIndex);
+  objectsNamesIndex.Append(object.GetName(), position);
+}
+
 #if defined(GD_IDE_ONLY)
 void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
   element.ConsiderAsArrayOf("object");
@@ -28,6 +51,7 @@ void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
   initialObjects.clear();
+  objectsNamesIndex.Clear();
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& objectElement = element.GetChild(i);
@@ -39,6 +63,7 @@ void ObjectsContainer::UnserializeObjectsFrom(
     if (newObject) {
       newObject->UnserializeFrom(project, objectElement);
       initialObjects.push_back(std::move(newObject));
+      AddToObjectsNamesIndex(initialObjects.size() - 1);
     } else
       std::cout << "WARNING: Unknown object type \"" << type << "\""
                 << std::endl;
@@ -46,19 +71,13 @@ void ObjectsContainer::UnserializeObjectsFrom(
 }
 
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  bind2nd(gd::ObjectHasName(), name)) != initialObjects.end());
+  return GetObjectPosition(name) != gd::String::npos;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    bind2nd(gd::ObjectHasName(), name)));
+  return *initialObjects[GetObjectPosition(name)];
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    bind2nd(gd::ObjectHasName(), name)));
+  return *initialObjects[GetObjectPosition(name)];
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -67,10 +86,14 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  // Objects can be renamed without the container being notified: the index
+  // is rebuilt if needed.
+  return objectsNamesIndex.Find(
+      initialObjects,
+      name,
+      [](const std::unique_ptr<gd::Object>& object) -> const gd::String& {
+        return object->GetName();
+      });
 }
 std::size_t ObjectsContainer::GetObjectsCount() const {
   return initialObjects.size();
@@ -80,23 +103,25 @@ gd::Object& ObjectsContainer::InsertNewObject(gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
-  gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
+  auto it = initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
-      project.GetCurrentPlatform().CreateObject(objectType, name))));
+      project.GetCurrentPlatform().CreateObject(objectType, name));
+  AddToObjectsNamesIndex(it - initialObjects.begin());
 
-  return newlyCreatedObject;
+  return **it;
 }
 #endif
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
-  gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
+  auto it = initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
-      std::unique_ptr<gd::Object>(object.Clone()))));
+      std::unique_ptr<gd::Object>(object.Clone()));
+  AddToObjectsNamesIndex(it - initialObjects.begin());
 
-  return newlyCreatedObject;
+  return **it;
 }
 
 void ObjectsContainer::SwapObjects(std::size_t firstObjectIndex,
@@ -107,6 +132,7 @@ void ObjectsContainer::SwapObjects(std::size_t firstObjectIndex,
 
   std::iter_swap(initialObjects.begin() + firstObjectIndex,
                  initialObjects.begin() + secondObjectIndex);
+  RebuildObjectsNamesIndex();
 }
 
 void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
@@ -116,16 +142,15 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
+  RebuildObjectsNamesIndex();
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Object> >::iterator object =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              bind2nd(ObjectHasName(), name));
-  if (object == initialObjects.end()) return;
+  std::size_t position = GetObjectPosition(name);
+  if (position == gd::String::npos) return;
 
-  initialObjects.erase(object);
+  initialObjects.erase(initialObjects.begin() + position);
+  RebuildObjectsNamesIndex();
 }
 
 }  // namespace gd
@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class Object;
 class Project;
@@ -178,9 +179,24 @@ class GD_CORE_API ObjectsContainer {
   ///@}
 
  protected:
+  /**
+   * \brief Update the index of the objects names. Must be called after
+   * initialObjects is changed.
+   */
+  void RebuildObjectsNamesIndex();
+
+  /**
+   * \brief Update the index of the objects names after an object was inserted
+   * at \a position in initialObjects.
+   */
+  void AddToObjectsNamesIndex(std::size_t position);
+
   std::vector<std::unique_ptr<gd::Object> >
       initialObjects;  ///< Objects contained.
   gd::ObjectGroupsContainer objectGroups;
+
+ private:
+  NamesIndex objectsNamesIndex;  ///< Positions of the objects, by name.
 };
 
 }  // namespace gd
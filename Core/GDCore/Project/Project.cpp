@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <SFML/System/Utf.hpp>
 #include <fstream>
+#include <list>
 #include <map>
 #include <vector>
 #include "GDCore/CommonTools.h"
@@ -28,6 +29,7 @@
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Project/SourceFile.h"
+#include "GDCore/Serialization/JSONReader.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Serialization/Splitter.h"
@@ -211,28 +213,51 @@ bool Project::RemovePlatform(const gd::String& platformName) {
 }
 #endif
 
+void Project::RebuildLayoutsNamesIndex() {
+  layoutsNamesIndex.Rebuild(
+      scenes,
+      [](const std::unique_ptr<gd::Layout>& layout) -> const gd::String& {
+        return layout->GetName();
+      });
+  for (auto& layout : scenes)
+    layout->GetNamesIndexLink().Link(layoutsNamesIndex);
+}
+
+void Project::AddToLayoutsNamesIndex(std::size_t position) {
+  // The positions of the next layouts change if the layout is not the last
+  // one.
+  if (position + 1 != scenes.size()) {
+    RebuildLayoutsNamesIndex();
+    return;
+  }
+
+  gd::Layout& layout = *scenes[position];
+  layout.GetNamesIndexLink().Link(layoutsNamesIndex);
+  layoutsNamesIndex.Append(layout.GetName(), position);
+}
+
 bool Project::HasLayoutNamed(const gd::String& name) const {
-  return (find_if(scenes.begin(),
-                  scenes.end(),
-                  bind2nd(gd::LayoutHasName(), name)) != scenes.end());
+  return GetLayoutPosition(name) != gd::String::npos;
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  return *scenes[GetLayoutPosition(name)];
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  return *scenes[GetLayoutPosition(name)];
 }
 gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < scenes.size(); ++i) {
-    if (scenes[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  // Layouts can be renamed without the project being notified: the index is
+  // rebuilt if needed.
+  return layoutsNamesIndex.Find(
+      scenes,
+      name,
+      [](const std::unique_ptr<gd::Layout>& layout) -> const gd::String& {
+        return layout->GetName();
+      });
 }
 std::size_t Project::GetLayoutsCount() const { return scenes.size(); }
 
@@ -241,16 +266,19 @@ void Project::SwapLayouts(std::size_t first, std::size_t second) {
   if (first >= scenes.size() || second >= scenes.size()) return;
 
   std::iter_swap(scenes.begin() + first, scenes.begin() + second);
+  RebuildLayoutsNamesIndex();
 }
 #endif
 
 gd::Layout& Project::InsertNewLayout(const gd::String& name,
                                      std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
+  auto it = scenes.emplace(
       position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout())));
+      new Layout());
+  gd::Layout& newlyInsertedLayout = **it;
 
   newlyInsertedLayout.SetName(name);
+  AddToLayoutsNamesIndex(it - scenes.begin());
 #if defined(GD_IDE_ONLY)
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 #endif
@@ -260,9 +288,11 @@ gd::Layout& Project::InsertNewLayout(const gd::String& name,
 
 gd::Layout& Project::InsertLayout(const gd::Layout& layout,
                                   std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
+  auto it = scenes.emplace(
       position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout(layout))));
+      new Layout(layout));
+  gd::Layout& newlyInsertedLayout = **it;
+  AddToLayoutsNamesIndex(it - scenes.begin());
 
 #if defined(GD_IDE_ONLY)
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
@@ -272,11 +302,11 @@ gd::Layout& Project::InsertLayout(const gd::Layout& layout,
 }
 
 void Project::RemoveLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Layout> >::iterator scene =
-      find_if(scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name));
-  if (scene == scenes.end()) return;
+  std::size_t position = GetLayoutPosition(name);
+  if (position == gd::String::npos) return;
 
-  scenes.erase(scene);
+  scenes.erase(scenes.begin() + position);
+  RebuildLayoutsNamesIndex();
 }
 
 #if defined(GD_IDE_ONLY)
@@ -767,6 +797,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   scenes.clear();
+  layoutsNamesIndex.Clear();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -841,6 +872,46 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 #endif
 }
 
+void Project::UnserializeFrom(gd::JSONReader& reader) {
+  if (!reader.EnterObject()) {
+    SerializerElement element;
+    reader.ReadElement(element);
+    UnserializeFrom(element);
+    return;
+  }
+
+  // Everything is read into an element, except the instances of the layouts
+  // which are unserialized right away and given to the layouts once they
+  // are created.
+  SerializerElement element;
+  std::list<gd::InitialInstancesContainer> layoutsInstances;
+  gd::String name;
+  while (reader.NextMember(name)) {
+    if ((name == "layouts" || name == "Scenes") &&
+        reader.PeekValueType() == gd::JSONReader::Array) {
+      SerializerElement& layoutsElement = element.AddChild(name);
+      layoutsElement.ConsiderAsArray();
+
+      reader.EnterArray();
+      while (reader.NextElement()) {
+        layoutsInstances.emplace_back();
+        gd::Layout::ReadFromJSON(
+            reader, layoutsElement.AddChild(""), layoutsInstances.back());
+      }
+    } else {
+      reader.ReadElement(element.AddChild(name));
+    }
+  }
+
+  UnserializeFrom(element);
+
+  std::size_t i = 0;
+  for (auto& instances : layoutsInstances) {
+    if (i >= GetLayoutsCount()) break;
+    GetLayout(i++).GetInitialInstances().Swap(instances);
+  }
+}
+
 #if defined(GD_IDE_ONLY)
 void Project::SerializeTo(SerializerElement& element) const {
   SerializerElement& versionElement = element.AddChild("gdVersion");
@@ -1088,8 +1159,10 @@ void Project::Init(const gd::Project& game) {
   imageManager->SetResourcesManager(&resourcesManager);
 
   initialObjects = gd::Clone(game.initialObjects);
+  RebuildObjectsNamesIndex();
 
   scenes = gd::Clone(game.scenes);
+  RebuildLayoutsNamesIndex();
 
 #if defined(GD_IDE_ONLY)
   externalEvents = gd::Clone(game.externalEvents);
@@ -16,6 +16,7 @@
 #include "GDCore/Project/PlatformSpecificAssets.h"
 #include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class Platform;
 class Layout;
@@ -32,6 +33,7 @@ class Behavior;
 class BehaviorsSharedData;
 class BaseEvent;
 class SerializerElement;
+class JSONReader;
 }  // namespace gd
 #undef GetObject  // Disable an annoying macro
 #undef CreateEvent
@@ -473,6 +475,14 @@ class GD_CORE_API Project : public ObjectsContainer {
    */
   void UnserializeFrom(const SerializerElement& element);
 
+  /**
+   * \brief Unserialize the project, reading it from a JSON document.
+   *
+   * The instances of the layouts are unserialized while they are read, so that
+   * they are never all stored in a SerializerElement.
+   */
+  void UnserializeFrom(gd::JSONReader& reader);
+
 #if defined(GD_IDE_ONLY)
   /**
    * \brief Serialize the project.
@@ -915,6 +925,18 @@ class GD_CORE_API Project : public ObjectsContainer {
    */
   void Init(const gd::Project& project);
 
+  /**
+   * Update the index of the layouts names after layouts were inserted,
+   * removed or moved.
+   */
+  void RebuildLayoutsNamesIndex();
+
+  /**
+   * Update the index of the layouts names after a layout was inserted at \a
+   * position.
+   */
+  void AddToLayoutsNamesIndex(std::size_t position);
+
   gd::String name;            ///< Game name
   gd::String version;         ///< Game version number (used for some exports)
   unsigned int windowWidth;   ///< Window default width
@@ -928,6 +950,7 @@ class GD_CORE_API Project : public ObjectsContainer {
       sizeOnStartupMode;  ///< How to adapt the game size to the screen. Can be
                           ///< "adaptWidth", "adaptHeight" or empty
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
+  NamesIndex layoutsNamesIndex;  ///< Positions of the scenes, by name.
   gd::VariablesContainer variables;  ///< Initial global variables
   std::vector<std::unique_ptr<gd::ExternalLayout> >
       externalLayouts;  ///< List of all externals layouts
@@ -68,10 +68,8 @@ class GD_CORE_API ResourcesLoader {
   gd::String LoadPlainText(const gd::String &filename);
 
   /**
-   * Get a buffer for file.
-   * Be careful, the buffer will be invalided by any subsequent call to
-   * Load[Something]. Make a copy of the buffer if you want it to stay alive
-   * longer.
+   * Get a buffer for file, or NULL if the file can't be read.
+   * The caller owns the buffer, and must free it with delete[].
    */
   char *LoadBinaryFile(const gd::String &filename);
 
@@ -37,10 +37,11 @@ void ResourceFolder::Init(const ResourceFolder& other) {
 #endif
 
 void ResourcesManager::Init(const ResourcesManager& other) {
-  resources.clear();
+  ClearResources();
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
+  RebuildResourcesNamesIndex();
 #if defined(GD_IDE_ONLY)
   folders.clear();
   for (std::size_t i = 0; i < other.folders.size(); ++i) {
@@ -49,18 +50,50 @@ void ResourcesManager::Init(const ResourcesManager& other) {
 #endif
 }
 
+void ResourcesManager::RebuildResourcesNamesIndex() {
+  resourcesNamesIndex.Rebuild(
+      resources,
+      [](const std::shared_ptr<Resource>& resource) -> const gd::String& {
+        return resource->GetName();
+      });
+  for (auto& resource : resources)
+    resource->GetNamesIndexLink().Link(resourcesNamesIndex);
+}
+
+void ResourcesManager::AddLastResourceToNamesIndex() {
+  Resource& resource = *resources.back();
+  resource.GetNamesIndexLink().Link(resourcesNamesIndex);
+  resourcesNamesIndex.Append(resource.GetName(), resources.size() - 1);
+}
+
+void ResourcesManager::ClearResources() {
+  for (auto& resource : resources)
+    resource->GetNamesIndexLink().Unlink(resourcesNamesIndex);
+  resources.clear();
+  resourcesNamesIndex.Clear();
+}
+
+std::size_t ResourcesManager::FindResource(const gd::String& name) const {
+  // Resources can be renamed without the manager being notified: the index is
+  // rebuilt if needed.
+  return resourcesNamesIndex.Find(
+      resources,
+      name,
+      [](const std::shared_ptr<Resource>& resource) -> const gd::String& {
+        return resource->GetName();
+      });
+}
+
 Resource& ResourcesManager::GetResource(const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = FindResource(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
 
 const Resource& ResourcesManager::GetResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = FindResource(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
@@ -81,11 +114,7 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return FindResource(name) != gd::String::npos;
 }
 
 std::vector<gd::String> ResourcesManager::GetAllResourceNames() const {
@@ -135,6 +164,7 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
   if (newResource == std::shared_ptr<Resource>()) return false;
 
   resources.push_back(newResource);
+  AddLastResourceToNamesIndex();
   return true;
 }
 
@@ -148,6 +178,7 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetName(name);
 
   resources.push_back(res);
+  AddLastResourceToNamesIndex();
 
   return true;
 }
@@ -224,19 +255,22 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
-  return gd::MoveResourceUpInList(resources, name);
+  if (!gd::MoveResourceUpInList(resources, name)) return false;
+
+  RebuildResourcesNamesIndex();
+  return true;
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
-  return gd::MoveResourceDownInList(resources, name);
+  if (!gd::MoveResourceDownInList(resources, name)) return false;
+
+  RebuildResourcesNamesIndex();
+  return true;
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return FindResource(name);
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -246,6 +280,7 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  RebuildResourcesNamesIndex();
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -272,9 +307,8 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
+  std::size_t position = FindResource(name);
+  if (position != gd::String::npos) return resources[position];
 
   return std::shared_ptr<gd::Resource>();
 }
@@ -347,6 +381,7 @@ void ResourcesManager::RenameResource(const gd::String& oldName,
   for (std::size_t i = 0; i < resources.size(); ++i) {
     if (resources[i]->GetName() == oldName) resources[i]->SetName(newName);
   }
+  RebuildResourcesNamesIndex();
 }
 
 void ResourceFolder::RemoveResource(const gd::String& name) {
@@ -362,11 +397,14 @@ void ResourceFolder::RemoveResource(const gd::String& name) {
 void ResourcesManager::RemoveResource(const gd::String& name) {
   for (std::size_t i = 0; i < resources.size();) {
     if (resources[i] != std::shared_ptr<Resource>() &&
-        resources[i]->GetName() == name)
+        resources[i]->GetName() == name) {
+      // The resource can still be used, by a folder for example.
+      resources[i]->GetNamesIndexLink().Unlink(resourcesNamesIndex);
       resources.erase(resources.begin() + i);
-    else
+    } else
       ++i;
   }
+  RebuildResourcesNamesIndex();
 
   for (std::size_t i = 0; i < folders.size(); ++i)
     folders[i].RemoveResource(name);
@@ -401,7 +439,7 @@ void ResourceFolder::SerializeTo(SerializerElement& element) const {
 #endif
 
 void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
-  resources.clear();
+  ClearResources();
   const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
@@ -417,6 +455,7 @@ void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
     resource->UnserializeFrom(resourceElement);
 
     resources.push_back(resource);
+    AddLastResourceToNamesIndex();
   }
 
 #if defined(GD_IDE_ONLY)
@@ -572,8 +611,6 @@ ResourcesManager::ResourcesManager() {
   // ctor
 }
 
-ResourcesManager::~ResourcesManager() {
-  // dtor
-}
+ResourcesManager::~ResourcesManager() { ClearResources(); }
 
 }  // namespace gd
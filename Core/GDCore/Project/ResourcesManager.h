@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class Project;
 class ResourceFolder;
@@ -30,12 +31,22 @@ class GD_CORE_API Resource {
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String& name_) { name = name_; }
+  virtual void SetName(const gd::String& name_) {
+    if (name_ == name) return;
+    name = name_;
+    namesIndexLink.NotifyRenamed();
+  }
 
   /** \brief Return the name of the resource.
    */
   virtual const gd::String& GetName() const { return name; }
 
+  /**
+   * \brief Return the link to the index of the manager storing the resource.
+   * \note Used by gd::ResourcesManager.
+   */
+  NamesIndexLink& GetNamesIndexLink() { return namesIndexLink; }
+
   /** \brief Change the kind of the resource
    */
   virtual void SetKind(const gd::String& newKind) { kind = newKind; }
@@ -142,6 +153,8 @@ class GD_CORE_API Resource {
   gd::String metadata;
   bool userAdded;  ///< True if the resource was added by the user, and not
                    ///< automatically by GDevelop.
+  NamesIndexLink namesIndexLink;  ///< Link to the index of the manager of the
+                                  ///< resource, invalidated by renames.
 
   static gd::String badStr;
 };
@@ -432,7 +445,31 @@ class GD_CORE_API ResourcesManager {
  private:
   void Init(const ResourcesManager& other);
 
+  /**
+   * \brief Return the position of the resource with the specified name, or
+   * gd::String::npos.
+   */
+  std::size_t FindResource(const gd::String& name) const;
+
+  /**
+   * \brief Update the index of the resources names after resources were
+   * removed, moved or renamed.
+   */
+  void RebuildResourcesNamesIndex();
+
+  /**
+   * \brief Add to the index of the resources names the last resource.
+   */
+  void AddLastResourceToNamesIndex();
+
+  /**
+   * \brief Remove all the resources, which are unlinked from the index of the
+   * resources names as they can be shared.
+   */
+  void ClearResources();
+
   std::vector<std::shared_ptr<Resource> > resources;
+  NamesIndex resourcesNamesIndex;  ///< Positions of the resources, by name.
 #if defined(GD_IDE_ONLY)
   std::vector<ResourceFolder> folders;
 #endif
@@ -5,6 +5,11 @@
  */
 
 #include "GDCore/Project/Variable.h"
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <sstream>
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
@@ -18,29 +23,136 @@ namespace gd {
  * Get value as a double
  */
 double Variable::GetValue() const {
-  if (!isNumber) {
-    stringstream ss;
-    ss << str;
-    ss >> value;
-    isNumber = true;
+  if (!valueUpToDate) {
+    value = StringToNumber(str);
+    valueUpToDate = true;
   }
 
+  isNumber = true;
   return value;
 }
 
 const gd::String& Variable::GetString() const {
-  if (isNumber) {
-    stringstream s;
-    s << (value);
-    str = s.str();
-    isNumber = false;
+  if (!strUpToDate) {
+    str = NumberToString(value);
+    strUpToDate = true;
   }
 
+  isNumber = false;
   return str;
 }
 
+gd::String Variable::NumberToString(double number) {
+  char buffer[32];
+
+  // Integers are the most common numbers: write their digits directly.
+  // Bigger numbers are written with an exponent by std::ostream.
+  if (number > -1e6 && number < 1e6 &&
+      number == static_cast<long>(number) &&
+      (number != 0 || !std::signbit(number))) {
+    long integer = static_cast<long>(number);
+    unsigned long digits = integer < 0 ? -integer : integer;
+
+    char* start = buffer + sizeof(buffer) - 1;
+    *start = '\0';
+    do {
+      *--start = '0' + digits % 10;
+      digits /= 10;
+    } while (digits != 0);
+    if (integer < 0) *--start = '-';
+
+    return gd::String(start);
+  }
+
+  // Same format as std::ostream default one, but with a dot as the decimal
+  // point whatever the current C locale is.
+  std::snprintf(buffer, sizeof(buffer), "%.6g", number);
+  std::string result(buffer);
+  std::string decimalPoint = std::localeconv()->decimal_point;
+  if (decimalPoint != ".") {
+    std::size_t pointPosition = result.find(decimalPoint);
+    if (pointPosition != std::string::npos)
+      result.replace(pointPosition, decimalPoint.size(), ".");
+  }
+
+  return gd::String(result.c_str());
+}
+
+double Variable::StringToNumber(const gd::String& str) {
+  // Exact powers of ten, representable by a double.
+  static const double powersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  // Fast path for numbers made only of (at most 15) digits and an optional
+  // decimal point: the digits are exactly represented by a double, and a
+  // single division by an exact power of ten is correctly rounded.
+  const std::string& raw = str.Raw();
+  std::size_t i = 0;
+  while (i < raw.size() &&
+         (raw[i] == ' ' || (raw[i] >= '\t' && raw[i] <= '\r')))
+    ++i;
+
+  bool negative = i < raw.size() && raw[i] == '-';
+  if (i < raw.size() && (raw[i] == '-' || raw[i] == '+')) ++i;
+
+  std::uint64_t digits = 0;
+  std::size_t digitsCount = 0;
+  std::size_t fractionDigitsCount = 0;
+  bool hasDecimalPoint = false;
+  bool simpleNumber = i < raw.size();
+  for (; i < raw.size() && simpleNumber; ++i) {
+    char c = raw[i];
+    if (c >= '0' && c <= '9') {
+      digits = digits * 10 + (c - '0');
+      ++digitsCount;
+      if (hasDecimalPoint) ++fractionDigitsCount;
+    } else if (c == '.' && !hasDecimalPoint) {
+      hasDecimalPoint = true;
+    } else {
+      simpleNumber = false;
+    }
+  }
+
+  if (simpleNumber && digitsCount > 0 && digitsCount <= 15) {
+    double number =
+        static_cast<double>(digits) / powersOfTen[fractionDigitsCount];
+    return negative ? -number : number;
+  }
+
+  // Other numbers (exponents, invalid or long numbers...) are parsed by a
+  // stream, which returns 0 when the string is not a number.
+  std::istringstream stream(raw);
+  stream.imbue(std::locale::classic());
+  double number = 0;
+  stream >> number;
+  return number;
+}
+
+Variable::ChildrenList::iterator Variable::FindChild(
+    const gd::String& name) const {
+  return std::lower_bound(
+      children.begin(),
+      children.end(),
+      name,
+      [](const ChildrenList::value_type& child, const gd::String& name) {
+        return child.first < name;
+      });
+}
+
+Variable& Variable::GetOrCreateChild(const gd::String& name) const {
+  auto it = FindChild(name);
+  if (it != children.end() && it->first == name) return *it->second;
+
+  isStructure = true;
+  return *children.emplace(it, name, std::make_shared<gd::Variable>())->second;
+}
+
 bool Variable::HasChild(const gd::String& name) const {
-  return isStructure && children.find(name) != children.end();
+  if (!isStructure) return false;
+
+  auto it = FindChild(name);
+  return it != children.end() && it->first == name;
 }
 
 /**
@@ -50,12 +162,7 @@ bool Variable::HasChild(const gd::String& name) const {
  * the specified child, an empty variable is returned.
  */
 Variable& Variable::GetChild(const gd::String& name) {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
-
-  isStructure = true;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return GetOrCreateChild(name);
 }
 
 /**
@@ -65,25 +172,24 @@ Variable& Variable::GetChild(const gd::String& name) {
  * the specified child, an empty variable is returned.
  */
 const Variable& Variable::GetChild(const gd::String& name) const {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
-
-  isStructure = true;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return GetOrCreateChild(name);
 }
 
 void Variable::RemoveChild(const gd::String& name) {
   if (!isStructure) return;
-  children.erase(name);
+
+  auto it = FindChild(name);
+  if (it != children.end() && it->first == name) children.erase(it);
 }
 
 bool Variable::RenameChild(const gd::String& oldName,
                            const gd::String& newName) {
   if (!isStructure || !HasChild(oldName) || HasChild(newName)) return false;
 
-  children[newName] = children[oldName];
-  children.erase(oldName);
+  auto oldIt = FindChild(oldName);
+  std::shared_ptr<Variable> child = oldIt->second;
+  children.erase(oldIt);
+  children.emplace(FindChild(newName), newName, child);
 
   return true;
 }
@@ -117,8 +223,9 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
     for (int i = 0; i < childrenElement.GetChildrenCount(); ++i) {
       const SerializerElement& childElement = childrenElement.GetChild(i);
       gd::String name = childElement.GetStringAttribute("name", "", "Name");
-      children[name] = std::make_shared<gd::Variable>();
-      children[name]->UnserializeFrom(childElement);
+      Variable& child = GetOrCreateChild(name);
+      child = Variable();
+      child.UnserializeFrom(childElement);
     }
   } else
     SetString(element.GetStringAttribute("value", "", "Value"));
@@ -153,8 +260,9 @@ void Variable::LoadFromXml(const TiXmlElement* element) {
     while (child) {
       gd::String name =
           child->Attribute("Name") ? child->Attribute("Name") : "";
-      children[name] = std::make_shared<gd::Variable>();
-      children[name]->LoadFromXml(child);
+      Variable& childVariable = GetOrCreateChild(name);
+      childVariable = Variable();
+      childVariable.LoadFromXml(child);
 
       child = child->NextSiblingElement();
     }
@@ -196,7 +304,9 @@ Variable::Variable(const Variable& other)
     : value(other.value),
       str(other.str),
       isNumber(other.isNumber),
-      isStructure(other.isStructure) {
+      isStructure(other.isStructure),
+      valueUpToDate(other.valueUpToDate),
+      strUpToDate(other.strUpToDate) {
   CopyChildren(other);
 }
 
@@ -206,6 +316,8 @@ Variable& Variable::operator=(const Variable& other) {
     str = other.str;
     isNumber = other.isNumber;
     isStructure = other.isStructure;
+    valueUpToDate = other.valueUpToDate;
+    strUpToDate = other.strUpToDate;
     CopyChildren(other);
   }
 
@@ -214,8 +326,9 @@ Variable& Variable::operator=(const Variable& other) {
 
 void Variable::CopyChildren(const gd::Variable& other) {
   children.clear();
+  children.reserve(other.children.size());
   for (auto& it : other.children) {
-    children[it.first] = std::make_shared<gd::Variable>(*it.second);
+    children.emplace_back(it.first, std::make_shared<gd::Variable>(*it.second));
   }
 }
 }  // namespace gd
@@ -6,8 +6,9 @@
 
 #ifndef GDCORE_VARIABLE_H
 #define GDCORE_VARIABLE_H
-#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 #include "GDCore/String.h"
 namespace gd {
 class SerializerElement;
@@ -26,10 +27,21 @@ namespace gd {
  */
 class GD_CORE_API Variable {
  public:
+  /**
+   * \brief The children of a structure, sorted by their names.
+   */
+  typedef std::vector<std::pair<gd::String, std::shared_ptr<Variable>>>
+      ChildrenList;
+
   /**
    * \brief Default constructor creating a variable with 0 as value.
    */
-  Variable() : value(0), isNumber(true), isStructure(false){};
+  Variable()
+      : value(0),
+        isNumber(true),
+        isStructure(false),
+        valueUpToDate(true),
+        strUpToDate(false){};
   Variable(const Variable&);
   virtual ~Variable(){};
 
@@ -53,6 +65,8 @@ class GD_CORE_API Variable {
     str = newStr;
     isNumber = false;
     isStructure = false;
+    strUpToDate = true;
+    valueUpToDate = false;
   }
 
   /**
@@ -67,6 +81,8 @@ class GD_CORE_API Variable {
     value = val;
     isNumber = true;
     isStructure = false;
+    valueUpToDate = true;
+    strUpToDate = false;
   }
 
   // Operators are overloaded to allow accessing to variable using a simple
@@ -165,12 +181,9 @@ class GD_CORE_API Variable {
   std::vector<gd::String> GetAllChildrenNames() const;
 
   /**
-   * \brief Get the map containing all the children.
+   * \brief Get all the children, sorted by their names.
    */
-  const std::map<gd::String, std::shared_ptr<Variable>>& GetAllChildren()
-      const {
-    return children;
-  }
+  const ChildrenList& GetAllChildren() const { return children; }
 
   /**
    * \brief Search if a variable is part of the children, optionally recursively
@@ -208,14 +221,47 @@ class GD_CORE_API Variable {
   void UnserializeFrom(const SerializerElement& element);
   ///@}
 
+  /** \name Number conversions
+   * Conversions used between the number and the string representations of
+   * variables. They do not depend on the current locale.
+   */
+  ///@{
+  /**
+   * \brief Convert a number to a string, as a std::ostream using the classic
+   * locale would do.
+   */
+  static gd::String NumberToString(double number);
+
+  /**
+   * \brief Convert a string to a number, as a std::istream using the classic
+   * locale would do (0 is returned if the string is not a number).
+   */
+  static double StringToNumber(const gd::String& str);
+  ///@}
+
  private:
+  /**
+   * \brief Return an iterator to the child with the specified name, or to the
+   * position where it would be inserted.
+   */
+  ChildrenList::iterator FindChild(const gd::String& name) const;
+
+  /**
+   * \brief Return the child with the specified name, adding it if necessary.
+   */
+  Variable& GetOrCreateChild(const gd::String& name) const;
+
   mutable double value;
   mutable gd::String str;
   mutable bool isNumber;     ///< True if the type of the variable is a number.
   mutable bool isStructure;  ///< False when the variable is a primitive ( i.e:
                              ///< Number or String ), true when it is a
                              ///< structure and has may have children.
-  mutable std::map<gd::String, std::shared_ptr<Variable>>
+  mutable bool valueUpToDate;  ///< True if value represents the content.
+  mutable bool strUpToDate;    ///< True if str represents the content. Both
+                               ///< value and str can be up to date, so that
+                               ///< switching between them is free.
+  mutable ChildrenList
       children;  ///< Children, when the variable is considered as a structure.
 
   /**
@@ -34,24 +34,27 @@ class VariableHasName {
 
 VariablesContainer::VariablesContainer() {}
 
+void VariablesContainer::RebuildNamesIndex() {
+  namesIndex.Rebuild(
+      variables,
+      [](const std::pair<gd::String, std::shared_ptr<gd::Variable>>&
+             nameAndVariable) { return nameAndVariable.first; });
+}
+
 bool VariablesContainer::Has(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  return (i != variables.end());
+  return namesIndex.Find(name) != gd::String::npos;
 }
 
 Variable& VariablesContainer::Get(const gd::String& name) {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = namesIndex.Find(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
 
 const Variable& VariablesContainer::Get(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = namesIndex.Find(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
@@ -81,9 +84,11 @@ Variable& VariablesContainer::Insert(const gd::String& name,
   if (position < variables.size()) {
     variables.insert(variables.begin() + position,
                      std::make_pair(name, newVariable));
+    RebuildNamesIndex();
     return *variables[position].second;
   } else {
     variables.push_back(std::make_pair(name, newVariable));
+    namesIndex.Append(name, variables.size() - 1);
     return *variables.back().second;
   }
 }
@@ -94,6 +99,7 @@ void VariablesContainer::Remove(const gd::String& varName) {
       std::remove_if(
           variables.begin(), variables.end(), VariableHasName(varName)),
       variables.end());
+  RebuildNamesIndex();
 }
 
 void VariablesContainer::RemoveRecursively(
@@ -108,6 +114,7 @@ void VariablesContainer::RemoveRecursively(
             return &variableToRemove == nameAndVariable.second.get();
           }),
       variables.end());
+  RebuildNamesIndex();
 
   for (auto& it : variables) {
     it.second->RemoveRecursively(variableToRemove);
@@ -115,11 +122,7 @@ void VariablesContainer::RemoveRecursively(
 }
 
 std::size_t VariablesContainer::GetPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < variables.size(); ++i) {
-    if (variables[i].first == name) return i;
-  }
-
-  return gd::String::npos;
+  return namesIndex.Find(name);
 }
 
 Variable& VariablesContainer::InsertNew(const gd::String& name,
@@ -132,9 +135,11 @@ bool VariablesContainer::Rename(const gd::String& oldName,
                                 const gd::String& newName) {
   if (Has(newName)) return false;
 
-  auto i = std::find_if(
-      variables.begin(), variables.end(), VariableHasName(oldName));
-  if (i != variables.end()) i->first = newName;
+  std::size_t position = namesIndex.Find(oldName);
+  if (position != gd::String::npos) {
+    variables[position].first = newName;
+    RebuildNamesIndex();
+  }
 
   return true;
 }
@@ -148,6 +153,7 @@ void VariablesContainer::Swap(std::size_t firstVariableIndex,
   auto temp = variables[firstVariableIndex];
   variables[firstVariableIndex] = variables[secondVariableIndex];
   variables[secondVariableIndex] = temp;
+  RebuildNamesIndex();
 }
 
 void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
@@ -156,6 +162,7 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   auto nameAndVariable = variables[oldIndex];
   variables.erase(variables.begin() + oldIndex);
   variables.insert(variables.begin() + newIndex, nameAndVariable);
+  RebuildNamesIndex();
 }
 #endif
 
@@ -198,5 +205,6 @@ void VariablesContainer::Init(const gd::VariablesContainer& other) {
     variables.push_back(
         std::make_pair(it.first, std::make_shared<gd::Variable>(*it.second)));
   }
+  RebuildNamesIndex();
 }
 }  // namespace gd
@@ -10,6 +10,7 @@
 #include <vector>
 #include "GDCore/Project/Variable.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamesIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -136,7 +137,10 @@ class GD_CORE_API VariablesContainer {
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { variables.clear(); }
+  inline void Clear() {
+    variables.clear();
+    namesIndex.Clear();
+  }
   ///@}
 
   /** \name Saving and loading
@@ -156,6 +160,7 @@ class GD_CORE_API VariablesContainer {
 
  private:
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
+  NamesIndex namesIndex;  ///< Positions of the variables, by name.
   static gd::Variable badVariable;
   static gd::String badName;
 
@@ -164,6 +169,11 @@ class GD_CORE_API VariablesContainer {
    * copy-ctor and assign-op. Don't forget to update me if members were changed!
    */
   void Init(const VariablesContainer& other);
+
+  /**
+   * Update the index after variables were inserted, removed, moved or renamed.
+   */
+  void RebuildNamesIndex();
 };
 
 }  // namespace gd
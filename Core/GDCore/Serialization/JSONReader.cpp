@@ -0,0 +1,370 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#include "GDCore/Serialization/JSONReader.h"
+#include <iostream>
+#include <locale>
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+const std::size_t bufferCapacity = 64 * 1024;
+
+bool IsBlank(int c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+/**
+ * Return true for the characters ending a number or a literal.
+ */
+bool IsLiteralEnd(int c) {
+  return c == -1 || IsBlank(c) || c == ',' || c == '}' || c == ']' ||
+         c == ':' || c == '"';
+}
+
+int HexDigitValue(int c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+void AppendUTF8(std::string& str, unsigned int codePoint) {
+  if (codePoint < 0x80) {
+    str.push_back(static_cast<char>(codePoint));
+  } else if (codePoint < 0x800) {
+    str.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+    str.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else if (codePoint < 0x10000) {
+    str.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+    str.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else {
+    str.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+    str.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  }
+}
+}  // namespace
+
+JSONReader::JSONReader(std::istream& input_)
+    : input(input_),
+      buffer(bufferCapacity),
+      bufferPos(0),
+      bufferSize(0),
+      error(false) {
+  numberStream.imbue(std::locale::classic());
+}
+
+bool JSONReader::FillBuffer() {
+  if (error || !input) return false;
+
+  input.read(buffer.data(), buffer.size());
+  bufferSize = static_cast<std::size_t>(input.gcount());
+  bufferPos = 0;
+  return bufferSize > 0;
+}
+
+int JSONReader::SkipBlanks() {
+  int c = Peek();
+  while (IsBlank(c)) {
+    bufferPos++;
+    c = Peek();
+  }
+
+  return c;
+}
+
+bool JSONReader::Expect(char expected) {
+  if (SkipBlanks() != expected) {
+    Fail((std::string("expected '") + expected + "'").c_str());
+    return false;
+  }
+
+  Get();
+  return true;
+}
+
+void JSONReader::Fail(const char* message) {
+  if (!error)
+    std::cout << "Parsing error: " << message << "." << std::endl;
+
+  error = true;
+  bufferPos = bufferSize;  // Nothing more will be read.
+}
+
+JSONReader::ValueType JSONReader::PeekValueType() {
+  int c = SkipBlanks();
+  if (c == '{') return Object;
+  if (c == '[') return Array;
+  if (c == '"') return String;
+  if (c == 't' || c == 'f') return Boolean;
+  if (c == 'n') return Null;
+  if (c == '-' || (c >= '0' && c <= '9')) return Number;
+
+  return Invalid;
+}
+
+bool JSONReader::EnterObject() {
+  if (error || SkipBlanks() != '{') return false;
+
+  Get();
+  return true;
+}
+
+bool JSONReader::NextMember(gd::String& name) {
+  if (error) return false;
+
+  int c = SkipBlanks();
+  if (c == ',') {
+    Get();
+    c = SkipBlanks();
+  }
+  if (c == '}') {
+    Get();
+    return false;
+  }
+  if (c != '"') {
+    Fail("object not properly formed");
+    return false;
+  }
+
+  ReadRawString(rawString);
+  name = gd::String::FromUTF8(rawString).ReplaceInvalid();
+  return Expect(':');
+}
+
+bool JSONReader::EnterArray() {
+  if (error || SkipBlanks() != '[') return false;
+
+  Get();
+  return true;
+}
+
+bool JSONReader::NextElement() {
+  if (error) return false;
+
+  int c = SkipBlanks();
+  if (c == ',') {
+    Get();
+    c = SkipBlanks();
+  }
+  if (c == ']') {
+    Get();
+    return false;
+  }
+  if (c == -1) {
+    Fail("array not properly ended");
+    return false;
+  }
+
+  return true;
+}
+
+gd::String JSONReader::ReadString() {
+  if (PeekValueType() != String) {
+    SkipValue();
+    return "";
+  }
+
+  ReadRawString(rawString);
+  return gd::String::FromUTF8(rawString).ReplaceInvalid();
+}
+
+double JSONReader::ReadNumber() {
+  SkipBlanks();
+  ReadRawLiteral(rawString);
+  return ConvertToNumber(rawString);
+}
+
+double JSONReader::ConvertToNumber(const std::string& literal) {
+  double value = 0;
+  numberStream.clear();
+  numberStream.str(literal);
+  numberStream >> value;
+  return value;
+}
+
+bool JSONReader::ReadBool() {
+  SkipBlanks();
+  ReadRawLiteral(rawString);
+  return rawString == "true";
+}
+
+void JSONReader::ReadElement(SerializerElement& element) {
+  gd::String name;
+  switch (PeekValueType()) {
+    case Object:
+      EnterObject();
+      while (NextMember(name)) ReadElement(element.AddChild(name));
+      break;
+    case Array:
+      element.ConsiderAsArray();
+      EnterArray();
+      while (NextElement()) ReadElement(element.AddChild(""));
+      break;
+    case String:
+      element.SetValue(ReadString());
+      break;
+    case Boolean:
+    case Number:
+    case Null:
+      // Literals are handled as Serializer::FromJSON does.
+      ReadRawLiteral(rawString);
+      if (rawString == "true")
+        element.SetValue(true);
+      else if (rawString == "false")
+        element.SetValue(false);
+      else
+        element.SetValue(ConvertToNumber(rawString));
+      break;
+    case Invalid:
+      Fail("unexpected character or end of document");
+      break;
+  }
+}
+
+void JSONReader::SkipValue() {
+  gd::String name;
+  switch (PeekValueType()) {
+    case Object:
+      EnterObject();
+      while (NextMember(name)) SkipValue();
+      break;
+    case Array:
+      EnterArray();
+      while (NextElement()) SkipValue();
+      break;
+    case String:
+      ReadRawString(rawString);
+      break;
+    case Boolean:
+    case Number:
+    case Null:
+      ReadRawLiteral(rawString);
+      break;
+    case Invalid:
+      Fail("unexpected character or end of document");
+      break;
+  }
+}
+
+void JSONReader::ReadRawString(std::string& str) {
+  str.clear();
+  Get();  // The opening quote.
+
+  while (true) {
+    int c = Get();
+    if (c == -1) {
+      Fail("invalid string");
+      return;
+    }
+    if (c == '"') return;
+
+    if (c != '\\') {
+      str.push_back(static_cast<char>(c));
+      continue;
+    }
+
+    ReadEscapedCharacter(str);
+  }
+}
+
+void JSONReader::ReadEscapedCharacter(std::string& str) {
+  int c = Get();
+  switch (c) {
+    case '"':
+    case '\\':
+    case '/':
+      str.push_back(static_cast<char>(c));
+      break;
+    case 'b':
+      str.push_back('\b');
+      break;
+    case 'f':
+      str.push_back('\f');
+      break;
+    case 'n':
+      str.push_back('\n');
+      break;
+    case 'r':
+      str.push_back('\r');
+      break;
+    case 't':
+      str.push_back('\t');
+      break;
+    case 'u':
+      ReadCodePoint(str);
+      break;
+    case -1:
+      Fail("invalid string");
+      break;
+    default:
+      str.push_back('\\');
+      str.push_back(static_cast<char>(c));
+      break;
+  }
+}
+
+void JSONReader::ReadCodePoint(std::string& str) {
+  auto readHex = [this]() {
+    int codeUnit = 0;
+    for (int i = 0; i < 4; ++i) {
+      int digit = HexDigitValue(Peek());
+      if (digit == -1) return -1;
+      Get();
+      codeUnit = codeUnit * 16 + digit;
+    }
+    return codeUnit;
+  };
+
+  const unsigned int replacementCharacter = 0xFFFD;
+  int codeUnit = readHex();
+  while (true) {
+    if (codeUnit == -1) {
+      AppendUTF8(str, replacementCharacter);
+      return;
+    }
+    if (codeUnit < 0xD800 || codeUnit > 0xDFFF) {
+      AppendUTF8(str, codeUnit);
+      return;
+    }
+
+    // Characters outside the BMP are written as a surrogates pair: anything
+    // else than a high surrogate followed by a low one is replaced.
+    if (codeUnit >= 0xDC00 || Peek() != '\\') {
+      AppendUTF8(str, replacementCharacter);
+      return;
+    }
+    Get();
+    if (Peek() != 'u') {
+      // Not a pair: read the escaped character as usual.
+      AppendUTF8(str, replacementCharacter);
+      ReadEscapedCharacter(str);
+      return;
+    }
+    Get();
+
+    int lowCodeUnit = readHex();
+    if (lowCodeUnit >= 0xDC00 && lowCodeUnit <= 0xDFFF) {
+      AppendUTF8(str,
+                 0x10000 + ((codeUnit - 0xD800) << 10) + (lowCodeUnit - 0xDC00));
+      return;
+    }
+
+    // Not a pair: the code unit read after the high surrogate is handled on
+    // its own (it can be the start of another pair).
+    AppendUTF8(str, replacementCharacter);
+    codeUnit = lowCodeUnit;
+  }
+}
+
+void JSONReader::ReadRawLiteral(std::string& literal) {
+  literal.clear();
+  while (!IsLiteralEnd(Peek())) literal.push_back(static_cast<char>(Get()));
+}
+
+}  // namespace gd
@@ -0,0 +1,175 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_JSONREADER_H
+#define GDCORE_JSONREADER_H
+#include <istream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "GDCore/String.h"
+namespace gd {
+class SerializerElement;
+}
+
+namespace gd {
+
+/**
+ * \brief Read a JSON document from a stream, value by value, without storing
+ * the whole document in memory.
+ *
+ * Classes can consume the document directly, and read only the parts that they
+ * want to handle themselves into a SerializerElement.
+ *
+ * Usage example:
+ \code
+    std::ifstream file("game.json");
+    gd::JSONReader reader(file);
+
+    if (reader.EnterObject()) {
+      gd::String name;
+      while (reader.NextMember(name)) {
+        if (name == "instances")
+          instances.UnserializeFrom(reader);
+        else
+          reader.SkipValue();
+      }
+    }
+ \endcode
+ *
+ * \see gd::Serializer::FromJSON
+ */
+class GD_CORE_API JSONReader {
+ public:
+  /**
+   * \brief The type of a JSON value.
+   */
+  enum ValueType { Object, Array, String, Number, Boolean, Null, Invalid };
+
+  /**
+   * \brief Create a reader for the JSON document contained in the stream.
+   * \note The stream must outlive the reader.
+   */
+  JSONReader(std::istream& input);
+  virtual ~JSONReader(){};
+
+  /**
+   * \brief Return the type of the next value, without reading it.
+   */
+  ValueType PeekValueType();
+
+  /** \name Objects and arrays
+   * Members functions used to walk through objects and arrays.
+   */
+  ///@{
+  /**
+   * \brief Start reading an object.
+   * \return false if the next value is not an object.
+   */
+  bool EnterObject();
+
+  /**
+   * \brief Read the name of the next member of the object being read. The
+   * value of the member must then be read (or skipped).
+   * \return false when the end of the object is reached.
+   */
+  bool NextMember(gd::String& name);
+
+  /**
+   * \brief Start reading an array.
+   * \return false if the next value is not an array.
+   */
+  bool EnterArray();
+
+  /**
+   * \brief Go to the next element of the array being read. The element must
+   * then be read (or skipped).
+   * \return false when the end of the array is reached.
+   */
+  bool NextElement();
+  ///@}
+
+  /** \name Values
+   * Members functions used to read values.
+   */
+  ///@{
+  /**
+   * \brief Read a string.
+   */
+  gd::String ReadString();
+
+  /**
+   * \brief Read a number.
+   */
+  double ReadNumber();
+
+  /**
+   * \brief Read a boolean.
+   */
+  bool ReadBool();
+
+  /**
+   * \brief Read the next value, with all its content, into an element.
+   *
+   * The element is filled in the same way as gd::Serializer::FromJSON does.
+   */
+  void ReadElement(SerializerElement& element);
+
+  /**
+   * \brief Skip the next value, with all its content.
+   */
+  void SkipValue();
+  ///@}
+
+  /**
+   * \brief Return true if the document is not valid JSON. Reading stops at the
+   * first error.
+   */
+  bool HasError() const { return error; }
+
+ private:
+  /**
+   * \brief Return the next character, without consuming it, or -1 at the end
+   * of the document.
+   */
+  int Peek() {
+    if (bufferPos == bufferSize && !FillBuffer()) return -1;
+    return static_cast<unsigned char>(buffer[bufferPos]);
+  }
+
+  /**
+   * \brief Consume and return the next character, or -1 at the end of the
+   * document.
+   */
+  int Get() {
+    int c = Peek();
+    if (c != -1) bufferPos++;
+    return c;
+  }
+
+  bool FillBuffer();
+  int SkipBlanks();
+  bool Expect(char c);
+  void Fail(const char* message);
+  void ReadRawString(std::string& str);
+  void ReadEscapedCharacter(std::string& str);
+  void ReadRawLiteral(std::string& literal);
+  void ReadCodePoint(std::string& str);
+  double ConvertToNumber(const std::string& literal);
+
+  std::istream& input;
+  std::vector<char> buffer;  ///< The part of the stream being read.
+  std::size_t bufferPos;
+  std::size_t bufferSize;
+  bool error;
+
+  std::string rawString;  ///< Reused when reading strings and literals.
+  std::istringstream numberStream;  ///< Reused to convert numbers.
+};
+
+}  // namespace gd
+
+#endif
@@ -5,9 +5,12 @@
  */
 
 #include "GDCore/Serialization/Serializer.h"
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "GDCore/CommonTools.h"
@@ -485,4 +488,311 @@ SerializerElement Serializer::FromJSON(const std::string& jsonStr) {
   return element;
 }
 
+// Private functions for binary serialization
+namespace {
+const char binaryMagic[] = {'G', 'D', 'S', 'B'};
+const unsigned char binaryVersion = 1;
+
+/**
+ * The type of a value stored in the binary format.
+ */
+enum BinaryValueType {
+  BinaryUnknown = 0,
+  BinaryFalse = 1,
+  BinaryTrue = 2,
+  BinaryString = 3,
+  BinaryInt = 4,
+  BinaryDouble = 5
+};
+
+/**
+ * The flags stored at the beginning of each element in the binary format.
+ */
+enum BinaryElementFlags { BinaryHasValue = 1 << 0, BinaryIsArray = 1 << 1 };
+
+/**
+ * Write elements in the binary format. The names are interned while the
+ * elements are written, and the table of names is written before the
+ * elements by GetResult.
+ */
+class BinaryWriter {
+ public:
+  void WriteElement(const SerializerElement& element) {
+    unsigned char flags = 0;
+    if (!element.IsValueUndefined()) flags |= BinaryHasValue;
+    if (element.ConsideredAsArray()) flags |= BinaryIsArray;
+    body.push_back(flags);
+
+    if (!element.IsValueUndefined()) WriteValue(element.GetValue());
+    if (element.ConsideredAsArray()) WriteName(element.ConsideredAsArrayOf());
+
+    const std::map<gd::String, SerializerValue>& attributes =
+        element.GetAllAttributes();
+    WriteVarUInt(attributes.size());
+    for (const auto& attribute : attributes) {
+      WriteName(attribute.first);
+      WriteValue(attribute.second);
+    }
+
+    const std::vector<
+        std::pair<gd::String, std::shared_ptr<SerializerElement> > >&
+        children = element.GetAllChildren();
+    std::size_t childrenCount = 0;
+    for (const auto& child : children)
+      if (child.second) childrenCount++;
+
+    WriteVarUInt(childrenCount);
+    for (const auto& child : children) {
+      if (!child.second) continue;
+
+      WriteName(child.first);
+
+      // Reserve the size of the child, and fill it once the child is written.
+      std::size_t sizePos = body.size();
+      body.append(4, '\0');
+      WriteElement(*child.second);
+      std::uint32_t size = body.size() - sizePos - 4;
+      for (std::size_t i = 0; i < 4; ++i)
+        body[sizePos + i] = static_cast<char>((size >> (8 * i)) & 0xFF);
+    }
+  }
+
+  std::string GetResult() const {
+    std::string result(binaryMagic, sizeof(binaryMagic));
+    result.push_back(static_cast<char>(binaryVersion));
+
+    BinaryWriter tableWriter;
+    tableWriter.WriteVarUInt(names.size());
+    for (const gd::String* name : names) tableWriter.WriteString(*name);
+
+    result.reserve(result.size() + tableWriter.body.size() + body.size());
+    result += tableWriter.body;
+    result += body;
+    return result;
+  }
+
+ private:
+  void WriteVarUInt(std::uint64_t value) {
+    while (value >= 0x80) {
+      body.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    body.push_back(static_cast<char>(value));
+  }
+
+  void WriteString(const gd::String& str) {
+    WriteVarUInt(str.Raw().size());
+    body += str.Raw();
+  }
+
+  void WriteName(const gd::String& name) {
+    auto it = namesIds.find(name);
+    if (it == namesIds.end()) {
+      it = namesIds.insert(std::make_pair(name, names.size())).first;
+      names.push_back(&it->first);
+    }
+
+    WriteVarUInt(it->second);
+  }
+
+  void WriteValue(const SerializerValue& value) {
+    if (value.IsBoolean()) {
+      body.push_back(value.GetBool() ? BinaryTrue : BinaryFalse);
+    } else if (value.IsString()) {
+      body.push_back(BinaryString);
+      WriteString(value.GetString());
+    } else if (value.IsInt()) {
+      // Zigzag encoding, so that small negative numbers stay small.
+      std::uint32_t intValue = static_cast<std::uint32_t>(value.GetInt());
+      body.push_back(BinaryInt);
+      WriteVarUInt((intValue << 1) ^ (0u - (intValue >> 31)));
+    } else if (value.IsDouble()) {
+      double doubleValue = value.GetDouble();
+      std::uint64_t bits;
+      memcpy(&bits, &doubleValue, sizeof(bits));
+      body.push_back(BinaryDouble);
+      for (std::size_t i = 0; i < 8; ++i)
+        body.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    } else {
+      body.push_back(BinaryUnknown);
+      WriteString(value.GetString());
+    }
+  }
+
+  std::string body;
+  std::unordered_map<gd::String, std::size_t> namesIds;
+  std::vector<const gd::String*> names;  ///< The keys of namesIds, by id.
+};
+
+/**
+ * Read elements written by BinaryWriter. Reading stops as soon as invalid
+ * data is found.
+ */
+class BinaryReader {
+ public:
+  BinaryReader(const std::string& binary)
+      : pos(binary.data()), end(binary.data() + binary.size()), valid(true) {}
+
+  bool ReadHeader() {
+    if (static_cast<std::size_t>(end - pos) < sizeof(binaryMagic) + 1 ||
+        memcmp(pos, binaryMagic, sizeof(binaryMagic)) != 0) {
+      std::cout << "Parsing error: Not a binary serialized element.";
+      return false;
+    }
+    pos += sizeof(binaryMagic);
+    if (static_cast<unsigned char>(*pos++) != binaryVersion) {
+      std::cout << "Parsing error: Unsupported binary format version.";
+      return false;
+    }
+
+    std::uint64_t namesCount = ReadVarUInt();
+    for (std::uint64_t i = 0; valid && i < namesCount; ++i)
+      names.push_back(ReadString());
+
+    return valid;
+  }
+
+  void ReadElement(SerializerElement& element) {
+    unsigned char flags = ReadByte();
+    if (flags & BinaryHasValue) element.SetValue(ReadValue());
+    const gd::String& arrayOf =
+        (flags & BinaryIsArray) ? ReadName() : noName;
+
+    std::uint64_t attributesCount = ReadVarUInt();
+    for (std::uint64_t i = 0; valid && i < attributesCount; ++i) {
+      const gd::String& name = ReadName();
+      element.SetAttribute(name, ReadValue());
+    }
+
+    std::uint64_t childrenCount = ReadVarUInt();
+    for (std::uint64_t i = 0; valid && i < childrenCount; ++i) {
+      const gd::String& name = ReadName();
+      std::uint32_t size = 0;
+      for (std::size_t j = 0; j < 4; ++j)
+        size |= static_cast<std::uint32_t>(ReadByte()) << (8 * j);
+      if (!valid || size > static_cast<std::size_t>(end - pos)) {
+        Fail();
+        break;
+      }
+
+      // Read the child in its own bounds, and skip any data it was not using.
+      const char* parentEnd = end;
+      end = pos + size;
+      ReadElement(element.AddChild(name));
+      pos = end;
+      end = parentEnd;
+    }
+
+    // Mark the element as an array only once it has all its children, as
+    // AddChild renames the children of arrays.
+    if (flags & BinaryIsArray) element.ConsiderAsArrayOf(arrayOf);
+  }
+
+ private:
+  void Fail() {
+    if (valid) std::cout << "Parsing error: Invalid binary data.";
+    valid = false;
+    pos = end;
+  }
+
+  unsigned char ReadByte() {
+    if (pos >= end) {
+      Fail();
+      return 0;
+    }
+    return static_cast<unsigned char>(*pos++);
+  }
+
+  std::uint64_t ReadVarUInt() {
+    std::uint64_t value = 0;
+    for (unsigned int shift = 0; valid && shift < 64; shift += 7) {
+      unsigned char byte = ReadByte();
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return value;
+    }
+
+    Fail();
+    return 0;
+  }
+
+  gd::String ReadString() {
+    std::uint64_t size = ReadVarUInt();
+    if (size > static_cast<std::uint64_t>(end - pos)) {
+      Fail();
+      return "";
+    }
+
+    gd::String str = gd::String::FromUTF8(std::string(pos, size));
+    pos += size;
+    return str;
+  }
+
+  const gd::String& ReadName() {
+    std::uint64_t id = ReadVarUInt();
+    if (id >= names.size()) {
+      Fail();
+      return noName;
+    }
+    return names[id];
+  }
+
+  SerializerValue ReadValue() {
+    SerializerValue value;
+    switch (ReadByte()) {
+      case BinaryFalse:
+        value.SetBool(false);
+        break;
+      case BinaryTrue:
+        value.SetBool(true);
+        break;
+      case BinaryString:
+        value.SetString(ReadString());
+        break;
+      case BinaryInt: {
+        std::uint32_t intValue = static_cast<std::uint32_t>(ReadVarUInt());
+        value.SetInt(
+            static_cast<int>((intValue >> 1) ^ (0u - (intValue & 1))));
+        break;
+      }
+      case BinaryDouble: {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < 8; ++i)
+          bits |= static_cast<std::uint64_t>(ReadByte()) << (8 * i);
+        double doubleValue;
+        memcpy(&doubleValue, &bits, sizeof(doubleValue));
+        value.SetDouble(doubleValue);
+        break;
+      }
+      case BinaryUnknown:
+        value.Set(ReadString());
+        break;
+      default:
+        Fail();
+        break;
+    }
+
+    return value;
+  }
+
+  const char* pos;
+  const char* end;  ///< The end of the element being read.
+  bool valid;
+  std::vector<gd::String> names;
+  gd::String noName;  ///< Returned when a name can't be read.
+};
+}  // namespace
+
+std::string Serializer::ToBinary(const SerializerElement& element) {
+  BinaryWriter writer;
+  writer.WriteElement(element);
+  return writer.GetResult();
+}
+
+SerializerElement Serializer::FromBinary(const std::string& binary) {
+  SerializerElement element;
+  BinaryReader reader(binary);
+  if (reader.ReadHeader()) reader.ReadElement(element);
+  return element;
+}
+
 }  // namespace gd
@@ -14,7 +14,7 @@ namespace gd {
 
 /**
  * \brief The class used to save/load projects and GDCore classes
- * from/to XML or JSON.
+ * from/to XML, JSON or a compact binary format.
  *
  * Usage example, with TinyXML:
  \code
@@ -53,6 +53,21 @@ class GD_CORE_API Serializer {
   }
   ///@}
 
+  /** \name Binary serialization.
+   * Serialize a SerializerElement from/to a compact binary format, faster to
+   * write and read than JSON.
+   *
+   * The names of the attributes and children are stored once, in a table at
+   * the beginning of the data, and then referred to by their index. Values
+   * are stored with their native type and each child is prefixed by its size.
+   * All the information kept by JSON is kept, so that an element can be
+   * converted from/to JSON through the binary format without loss.
+   */
+  ///@{
+  static std::string ToBinary(const SerializerElement& element);
+  static SerializerElement FromBinary(const std::string& binary);
+  ///@}
+
   virtual ~Serializer(){};
 
  private:
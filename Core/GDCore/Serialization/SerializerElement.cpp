@@ -44,6 +44,12 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
   return *this;
 }
 
+SerializerElement& SerializerElement::SetAttribute(
+    const gd::String& name, const SerializerValue& value) {
+  attributes[name] = value;
+  return *this;
+}
+
 bool SerializerElement::GetBoolAttribute(const gd::String& name,
                                          bool defaultValue,
                                          gd::String deprecatedName) const {
@@ -116,6 +116,15 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement &SetAttribute(const gd::String &name, double value);
 
+  /**
+   * \brief Set the value of an attribute of the element, keeping the type of
+   * the value (including the unknown type).
+   * \param name The name of the attribute.
+   * \param value The value of the attribute.
+   */
+  SerializerElement &SetAttribute(const gd::String &name,
+                                  const SerializerValue &value);
+
   /**
    * Get the value of an attribute being a boolean.
    * \param name The name of the attribute
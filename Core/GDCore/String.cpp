@@ -6,44 +6,120 @@
 
 #include "GDCore/String.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
 #include <SFML/System/String.hpp>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Utf8/utf8proc.h"
 
+namespace
+{
+    /**
+     * \return the first byte which is not an ASCII character between **begin**
+     * and **end** (or **end** if there is none).
+     *
+     * Bytes are checked 8 at a time, using a 64 bits integer as a vector of bytes.
+     */
+    const char* FindNonASCII( const char *begin, const char *end )
+    {
+        const std::uint64_t nonASCIIBits = 0x8080808080808080ULL;
+        for( ; end - begin >= 8; begin += 8 )
+        {
+            std::uint64_t bytes;
+            std::memcpy(&bytes, begin, sizeof(bytes));
+            if( (bytes & nonASCIIBits) != 0 )
+                break;
+        }
+
+        while( begin != end && static_cast<unsigned char>(*begin) < 0x80 )
+            ++begin;
+
+        return begin;
+    }
+
+    /**
+     * Move **it** forward by **count** characters, or until **end** is reached.
+     * Characters are read like the String iterators do, except that a truncated
+     * character at the end stops at **end**.
+     *
+     * \return the number of characters skipped.
+     */
+    gd::String::size_type AdvanceCharacters( const char *&it, const char *end,
+        gd::String::size_type count )
+    {
+        gd::String::size_type advanced = 0;
+        while( advanced < count && it != end )
+        {
+            //Skip the ASCII characters, without going further than the count.
+            const char *limit = static_cast<gd::String::size_type>(end - it) > count - advanced ?
+                it + (count - advanced) : end;
+            const char *nonASCII = FindNonASCII(it, limit);
+            advanced += nonASCII - it;
+            it = nonASCII;
+            if( it == limit )
+                continue;
+
+            std::ptrdiff_t length = ::utf8::internal::sequence_length(it);
+            it += std::min<std::ptrdiff_t>(std::max<std::ptrdiff_t>(length, 1), end - it);
+            advanced++;
+        }
+
+        return advanced;
+    }
+}
+
 namespace gd
 {
 
 constexpr String::size_type String::npos;
+constexpr String::size_type String::ASCII_FLAG;
 
-String::String() : m_string()
+String::String() : m_string(), m_info(ASCII_FLAG)
 {
 
 }
 
-String::String(const char *characters) : m_string()
+String::String(const char *characters) : m_string(), m_info(npos)
 {
     *this = characters;
 }
 
-String::String(const sf::String &string) : m_string()
+String::String(const sf::String &string) : m_string(), m_info(ASCII_FLAG)
 {
     *this = string;
 }
 
-String::String(const std::u32string &string) : m_string()
+String::String(const std::u32string &string) : m_string(), m_info(ASCII_FLAG)
 {
     *this = string;
 }
 
+String::String(String &&other) noexcept :
+    m_string(std::move(other.m_string)), m_info(other.GetInfo())
+{
+    other.clear();
+}
+
+String& String::operator=(String &&other) noexcept
+{
+    m_string = std::move(other.m_string);
+    SetInfo(other.GetInfo());
+    other.clear();
+    return *this;
+}
+
 String& String::operator=(const char *characters)
 {
     m_string = std::string(characters);
+    SetInfo(npos);
     return *this;
 }
 
 String& String::operator=(const sf::String &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -63,7 +139,7 @@ String& String::operator=(const sf::String &string)
 
 String& String::operator=(const std::u32string &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -83,7 +159,61 @@ String& String::operator=(const std::u32string &string)
 
 String::size_type String::size() const
 {
-    return std::distance(begin(), end());
+    UpdateInfo();
+    return GetInfo() & ~ASCII_FLAG;
+}
+
+void String::UpdateInfo() const
+{
+    if( GetInfo() != npos )
+        return;
+
+    const char *it = m_string.data();
+    const char *end = it + m_string.size();
+    const char *nonASCII = FindNonASCII(it, end);
+    if( nonASCII == end )
+    {
+        SetInfo(m_string.size() | ASCII_FLAG);
+    }
+    else
+    {
+        size_type asciiCount = nonASCII - it;
+        SetInfo(asciiCount + AdvanceCharacters(nonASCII, end, npos));
+    }
+}
+
+bool String::IsASCII() const
+{
+    UpdateInfo();
+    return (GetInfo() & ASCII_FLAG) != 0;
+}
+
+String::size_type String::GetByteOffset( size_type count, size_type fromOffset ) const
+{
+    if( IsASCII() )
+        return count < m_string.size() - fromOffset ? fromOffset + count : m_string.size();
+
+    const char *it = m_string.data() + fromOffset;
+    AdvanceCharacters(it, m_string.data() + m_string.size(), count);
+    return it - m_string.data();
+}
+
+String::size_type String::GetCharactersCount( size_type fromOffset, size_type toOffset ) const
+{
+    if( IsASCII() )
+        return toOffset - fromOffset;
+
+    const char *it = m_string.data() + fromOffset;
+    return AdvanceCharacters(it, m_string.data() + toOffset, npos);
+}
+
+void String::UpdateInfoAfterChange( bool asciiCharacters, difference_type count )
+{
+    size_type info = GetInfo();
+    if( info != npos && (info & ASCII_FLAG) && asciiCharacters )
+        SetInfo(((info & ~ASCII_FLAG) + count) | ASCII_FLAG);
+    else
+        SetInfo(npos);
 }
 
 String::iterator String::begin()
@@ -180,6 +310,7 @@ std::string String::ToLocale() const
 std::u32string String::ToUTF32() const
 {
     std::u32string u32str;
+    u32str.reserve( size() );
     for( const_iterator it = begin(); it != end(); ++it )
     {
         u32str.push_back( *it );
@@ -222,7 +353,9 @@ std::wstring String::ToWide() const
 
 bool String::IsValid() const
 {
-    return ::utf8::is_valid(m_string.begin(), m_string.end());
+    //ASCII characters are always valid: only check the rest of the string.
+    const char *end = m_string.data() + m_string.size();
+    return ::utf8::is_valid(FindNonASCII(m_string.data(), end), end);
 }
 
 String& String::ReplaceInvalid( value_type replacement )
@@ -231,26 +364,36 @@ String& String::ReplaceInvalid( value_type replacement )
     ::utf8::replace_invalid(m_string.begin(), m_string.end(), std::back_inserter(validStr), replacement);
 
     m_string = validStr;
+    SetInfo(npos);
 
     return *this;
 }
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
-    const_iterator it = begin();
-    std::advance(it, position);
-    return *it;
+    if( IsASCII() )
+        return static_cast<unsigned char>(m_string[position]);
+
+    return ::utf8::unchecked::peek_next(m_string.begin() + GetByteOffset(position));
 }
 
 String& String::operator+=( const String &other )
 {
+    //Check if this string is still ASCII before appending (other can be *this).
+    size_type info = GetInfo();
+    bool asciiCharacters = info != npos && (info & ASCII_FLAG) && other.IsASCII();
+    difference_type count = asciiCharacters ? other.m_string.size() : 0;
+
     m_string += other.m_string;
+    UpdateInfoAfterChange(asciiCharacters, count);
     return *this;
 }
 
 String& String::operator+=( const char *other )
 {
-    *this += gd::String(other);
+    std::size_t length = std::strlen(other);
+    m_string.append(other, length);
+    UpdateInfoAfterChange(FindNonASCII(other, other + length) == other + length, length);
     return *this;
 }
 
@@ -263,27 +406,39 @@ String& String::operator+=( value_type character )
 void String::push_back( String::value_type character )
 {
     ::utf8::unchecked::append(character, std::back_inserter(m_string));
+    UpdateInfoAfterChange(character < 0x80, 1);
 }
 
 void String::pop_back()
 {
+    bool asciiCharacters = IsASCII();
     m_string.erase((--end()).base(), end().base());
+    UpdateInfoAfterChange(asciiCharacters, -1);
 }
 
 String& String::insert( size_type pos, const String &str )
 {
-    iterator it = begin();
-    std::advance(it, pos);
+    if(pos > size())
+        throw std::out_of_range("[gd::String::insert] starting pos greater than size");
 
-    //Use the real position as bytes using the std::string::iterators
-    m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    bool asciiCharacters = str.IsASCII();
+    difference_type count = asciiCharacters ? str.m_string.size() : 0;
+
+    //Use the real position as bytes
+    m_string.insert( GetByteOffset(pos), str.m_string );
+    UpdateInfoAfterChange(asciiCharacters, count);
 
     return *this;
 }
 
 String& String::replace( iterator i1, iterator i2, const String &str )
 {
+    bool asciiCharacters = IsASCII() && str.IsASCII();
+    difference_type count = asciiCharacters ?
+        str.m_string.size() - (i2.base() - i1.base()) : 0;
+
     m_string.replace(i1.base(), i2.base(), str.m_string);
+    UpdateInfoAfterChange(asciiCharacters, count);
 
     return *this;
 }
@@ -293,27 +448,37 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
     if(pos > size())
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
+    //Stop at the end of the string if there are less than "len" characters
+    size_type firstByte = GetByteOffset(pos);
+    size_type lastByte = GetByteOffset(len, firstByte);
 
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
+    bool asciiCharacters = IsASCII() && str.IsASCII();
+    difference_type count = asciiCharacters ?
+        str.m_string.size() - (lastByte - firstByte) : 0;
+
+    m_string.replace(firstByte, lastByte - firstByte, str.m_string);
+    UpdateInfoAfterChange(asciiCharacters, count);
 
-    return replace( i1, i2, str );
+    return *this;
 }
 
 String::iterator String::erase( String::iterator first, String::iterator last )
 {
-    return iterator( m_string.erase( first.base(), last.base() ) );
+    bool asciiCharacters = IsASCII();
+    difference_type count = -(last.base() - first.base());
+
+    iterator it( m_string.erase( first.base(), last.base() ) );
+    UpdateInfoAfterChange(asciiCharacters, count);
+    return it;
 }
 
 String::iterator String::erase( String::iterator p )
 {
-    return iterator( m_string.erase( p.base() ) );
+    bool asciiCharacters = IsASCII();
+
+    iterator it( m_string.erase( p.base() ) );
+    UpdateInfoAfterChange(asciiCharacters, -1);
+    return it;
 }
 
 void String::erase( String::size_type pos, String::size_type len )
@@ -321,21 +486,37 @@ void String::erase( String::size_type pos, String::size_type len )
     if(pos > size())
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance(i1, pos);
-
-    iterator i2 = i1;
-    while(i2 != end() && len != 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        len--;
-    }
+    //Stop at the end of the string if there are less than "len" characters
+    size_type firstByte = GetByteOffset(pos);
+    size_type lastByte = GetByteOffset(len, firstByte);
 
-    erase( i1, i2 );
+    bool asciiCharacters = IsASCII();
+    m_string.erase(firstByte, lastByte - firstByte);
+    UpdateInfoAfterChange(asciiCharacters, -static_cast<difference_type>(lastByte - firstByte));
 }
 
 std::vector<String> String::Split( String::value_type delimiter ) const
 {
+    if( IsASCII() && delimiter < 0x80 )
+    {
+        //Split the bytes directly, all the parts are ASCII strings.
+        std::vector<String> splittedStrings;
+        std::string::size_type start = 0;
+        while( true )
+        {
+            std::string::size_type found = m_string.find( static_cast<char>(delimiter), start );
+
+            String str;
+            str.m_string = m_string.substr( start, found == std::string::npos ? found : found - start );
+            str.SetInfo(str.m_string.size() | ASCII_FLAG);
+            splittedStrings.push_back( std::move(str) );
+
+            if( found == std::string::npos )
+                return splittedStrings;
+            start = found + 1;
+        }
+    }
+
     std::vector<String> splittedStrings(1);
     String::const_iterator it = begin();
 
@@ -417,6 +598,7 @@ String& String::Normalize(String::NormForm form)
         newStr = utf8proc_NFKC((unsigned char*)m_string.c_str());
 
     m_string = (char*)newStr;
+    SetInfo(npos);
 
     free(newStr);
 
@@ -425,52 +607,34 @@ String& String::Normalize(String::NormForm form)
 
 String String::substr( String::size_type start, String::size_type length ) const
 {
-    String str;
-
-    const_iterator startIt = begin();
-    while(start > 0 && startIt != end())
-    {
-        ++startIt;
-        --start;
-    }
-    if(start > 0) //We reach the end of the string before the start position
+    if(start > size()) //We reach the end of the string before the start position
         throw std::out_of_range("[gd::String::substr] starting pos greater than size");
 
-    const_iterator endIt = startIt;
-    while(length > 0 && endIt != end())
-    {
-        ++endIt;
-        --length;
-    }
+    size_type startByte = GetByteOffset(start);
+    size_type endByte = GetByteOffset(length, startByte);
 
-    str.m_string = std::string( startIt.base(), endIt.base() );
+    String str;
+    str.m_string = m_string.substr( startByte, endByte - startByte );
+    str.SetInfo(IsASCII() ? (endByte - startByte) | ASCII_FLAG : npos);
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
-    const_iterator it = begin();
-
     //Move to pos
-    if(pos < size())
-        std::advance( it, pos );
-    else
+    if(pos >= size())
         return npos;
 
     //Use the standard std::string to find a string (using their internal std::strings).
-    //Use the raw std::string iterator to get the offset as a **byte** count for the starting
-    //position.
-    std::string::size_type findPos =
-        m_string.find( search.m_string, std::distance( m_string.begin(), it.base() ) );
+    //Use the offset as a **byte** count for the starting position.
+    std::string::size_type startByte = GetByteOffset(pos);
+    std::string::size_type findPos = m_string.find( search.m_string, startByte );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator from the std::string::iterator pointing to the find result.
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance in **characters** count (that's why we need a String::iterator).
-        return std::distance( begin(), findPosIt );
+        //Return the distance in **characters** count.
+        return pos + GetCharactersCount( startByte, findPos );
     }
     else
         return npos;
@@ -483,37 +647,24 @@ String::size_type String::find( const char *search, String::size_type pos ) cons
 
 String::size_type String::find( const String::value_type search, String::size_type pos ) const
 {
-    return find( String( std::u32string( 1, search ) ), pos );
+    String str;
+    str.push_back( search );
+    return find( str, pos );
 }
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
-    //Move to pos + 1 (we will then get the last byte of the character at pos)
-    const_iterator it = begin();
-    std::string::const_iterator baseIt;
-    if( pos < size() ) //little optimization by testing npos directly (avoid calculating size())
-    {
-        std::advance( it, pos + 1 );
-        baseIt = it.base();
-        --baseIt; //Decrement the std::string::iterator by one because we need
-        //it to point to the last byte of the character at pos
-    }
-
     //The last character is included, so we need to put the position
-    //of the last byte of the character at the position "pos"
+    //of the last byte of the character at the position "pos" (the byte before
+    //the character at pos + 1).
     std::string::size_type findPos = m_string.rfind( search.m_string,
-        pos < size() ? std::distance( m_string.begin(), baseIt ) : std::string::npos
+        pos < size() ? GetByteOffset( pos + 1 ) - 1 : std::string::npos
         );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator to the find position to be able to get the real
-        //distance as characters count (it would be a distance as bytes count
-        //with a std::string::iterator)
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance (which is a distance as characters count)
-        return std::distance( begin(), findPosIt );
+        //Return the distance as characters count (and not as bytes count)
+        return GetCharactersCount( 0, findPos );
     }
     else
         return npos;
@@ -526,7 +677,9 @@ String::size_type String::rfind( const char *search, String::size_type pos ) con
 
 String::size_type String::rfind( const value_type &search, String::size_type pos ) const
 {
-    return rfind( String( std::u32string( 1, search ) ), pos );
+    String str;
+    str.push_back( search );
+    return rfind( str, pos );
 }
 
 namespace priv
@@ -540,11 +693,13 @@ namespace priv
         else
             return String::npos;
 
-        for( ; it != str.end(); ++it )
+        //Decode the match string only once
+        std::u32string matchCodepoints = match.ToUTF32();
+        for( String::size_type pos = startPos; it != str.end(); ++it, ++pos )
         {
             //Search the current char in the match string
-            if( ( std::find( match.begin(), match.end(), (*it) ) != match.end() ) != not_of )
-                return std::distance( str.begin(), it );
+            if( ( std::find( matchCodepoints.begin(), matchCodepoints.end(), (*it) ) != matchCodepoints.end() ) != not_of )
+                return pos;
         }
 
         return String::npos;
@@ -553,11 +708,18 @@ namespace priv
 
 String::size_type String::find_first_of( const String &match, size_type startPos ) const
 {
+    //An ASCII character can only be equal to the byte of an ASCII character in match.
+    if( IsASCII() )
+        return m_string.find_first_of(match.m_string, startPos);
+
     return priv::find_first_of(*this, match, startPos, false);
 }
 
 String::size_type String::find_first_not_of( const String &match, size_type startPos ) const
 {
+    if( IsASCII() )
+        return m_string.find_first_not_of(match.m_string, startPos);
+
     return priv::find_first_of(*this, match, startPos, true);
 }
 
@@ -570,15 +732,22 @@ namespace priv
         String::size_type strSize = str.size();
 
         String::const_iterator it = str.end();
+        String::size_type pos = strSize;
         if( endPos < strSize )
+        {
             std::advance( it, endPos - strSize + 1 );
+            pos = endPos + 1;
+        }
 
+        //Decode the match string only once
+        std::u32string matchCodepoints = match.ToUTF32();
         while( it != str.begin() )
         {
             --it;
+            --pos;
 
-            if( ( std::find( match.begin(), match.end(), (*it) ) != match.end() ) != not_of )
-                return std::distance( str.begin(), it );
+            if( ( std::find( matchCodepoints.begin(), matchCodepoints.end(), (*it) ) != matchCodepoints.end() ) != not_of )
+                return pos;
         }
 
         return String::npos;
@@ -587,11 +756,17 @@ namespace priv
 
 String::size_type String::find_last_of( const String &match, size_type endPos ) const
 {
+    if( IsASCII() )
+        return m_string.find_last_of(match.m_string, endPos);
+
     return priv::find_last_of( *this, match, endPos, false );
 }
 
 String::size_type String::find_last_not_of( const String &match, size_type endPos ) const
 {
+    if( IsASCII() )
+        return m_string.find_last_not_of(match.m_string, endPos);
+
     return priv::find_last_of( *this, match, endPos, true );
 }
 
@@ -674,12 +849,12 @@ bool GD_CORE_API operator==( const String &lhs, const String &rhs )
 
 bool GD_CORE_API operator==( const String &lhs, const char *rhs )
 {
-    return (lhs == String(rhs));
+    return (lhs.Raw() == rhs);
 }
 
 bool GD_CORE_API operator==( const char *lhs, const gd::String &rhs )
 {
-    return (String(lhs) == rhs);
+    return (rhs.Raw() == lhs);
 }
 
 bool GD_CORE_API operator!=( const String &lhs, const String &rhs )
@@ -704,12 +879,12 @@ bool GD_CORE_API operator<( const String &lhs, const String &rhs )
 
 bool GD_CORE_API operator<( const String &lhs, const char *rhs )
 {
-    return (lhs < String(rhs));
+    return (lhs.Raw().compare(rhs) < 0);
 }
 
 bool GD_CORE_API operator<( const char *lhs, const String &rhs )
 {
-    return (String(lhs) < rhs);
+    return (rhs.Raw().compare(lhs) > 0);
 }
 
 bool GD_CORE_API operator<=( const String &lhs, const String &rhs )
@@ -719,12 +894,12 @@ bool GD_CORE_API operator<=( const String &lhs, const String &rhs )
 
 bool GD_CORE_API operator<=( const String &lhs, const char *rhs )
 {
-    return (lhs <= String(rhs));
+    return (lhs.Raw().compare(rhs) <= 0);
 }
 
 bool GD_CORE_API operator<=( const char *lhs, const String &rhs )
 {
-    return (String(lhs) <= rhs);
+    return (rhs.Raw().compare(lhs) >= 0);
 }
 
 bool GD_CORE_API operator>( const String &lhs, const String &rhs )
@@ -734,12 +909,12 @@ bool GD_CORE_API operator>( const String &lhs, const String &rhs )
 
 bool GD_CORE_API operator>( const String &lhs, const char *rhs )
 {
-    return (lhs > String(rhs));
+    return (lhs.Raw().compare(rhs) > 0);
 }
 
 bool GD_CORE_API operator>( const char *lhs, const String &rhs )
 {
-    return (String(lhs) > rhs);
+    return (rhs.Raw().compare(lhs) < 0);
 }
 
 bool GD_CORE_API operator>=( const String &lhs, const String &rhs )
@@ -749,12 +924,12 @@ bool GD_CORE_API operator>=( const String &lhs, const String &rhs )
 
 bool GD_CORE_API operator>=( const String &lhs, const char *rhs )
 {
-    return (lhs >= String(rhs));
+    return (lhs.Raw().compare(rhs) >= 0);
 }
 
 bool GD_CORE_API operator>=( const char *lhs, const String &rhs )
 {
-    return (String(lhs) >= rhs);
+    return (rhs.Raw().compare(lhs) <= 0);
 }
 
 std::ostream& GD_CORE_API operator<<(std::ostream& os, const String& str)
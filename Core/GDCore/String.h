@@ -7,6 +7,7 @@
 #ifndef GDCORE_UTF8_STRING_H
 #define GDCORE_UTF8_STRING_H
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -126,6 +127,13 @@ public:
      */
     String(const sf::String &string);
 
+    String(const String &other) : m_string(other.m_string), m_info(other.GetInfo()) {}
+
+    /**
+     * Constructs a string by moving another one, which is left empty.
+     */
+    String(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -150,6 +158,18 @@ public:
 
     String& operator=(const std::u32string &string);
 
+    String& operator=(const String &other)
+    {
+        m_string = other.m_string;
+        SetInfo(other.GetInfo());
+        return *this;
+    }
+
+    /**
+     * Assign the String by moving another one, which is left empty.
+     */
+    String& operator=(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -166,6 +186,9 @@ public:
 
     /**
      * \brief Returns the string's length.
+     *
+     * The length is computed once and then kept up to date by the modifiers,
+     * so this has a constant complexity.
      */
     size_type size() const;
 
@@ -179,7 +202,7 @@ public:
      *
      * **Iterators :** Obviously, all iterators are invalidated.
      */
-    void clear() { m_string.clear(); }
+    void clear() { m_string.clear(); SetInfo(ASCII_FLAG); }
 
 /**
  * \}
@@ -366,16 +389,21 @@ public:
 
     /**
      * \brief Returns the code point at the specified position
-     * \warning This operator has a linear complexity on the character's
-     * position. You should avoid to use it in a loop and use the iterators
+     * \warning This operator has a constant complexity for strings made only
+     * of ASCII characters, but a linear complexity on the character's position
+     * otherwise. You should avoid to use it in a loop and use the iterators
      * provided by this class instead.
      */
     value_type operator[]( const size_type position ) const;
 
     /**
      * \brief Get the raw UTF8-encoded std::string
+     *
+     * \note The length of the string is computed again after the std::string
+     * is modified. Don't call other methods of the String while the std::string
+     * returned by this method is being modified.
      */
-    std::string& Raw() { return m_string; }
+    std::string& Raw() { SetInfo(npos); return m_string; }
 
     /**
      * \brief Get the raw UTF8-encoded std::string
@@ -633,8 +661,56 @@ public:
  */
 
 private:
+    /**
+     * \brief Compute the length of the string and if it is made only of ASCII
+     * characters, if this is not known.
+     */
+    void UpdateInfo() const;
+
+    size_type GetInfo() const { return m_info.load(std::memory_order_relaxed); }
+    void SetInfo( size_type info ) const { m_info.store(info, std::memory_order_relaxed); }
+
+    /**
+     * \brief Returns true if the string is made only of ASCII characters: in
+     * this case, positions of characters are the same as the positions of the
+     * bytes.
+     */
+    bool IsASCII() const;
+
+    /**
+     * \brief Returns the offset (in bytes) of the character found **count**
+     * characters after the byte at **fromOffset**, or the size of the string
+     * in bytes if the end is reached before.
+     */
+    size_type GetByteOffset( size_type count, size_type fromOffset = 0 ) const;
+
+    /**
+     * \brief Returns the number of characters between the bytes at
+     * **fromOffset** and **toOffset**.
+     */
+    size_type GetCharactersCount( size_type fromOffset, size_type toOffset ) const;
+
+    /**
+     * \brief Update the cached length after **count** characters were added
+     * to (or removed from, if negative) the string, or forget it if the
+     * characters are not all ASCII.
+     */
+    void UpdateInfoAfterChange( bool asciiCharacters, difference_type count );
+
+    static constexpr size_type ASCII_FLAG = ~(npos >> 1);
+
     std::string m_string; ///< Internal std::string container
 
+    /**
+     * Length of the string, with ASCII_FLAG set if the string is made only of
+     * ASCII characters, or npos if it must be computed (see UpdateInfo).
+     *
+     * It is atomic as it is computed by const methods, which can be called
+     * on the same string by several threads: these threads all compute and
+     * store the same value, so a relaxed ordering is enough.
+     */
+    mutable std::atomic<size_type> m_info;
+
 };
 
 /**
@@ -811,8 +887,13 @@ namespace std
  * \section Performance Performance
  * The UTF8 encoding has the advantage to reduce the RAM consumption compared to UTF16 or UTF32 for strings using a lot
  * of latin characters. But the characters variable length brings some performance issues compared to fixed size encoding.
- * That's why the complexity of each methods is written in their documentation. For instance, the size() method is linear
- * on the string size and so is the operator[]().
+ * That's why the complexity of each methods is written in their documentation. For instance, the operator[]() is linear
+ * on the position of the character.
+ *
+ * To limit these issues, the String keeps its length (so that size() is constant) and whether it is made only of ASCII
+ * characters, which is the case of most names, paths and events code. For these strings, positions of characters are
+ * positions of bytes, and operator[](), substr(), find(), insert(), replace() or erase() work directly on the bytes. For
+ * the other strings, ASCII characters are skipped 8 at a time when looking for a position.
  *
  * \section Conversion Conversions from/to other string types
  * The String handles implicit conversion with sf::String (implicit constructor and implicit conversion
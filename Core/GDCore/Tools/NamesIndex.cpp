@@ -0,0 +1,19 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/NamesIndex.h"
+#include <mutex>
+
+namespace gd {
+
+namespace {
+std::mutex rebuildsMutex;
+}
+
+void NamesIndex::LockRebuilds() { rebuildsMutex.lock(); }
+
+void NamesIndex::UnlockRebuilds() { rebuildsMutex.unlock(); }
+
+}  // namespace gd
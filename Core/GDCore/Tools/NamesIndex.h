@@ -0,0 +1,182 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_NAMESINDEX_H
+#define GDCORE_NAMESINDEX_H
+
+#include <atomic>
+#include <unordered_map>
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Hash index of the positions of named elements stored in an ordered
+ * container (usually a std::vector), so that containers can find elements by
+ * their names without going through all of them.
+ *
+ * The container owning the index must keep it up to date when elements are
+ * inserted, removed, moved or renamed through the container: call Append when
+ * an element is added at the end, and Rebuild after other changes. Lookups
+ * never change the index, so that they can be done from several threads.
+ *
+ * Elements that can be renamed without the container knowing it (objects,
+ * layouts, resources...) have a gd::NamesIndexLink, linked by the container
+ * to its index, which invalidates the index when the element is renamed. Their
+ * containers must use the Find overload taking the elements, which rebuilds
+ * the index if it was invalidated.
+ */
+class GD_CORE_API NamesIndex {
+ public:
+  NamesIndex() : upToDate(true){};
+
+  /**
+   * \brief Copies start empty: the container being copied must rebuild the
+   * index of its copy.
+   */
+  NamesIndex(const NamesIndex&) : upToDate(true){};
+  NamesIndex& operator=(const NamesIndex&) {
+    positions.clear();
+    upToDate.store(true, std::memory_order_relaxed);
+    return *this;
+  };
+
+  /**
+   * \brief Mark the index as outdated, so that it is rebuilt on the next
+   * lookup done with the Find overload taking the elements.
+   *
+   * Called by the elements linked to the index when they are renamed (see
+   * gd::NamesIndexLink). Renaming must not be done while other threads are
+   * searching in the container.
+   */
+  void Invalidate() { upToDate.store(false, std::memory_order_relaxed); }
+
+  /**
+   * \brief Rebuild the index from all the elements.
+   * \param getName Function returning the name of an element.
+   */
+  template <class Elements, class GetName>
+  void Rebuild(const Elements& elements, GetName getName) {
+    BuildPositions(elements, getName);
+  }
+
+  /**
+   * \brief Add to the index an element added at the end of the container.
+   */
+  void Append(const gd::String& name, std::size_t position) {
+    positions.emplace(name, position);
+  }
+
+  /**
+   * \brief Remove all the elements from the index.
+   */
+  void Clear() {
+    positions.clear();
+    upToDate.store(true, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Return the position of the first element with the specified name,
+   * or gd::String::npos if there is no such element.
+   */
+  std::size_t Find(const gd::String& name) const {
+    auto it = positions.find(name);
+    return it != positions.end() ? it->second : gd::String::npos;
+  }
+
+  /**
+   * \brief Same as Find, for elements that can have been renamed without the
+   * container knowing it: the index is first rebuilt from \a elements if it was
+   * invalidated by the renaming of an element.
+   */
+  template <class Elements, class GetName>
+  std::size_t Find(const Elements& elements,
+                   const gd::String& name,
+                   GetName getName) const {
+    if (!upToDate.load(std::memory_order_acquire)) {
+      LockRebuilds();
+      // Another thread can have rebuilt the index while waiting for the lock.
+      if (!upToDate.load(std::memory_order_relaxed))
+        BuildPositions(elements, getName);
+      UnlockRebuilds();
+    }
+
+    return Find(name);
+  }
+
+ private:
+  template <class Elements, class GetName>
+  void BuildPositions(const Elements& elements, GetName getName) const {
+    positions.clear();
+    positions.reserve(elements.size());
+    for (std::size_t i = 0; i < elements.size(); ++i)
+      positions.emplace(getName(elements[i]), i);  // Keep the first one.
+    upToDate.store(true, std::memory_order_release);
+  }
+
+  /**
+   * \brief Lock (or unlock) the mutex shared by all the indexes, so that only
+   * one thread rebuilds an index after elements were renamed.
+   */
+  static void LockRebuilds();
+  static void UnlockRebuilds();
+
+  mutable std::unordered_map<gd::String, std::size_t> positions;
+  mutable std::atomic<bool> upToDate;  ///< false if an element was renamed
+                                       ///< since the index was built.
+};
+
+/**
+ * \brief Link from an element to the index of the container storing it, so
+ * that the index is invalidated when the element is renamed.
+ *
+ * Containers link their elements to their index when the elements are added,
+ * and unlink them if they can still be used after being removed. Elements which
+ * are not in a container (being created, or copies) are not linked, so renaming
+ * them does not invalidate any index.
+ */
+class GD_CORE_API NamesIndexLink {
+ public:
+  NamesIndexLink() : namesIndex(nullptr){};
+
+  /**
+   * \brief The copy of an element is not in the container of the element, so
+   * copies are not linked.
+   */
+  NamesIndexLink(const NamesIndexLink&) : namesIndex(nullptr){};
+
+  /**
+   * \brief An element assigned another one stays in its own container, so the
+   * link is kept.
+   */
+  NamesIndexLink& operator=(const NamesIndexLink&) { return *this; };
+
+  /**
+   * \brief Link the element to the index of the container it was added to.
+   */
+  void Link(NamesIndex& namesIndex_) { namesIndex = &namesIndex_; }
+
+  /**
+   * \brief Unlink the element from \a namesIndex_, if linked to it.
+   */
+  void Unlink(const NamesIndex& namesIndex_) {
+    if (namesIndex == &namesIndex_) namesIndex = nullptr;
+  }
+
+  /**
+   * \brief Invalidate the index of the container of the element, if any. To
+   * be called when the element is renamed.
+   */
+  void NotifyRenamed() const {
+    if (namesIndex) namesIndex->Invalidate();
+  }
+
+ private:
+  NamesIndex* namesIndex;  ///< The index of the container, or nullptr.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_NAMESINDEX_H
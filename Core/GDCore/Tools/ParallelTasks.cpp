@@ -0,0 +1,64 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#include "GDCore/Tools/ParallelTasks.h"
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <vector>
+#if !defined(EMSCRIPTEN)
+#include <thread>
+#endif
+
+namespace gd {
+
+void ParallelTasks::Run(std::size_t tasksCount,
+                        const std::function<void(std::size_t)>& task,
+                        std::size_t threadsCount) {
+#if defined(EMSCRIPTEN)
+  threadsCount = 1;
+#else
+  if (threadsCount == 0) threadsCount = std::thread::hardware_concurrency();
+#endif
+  if (threadsCount > tasksCount) threadsCount = tasksCount;
+
+  if (threadsCount <= 1) {
+    for (std::size_t i = 0; i < tasksCount; ++i) task(i);
+    return;
+  }
+
+#if !defined(EMSCRIPTEN)
+  // Each thread takes the next task not started yet, until all tasks are
+  // started or one of them failed.
+  std::atomic<std::size_t> nextTask(0);
+  std::atomic<bool> failed(false);
+  std::exception_ptr exception;
+  std::mutex exceptionMutex;
+  auto runTasks = [&]() {
+    std::size_t i;
+    while (!failed && (i = nextTask++) < tasksCount) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        if (!exception) exception = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  // The calling thread is one of the threads running the tasks.
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threadsCount; ++i) threads.emplace_back(runTasks);
+  runTasks();
+  for (auto& thread : threads) thread.join();
+
+  if (exception) std::rethrow_exception(exception);
+#endif
+}
+
+}  // namespace gd
+#endif
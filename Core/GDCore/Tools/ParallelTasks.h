@@ -0,0 +1,47 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#ifndef GDCORE_PARALLELTASKS_H
+#define GDCORE_PARALLELTASKS_H
+#include <cstddef>
+#include <functional>
+
+namespace gd {
+
+/**
+ * \brief Tool class to run independent tasks on several threads.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API ParallelTasks {
+ public:
+  /**
+   * \brief Call \a task for each index from 0 to \a tasksCount - 1, using a
+   * pool of threads, and return when all the tasks are done.
+   *
+   * Tasks are run in no particular order: they must only share read-only data,
+   * and store their results at their index so that the results can then be
+   * used in a deterministic order.
+   * If a task throws an exception, the remaining tasks are not started and the
+   * exception is rethrown once the running tasks are done.
+   *
+   * \note Tasks are run on the calling thread when threads are not available
+   * (for example with Emscripten).
+   *
+   * \param threadsCount The maximum number of threads to use. If 0, the number
+   * of hardware threads is used.
+   */
+  static void Run(std::size_t tasksCount,
+                  const std::function<void(std::size_t)>& task,
+                  std::size_t threadsCount = 0);
+
+ private:
+  ParallelTasks(){};
+};
+
+}  // namespace gd
+#endif  // GDCORE_PARALLELTASKS_H
+#endif
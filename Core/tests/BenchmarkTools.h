@@ -0,0 +1,23 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef BENCHMARK_TOOLS
+#define BENCHMARK_TOOLS
+#include <chrono>
+
+/**
+ * \brief Call \a function and return the time it took, in milliseconds.
+ */
+template <typename F>
+double MeasureMilliseconds(F function) {
+  auto start = std::chrono::steady_clock::now();
+  function();
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+#endif
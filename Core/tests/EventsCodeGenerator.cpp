@@ -8,9 +8,12 @@
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include <memory>
+#include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
@@ -31,4 +34,53 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+  SECTION("Scene events code hash") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    auto& object = layout.InsertNewObject(
+        project, "MyExtension::Sprite", "MySpriteObject", 0);
+    layout.GetEvents().InsertEvent(gd::StandardEvent(), 0);
+
+    auto computeHash = [&project, &layout](const gd::String& projectData) {
+      return gd::EventsCodeGenerator::GenerateSceneEventsCompleteCodeHash(
+          project, layout, layout.GetEvents(), projectData);
+    };
+    gd::String projectData =
+        gd::EventsCodeGenerator::SerializeProjectForEventsCodeHash(project);
+    gd::String hash = computeHash(projectData);
+
+    // The hash is stable and ignores the instances of the scene.
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "MySpriteObject");
+    REQUIRE(gd::EventsCodeGenerator::SerializeProjectForEventsCodeHash(
+                project) == projectData);
+    REQUIRE(computeHash(projectData) == hash);
+
+    // Changing the events of the scene changes the hash.
+    layout.GetEvents().InsertEvent(gd::StandardEvent(), 1);
+    gd::String eventsChangedHash = computeHash(projectData);
+    REQUIRE(eventsChangedHash != hash);
+
+    // Changing an object used by the events changes the hash.
+    object.GetVariables().InsertNew("MyVariable", 0);
+    gd::String objectChangedHash = computeHash(projectData);
+    REQUIRE(objectChangedHash != eventsChangedHash);
+
+    // Adding an extension made with events changes the project data, and so
+    // the hash of every scene.
+    project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    gd::String extensionProjectData =
+        gd::EventsCodeGenerator::SerializeProjectForEventsCodeHash(project);
+    REQUIRE(extensionProjectData != projectData);
+    gd::String extensionChangedHash = computeHash(extensionProjectData);
+    REQUIRE(extensionChangedHash != objectChangedHash);
+
+    // A new version of GDevelop changes the project data too.
+    gd::String newVersionProjectData = extensionProjectData.FindAndReplace(
+        gd::VersionWrapper::FullString(), "Another version");
+    REQUIRE(newVersionProjectData != extensionProjectData);
+    REQUIRE(computeHash(newVersionProjectData) != extensionChangedHash);
+  }
 }
@@ -423,4 +423,25 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
             "toString(+(-(getNumberWith3Params(12, \"hello world\", "
             "0))))).getChild(\"grandChild\")");
   }
+  SECTION("Nodes are allocated in the arena of the code generator") {
+    gd::ExpressionNodesArena &arena = codeGenerator.GetExpressionNodesArena();
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(12, \"hello\") + "
+        "MySpriteObject.GetObjectNumber()";
+    gd::String output = gd::ExpressionCodeGenerator::GenerateExpressionCode(
+        codeGenerator, context, "number", expression);
+    REQUIRE(output == "getNumberWith2Params(12, \"hello\") + "
+                      "MySpriteObject.getObjectNumber() ?? 0");
+
+    // Trees are destroyed once their code is generated, so the memory of the
+    // arena is reused for the next expressions.
+    std::size_t reservedSize = arena.GetReservedSize();
+    REQUIRE(reservedSize > 0);
+    REQUIRE(arena.GetAllocationsCount() == 0);
+    for (std::size_t i = 0; i < 100; ++i)
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", expression) == output);
+    REQUIRE(arena.GetReservedSize() == reservedSize);
+    REQUIRE(arena.GetAllocationsCount() == 0);
+  }
 }
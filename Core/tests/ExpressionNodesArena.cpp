@@ -0,0 +1,83 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the allocation of the nodes of parsed expressions in an
+ * arena.
+ */
+#include "GDCore/Events/Parsers/ExpressionNodesArena.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ExpressionNodesArena", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  gd::ExpressionParser2 parser(platform, project, layout1);
+  gd::ExpressionParser2 arenaParser(platform, project, layout1);
+  gd::ExpressionNodesArena arena(256);
+  arenaParser.SetNodesArena(&arena);
+
+  SECTION("Same trees as with the heap") {
+    std::vector<std::pair<gd::String, gd::String>> expressions = {
+        {"number", "MyExtension::GetNumberWith2Params(12, \"hello\") + 1"},
+        {"number", "MySpriteObject.GetObjectNumber() * -(2 + 3)"},
+        {"string", "\"hello \" + MyExtension::ToString(3) + \"world\""},
+        {"scenevar", "myVariable[\"my\" + \"Child\"].other"},
+        {"string", "Idontexist(\"hello\""},
+        {"number", "1//2"},
+    };
+    for (auto &expression : expressions) {
+      auto node = parser.ParseExpression(expression.first, expression.second);
+      auto arenaNode =
+          arenaParser.ParseExpression(expression.first, expression.second);
+      REQUIRE(arena.GetAllocationsCount() > 0);
+      REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*arenaNode) ==
+              gd::ExpressionParser2NodePrinter::PrintNode(*node));
+
+      gd::ExpressionValidator validator;
+      node->Visit(validator);
+      gd::ExpressionValidator arenaValidator;
+      arenaNode->Visit(arenaValidator);
+      REQUIRE(arenaValidator.GetErrors().size() ==
+              validator.GetErrors().size());
+    }
+    REQUIRE(arena.GetAllocationsCount() == 0);
+  }
+
+  SECTION("Memory is reused once trees are destroyed") {
+    gd::String expression = "MyExtension::GetNumberWith2Params(12, \"hello\")";
+    { auto node = arenaParser.ParseExpression("number", expression); }
+    std::size_t reservedSize = arena.GetReservedSize();
+    REQUIRE(reservedSize > 0);
+
+    for (std::size_t i = 0; i < 100; ++i)
+      arenaParser.ParseExpression("number", expression);
+    REQUIRE(arena.GetReservedSize() == reservedSize);
+
+    // Trees kept alive at the same time take more memory.
+    auto node1 = arenaParser.ParseExpression("number", expression);
+    auto node2 = arenaParser.ParseExpression("number", expression);
+    REQUIRE(arena.GetReservedSize() > reservedSize);
+    node1.reset();
+    REQUIRE(arena.GetAllocationsCount() > 0);
+    node2.reset();
+    REQUIRE(arena.GetAllocationsCount() == 0);
+  }
+
+  SECTION("Nodes created outside of the parser are allocated on the heap") {
+    auto node = gd::make_unique<gd::NumberNode>("123");
+    REQUIRE(arena.GetAllocationsCount() == 0);
+  }
+}
@@ -0,0 +1,182 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmark of the parsing of the expressions used by the
+ * ExpressionParser2 tests, including the naughty strings, and of the parsing of
+ * long expressions (the parsing time should be linear in their length).
+ *
+ * The benchmarks are not part of GDCore_tests: run them with
+ * `GDCore_benchmarks`.
+ */
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * Return the expressions of the ExpressionParser2 tests, with their types.
+ */
+std::vector<std::pair<gd::String, gd::String>> GetTestsExpressions() {
+  return {
+      {"string", "\"hello world\""},
+      {"string", "\"hello \\\"world\\\"\""},
+      {"string", "\"hello world\" + 123"},
+      {"string", "((\"hello world\") + (123))"},
+      {"string", "abcd + efgh"},
+      {"string", "Idontexist(\"hello\""},
+      {"string", "\"Hello \" - \"World\""},
+      {"string", "+-\"hello\""},
+      {"number", "123 + \"hello world\""},
+      {"number", "((123)) + (\"hello world\")"},
+      {"number", "-123.2"},
+      {"number", "3.14159"},
+      {"number", "3..14"},
+      {"number", "123 % 456"},
+      {"number", "1//2"},
+      {"number", "MyExtension::GetNumber(12)"},
+      {"number", "MyExtension::MouseX(,)"},
+      {"number", "MySpriteObject.GetObjectNumber()"},
+      {"number",
+       "MyExtension::GetNumberWith2Params(12, \"hello world\") + "
+       "MySpriteObject.GetObjectNumber() * 2"},
+      {"object", "Hello World 1  "},
+      {"scenevar", "myVariable.myChild"},
+      {"scenevar", "myVariable[\"myChild\" + MyExtension::ToString(3)]"},
+  };
+}
+
+/**
+ * Return the naughty strings, parsed both as texts and as numbers.
+ */
+std::vector<std::pair<gd::String, gd::String>> GetNaughtyStringsExpressions() {
+  std::vector<std::pair<gd::String, gd::String>> expressions;
+  std::ifstream file(std::string(__FILE__).substr(
+                         0, std::string(__FILE__).find_last_of("/\\") + 1) +
+                     "ExpressionParser2NaugtyStrings.cpp-blns.txt");
+  std::string line;
+  while (std::getline(file, line)) {
+    expressions.push_back(std::make_pair("string", gd::String(line.c_str())));
+    expressions.push_back(std::make_pair("number", gd::String(line.c_str())));
+  }
+
+  return expressions;
+}
+
+double MeasureParsing(
+    gd::ExpressionParser2 &parser,
+    const std::vector<std::pair<gd::String, gd::String>> &expressions,
+    std::size_t iterations,
+    std::size_t &nodesCount) {
+  return MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      for (auto &expression : expressions) {
+        auto node = parser.ParseExpression(expression.first, expression.second);
+        if (node) nodesCount++;
+      }
+    }
+  });
+}
+
+/**
+ * Return a text made of the given text repeated \a count times.
+ */
+gd::String RepeatText(const gd::String &text, std::size_t count) {
+  gd::String repeatedText;
+  for (std::size_t i = 0; i < count; ++i) repeatedText += text;
+
+  return repeatedText;
+}
+
+}  // namespace
+
+TEST_CASE("ExpressionParser2 benchmark", "[benchmark]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  auto testsExpressions = GetTestsExpressions();
+  auto naughtyStringsExpressions = GetNaughtyStringsExpressions();
+  REQUIRE(naughtyStringsExpressions.size() > 0);
+  const std::size_t testsIterations = 500;
+
+  gd::ExpressionParser2 parser(platform, project, layout1);
+  std::size_t nodesCount = 0;
+  double testsHeapTime =
+      MeasureParsing(parser, testsExpressions, testsIterations, nodesCount);
+  double naughtyStringsHeapTime =
+      MeasureParsing(parser, naughtyStringsExpressions, 1, nodesCount);
+
+  gd::ExpressionNodesArena arena;
+  parser.SetNodesArena(&arena);
+  double testsArenaTime =
+      MeasureParsing(parser, testsExpressions, testsIterations, nodesCount);
+  double naughtyStringsArenaTime =
+      MeasureParsing(parser, naughtyStringsExpressions, 1, nodesCount);
+
+  std::cout << testsExpressions.size() * testsIterations
+            << " tests expressions parsed: " << testsHeapTime
+            << "ms (heap), " << testsArenaTime << "ms (arena)" << std::endl;
+  std::cout << naughtyStringsExpressions.size()
+            << " naughty strings expressions parsed: "
+            << naughtyStringsHeapTime << "ms (heap), "
+            << naughtyStringsArenaTime << "ms (arena)" << std::endl;
+  std::cout << "Arena reserved size: " << arena.GetReservedSize() << " bytes"
+            << std::endl;
+
+  REQUIRE(nodesCount == 2 * (testsExpressions.size() * testsIterations +
+                             naughtyStringsExpressions.size()));
+  REQUIRE(arena.GetAllocationsCount() == 0);
+}
+
+TEST_CASE("ExpressionParser2 long expressions benchmark", "[benchmark]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+
+  gd::ExpressionParser2 parser(platform, project, layout1);
+  for (std::size_t length = 1000; length <= 1000000; length *= 10) {
+    // Texts and names with non ASCII characters, encoded on several bytes.
+    const gd::String textPattern = u8"Hello wörld \\\"ça va\\\" ";
+    const gd::String namePattern = u8"Object Ωmega";
+    std::size_t count = length / textPattern.size();
+    gd::String text = "\"" + RepeatText(textPattern, count) + "\"";
+    gd::String name = RepeatText(namePattern + " ", count) + namePattern;
+    gd::String nameWithSpaces = name + "  ";
+
+    std::unique_ptr<gd::ExpressionNode> textNode;
+    double textTime = MeasureMilliseconds(
+        [&]() { textNode = parser.ParseExpression("string", text); });
+    std::unique_ptr<gd::ExpressionNode> nameNode;
+    double nameTime = MeasureMilliseconds(
+        [&]() { nameNode = parser.ParseExpression("object", nameWithSpaces); });
+
+    std::cout << length << " characters long text parsed: " << textTime
+              << "ms, name parsed: " << nameTime << "ms" << std::endl;
+
+    auto textNodePtr = dynamic_cast<gd::TextNode *>(textNode.get());
+    REQUIRE(textNodePtr != nullptr);
+    REQUIRE(textNodePtr->text ==
+            RepeatText(u8"Hello wörld \"ça va\" ", count));
+    REQUIRE(textNodePtr->diagnostic == nullptr);
+
+    auto nameNodePtr = dynamic_cast<gd::IdentifierNode *>(nameNode.get());
+    REQUIRE(nameNodePtr != nullptr);
+    REQUIRE(nameNodePtr->identifierName == name);
+  }
+}
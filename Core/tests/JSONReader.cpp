@@ -0,0 +1,173 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the streaming reading of JSON documents.
+ */
+#include "GDCore/Serialization/JSONReader.h"
+#include <sstream>
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+gd::String ReadAndSerializeToJSON(const gd::String& json) {
+  std::istringstream input(json.Raw());
+  JSONReader reader(input);
+  SerializerElement element;
+  reader.ReadElement(element);
+  return Serializer::ToJSON(element);
+}
+}  // namespace
+
+TEST_CASE("JSONReader", "[common]") {
+  SECTION("Walking through a document") {
+    std::istringstream input(
+        "{\"a\": 1.5, \"b\": [true, false, \"c\"],\n\"d\": {\"e\": null}}");
+    JSONReader reader(input);
+
+    gd::String name;
+    REQUIRE(reader.PeekValueType() == JSONReader::Object);
+    REQUIRE(reader.EnterObject());
+    REQUIRE(reader.NextMember(name));
+    REQUIRE(name == "a");
+    REQUIRE(reader.ReadNumber() == 1.5);
+
+    REQUIRE(reader.NextMember(name));
+    REQUIRE(name == "b");
+    REQUIRE(reader.EnterArray());
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadBool() == true);
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadBool() == false);
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.PeekValueType() == JSONReader::String);
+    REQUIRE(reader.ReadString() == "c");
+    REQUIRE(!reader.NextElement());
+
+    REQUIRE(reader.NextMember(name));
+    REQUIRE(name == "d");
+    reader.SkipValue();
+    REQUIRE(!reader.NextMember(name));
+    REQUIRE(!reader.HasError());
+  }
+
+  SECTION("Same elements as Serializer::FromJSON") {
+    std::vector<gd::String> documents = {
+        "\"\"",
+        "123.455",
+        "{}",
+        "[]",
+        "{\"a\": 1,\"b\": {\"c\": 2}}",
+        "{\"hello\": {\"world\": [{},[],3,\"4\"],\"world2\": [-1,\"-2\","
+        "{\"-3\": [-4]}]}}",
+        "{\"\\\"hello\\\"\": \" \\\"quote\\\" \",\"caret-prop\": "
+        "1,\"special-\\b\\f\\n\\r\\t\\\"\": \"\\b\\f\\n\\r\\t\"}",
+        u8"{\"Ich heiße GDevelop\": \"Gut!\",\"Hello 官话 world\": \"官话\"}"};
+    for (const gd::String& json : documents) {
+      REQUIRE(ReadAndSerializeToJSON(json) ==
+              Serializer::ToJSON(Serializer::FromJSON(json)));
+    }
+  }
+
+  SECTION("Unicode escapes") {
+    std::istringstream input("[\"\\u00e9\\u5b98\", \"\\ud83d\\ude00\"]");
+    JSONReader reader(input);
+    REQUIRE(reader.EnterArray());
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == u8"é官");
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == u8"\U0001F600");
+    REQUIRE(!reader.NextElement());
+  }
+
+  SECTION("Invalid surrogates") {
+    std::istringstream input(
+        "[\"\\udc00\", \"\\ud83d\\u0041\", \"\\ud800\\ud83d\\ude00\", "
+        "\"\\ud83d\\n\"]");
+    JSONReader reader(input);
+    REQUIRE(reader.EnterArray());
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == u8"\uFFFD");
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == u8"\uFFFDA");
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == u8"\uFFFD\U0001F600");
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == u8"\uFFFD\n");
+    REQUIRE(!reader.NextElement());
+  }
+
+  SECTION("Documents bigger than the buffer") {
+    gd::String longString(std::string(200000, 'x').c_str());
+    gd::String json = "[\"" + longString + "\", 42]";
+    std::istringstream input(json.Raw());
+    JSONReader reader(input);
+    REQUIRE(reader.EnterArray());
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == longString);
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadNumber() == 42);
+    REQUIRE(!reader.NextElement());
+    REQUIRE(!reader.HasError());
+  }
+
+  SECTION("Invalid documents") {
+    std::istringstream input("{\"a\": [1, 2");
+    JSONReader reader(input);
+    SerializerElement element;
+    reader.ReadElement(element);
+    REQUIRE(reader.HasError());
+  }
+
+  SECTION("Project") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    project.SetName("My project");
+    for (std::size_t i = 0; i < 3; ++i) {
+      gd::Layout& layout =
+          project.InsertNewLayout("Layout" + gd::String::From(i), i);
+      layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+      for (std::size_t j = 0; j < 10 * i; ++j) {
+        gd::InitialInstance& instance =
+            layout.GetInitialInstances().InsertNewInitialInstance();
+        instance.SetObjectName("MyObject");
+        instance.SetX(j * 10);
+        instance.SetY(i);
+      }
+    }
+
+    SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    gd::String json = Serializer::ToJSON(projectElement);
+
+    gd::Project readProject;
+    gd::Platform readPlatform;
+    SetupProjectWithDummyPlatform(readProject, readPlatform);
+    std::istringstream input(json.Raw());
+    JSONReader reader(input);
+    readProject.UnserializeFrom(reader);
+    REQUIRE(!reader.HasError());
+
+    REQUIRE(readProject.GetName() == "My project");
+    REQUIRE(readProject.GetLayoutsCount() == 3);
+    REQUIRE(readProject.GetLayout(2).GetName() == "Layout2");
+    REQUIRE(
+        readProject.GetLayout(2).GetInitialInstances().GetInstancesCount() ==
+        20);
+
+    SerializerElement readProjectElement;
+    readProject.SerializeTo(readProjectElement);
+    REQUIRE(Serializer::ToJSON(readProjectElement) == json);
+  }
+}
@@ -0,0 +1,88 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lookup of metadata declared by extensions.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include <memory>
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Object.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+std::shared_ptr<gd::PlatformExtension> NewExtension(
+    const gd::String& name, const gd::String& actionName) {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(name, name, "", "", "");
+  extension->AddAction(actionName, "Action", "", "", "", "", "");
+  auto& object = extension->AddObject<gd::Object>("Object", "Object", "", "");
+  object.AddAction("ObjectAction", "Object action", "", "", "", "", "");
+  object.AddExpression("Value", "Value", "", "", "");
+  return extension;
+}
+}  // namespace
+
+TEST_CASE("MetadataProvider", "[common]") {
+  gd::Platform platform;
+  auto baseObjectExtension = std::make_shared<gd::PlatformExtension>();
+  baseObjectExtension->SetExtensionInformation(
+      "BuiltinObject", "Base object", "", "", "");
+  baseObjectExtension->AddObject<gd::Object>("", "Base object", "", "")
+      .AddExpression("BaseValue", "Base value", "", "", "");
+  platform.AddExtension(baseObjectExtension);
+  platform.AddExtension(NewExtension("Extension1", "Action"));
+
+  SECTION("Instructions") {
+    REQUIRE(MetadataProvider::HasAction(platform, "Extension1::Action"));
+    REQUIRE(!MetadataProvider::HasAction(platform, "Extension1::ObjectAction"));
+    REQUIRE(!MetadataProvider::HasCondition(platform, "Extension1::Action"));
+    REQUIRE(MetadataProvider::HasObjectAction(
+        platform, "Extension1::Object", "Extension1::ObjectAction"));
+
+    // Actions of objects are found without the object type.
+    auto actionAndExtension = MetadataProvider::GetExtensionAndActionMetadata(
+        platform, "Extension1::ObjectAction");
+    REQUIRE(actionAndExtension.GetMetadata().GetFullName() == "Object action");
+    REQUIRE(actionAndExtension.GetExtension().GetName() == "Extension1");
+    REQUIRE(MetadataProvider::GetActionMetadata(platform, "Unknown")
+                .GetFullName() == "");
+  }
+
+  SECTION("Objects expressions") {
+    REQUIRE(MetadataProvider::GetObjectMetadata(platform, "Extension1::Object")
+                .GetFullName() == "Object");
+    REQUIRE(MetadataProvider::HasObjectExpression(
+        platform, "Extension1::Object", "Value"));
+
+    // Expressions of the base object are available for all objects.
+    auto expressionAndExtension =
+        MetadataProvider::GetExtensionAndObjectExpressionMetadata(
+            platform, "Extension1::Object", "BaseValue");
+    REQUIRE(expressionAndExtension.GetMetadata().GetFullName() == "Base value");
+    REQUIRE(expressionAndExtension.GetExtension().GetName() == "BuiltinObject");
+    REQUIRE(MetadataProvider::IsBadExpressionMetadata(
+        MetadataProvider::GetObjectExpressionMetadata(
+            platform, "Extension1::Object", "Unknown")));
+  }
+
+  SECTION("Extensions replaced and removed") {
+    platform.AddExtension(NewExtension("Extension1", "OtherAction"));
+    REQUIRE(!MetadataProvider::HasAction(platform, "Extension1::Action"));
+    REQUIRE(MetadataProvider::HasAction(platform, "Extension1::OtherAction"));
+
+    platform.RemoveExtension("Extension1");
+    REQUIRE(!MetadataProvider::HasAction(platform, "Extension1::OtherAction"));
+    REQUIRE(!MetadataProvider::HasObjectExpression(
+        platform, "Extension1::Object", "Value"));
+    REQUIRE(MetadataProvider::HasObjectExpression(
+        platform, "Extension1::Object", "BaseValue"));
+  }
+}
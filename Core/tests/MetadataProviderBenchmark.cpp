@@ -0,0 +1,121 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmark of the lookup of metadata done by the code generation.
+ *
+ * The benchmarks are not part of GDCore_tests: run them with
+ * `GDCore_benchmarks`.
+ */
+#include <iostream>
+#include <memory>
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * Search an action in the extensions one by one, as done before the
+ * metadata were indexed.
+ */
+const gd::InstructionMetadata* SearchActionInExtensions(
+    const gd::Platform& platform, const gd::String& actionType) {
+  for (auto& extension : platform.GetAllPlatformExtensions()) {
+    const auto& allActions = extension->GetAllActions();
+    if (allActions.find(actionType) != allActions.end())
+      return &allActions.find(actionType)->second;
+
+    for (const gd::String& objectType : extension->GetExtensionObjectsTypes()) {
+      const auto& objectActions = extension->GetAllActionsForObject(objectType);
+      if (objectActions.find(actionType) != objectActions.end())
+        return &objectActions.find(actionType)->second;
+    }
+  }
+
+  return NULL;
+}
+
+}  // namespace
+
+TEST_CASE("MetadataProvider benchmark", "[benchmark]") {
+  // Extensions are loaded before the ones used by the expressions, so that
+  // they have to be searched.
+  gd::Platform platform;
+  for (std::size_t i = 0; i < 100; ++i) {
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    gd::String name = "Extension" + gd::String::From(i);
+    extension->SetExtensionInformation(name, name, "", "", "");
+    auto& object = extension->AddObject<gd::Object>("Object", "", "", "");
+    for (std::size_t j = 0; j < 50; ++j) {
+      gd::String suffix = gd::String::From(j);
+      extension->AddAction("Action" + suffix, "", "", "", "", "", "");
+      extension->AddCondition("Condition" + suffix, "", "", "", "", "", "");
+      extension->AddExpression("Expression" + suffix, "", "", "", "");
+      object.AddAction(
+          "ObjectAction" + suffix, "Object action", "", "", "", "", "");
+    }
+    platform.AddExtension(extension);
+  }
+
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  // The expression is parsed once, to only measure the code generation.
+  const std::size_t iterations = 20000;
+  gd::ExpressionParser2 parser(platform, project, layout);
+  auto node = parser.ParseExpression(
+      "number",
+      "MyExtension::GetNumber() + MySpriteObject.GetObjectNumber() + "
+      "MyExtension::GetNumberWith2Params(1, \"2\")");
+  gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+  std::size_t outputLength = 0;
+  double codeGenerationTime = MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      unsigned int maxDepth = 0;
+      gd::EventsCodeGenerationContext context(&maxDepth);
+      gd::ExpressionCodeGenerator expressionCodeGenerator(codeGenerator,
+                                                          context);
+      node->Visit(expressionCodeGenerator);
+      outputLength += expressionCodeGenerator.GetOutput().size();
+    }
+  });
+
+  const gd::String actionType = "Extension99::ObjectAction49";
+  std::size_t found = 0;
+  double indexTime = MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i)
+      found += gd::MetadataProvider::GetActionMetadata(platform, actionType)
+                   .GetFullName()
+                   .size();
+  });
+  double searchTime = MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i)
+      found += SearchActionInExtensions(platform, actionType) ? 1 : 0;
+  });
+
+  std::cout << "Expression generated: " << codeGenerationTime
+            << "ms" << std::endl;
+  std::cout << "Action found with the index: " << indexTime << "ms"
+            << std::endl;
+  std::cout << "Action found by searching the extensions: " << searchTime
+            << "ms" << std::endl;
+
+  REQUIRE(outputLength > 0);
+  REQUIRE(found == iterations * (gd::String("Object action").size() + 1));
+}
@@ -0,0 +1,81 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the invalidation of the indexes of names.
+ */
+#include "GDCore/Tools/NamesIndex.h"
+#include <vector>
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * An element stored in a container indexed by its name.
+ */
+struct NamedElement {
+  NamedElement(const gd::String& name_) : name(name_){};
+
+  void SetName(const gd::String& name_) {
+    name = name_;
+    namesIndexLink.NotifyRenamed();
+  }
+
+  gd::String name;
+  gd::NamesIndexLink namesIndexLink;
+};
+
+}  // namespace
+
+TEST_CASE("NamesIndex", "[common]") {
+  std::vector<NamedElement> elements = {
+      NamedElement("Element0"), NamedElement("Element1")};
+  gd::NamesIndex namesIndex;
+  std::size_t getNameCallsCount = 0;
+  auto getName = [&getNameCallsCount](
+                     const NamedElement& element) -> const gd::String& {
+    getNameCallsCount++;
+    return element.name;
+  };
+  namesIndex.Rebuild(elements, getName);
+  for (auto& element : elements) element.namesIndexLink.Link(namesIndex);
+  getNameCallsCount = 0;
+
+  SECTION("Renaming an element of the container rebuilds the index") {
+    elements[1].SetName("Renamed");
+    REQUIRE(namesIndex.Find(elements, "Element1", getName) ==
+            gd::String::npos);
+    REQUIRE(namesIndex.Find(elements, "Renamed", getName) == 1);
+    REQUIRE(getNameCallsCount == 2);  // Rebuilt once.
+  }
+
+  SECTION("Renaming other elements does not rebuild the index") {
+    NamedElement detachedElement("Detached");
+    detachedElement.SetName("Element1");
+
+    NamedElement copy(elements[0]);
+    copy.SetName("Copy");
+
+    std::vector<NamedElement> otherElements = {NamedElement("Other")};
+    gd::NamesIndex otherNamesIndex;
+    otherNamesIndex.Rebuild(otherElements, getName);
+    otherElements[0].namesIndexLink.Link(otherNamesIndex);
+    otherElements[0].SetName("RenamedOther");
+    getNameCallsCount = 0;
+
+    REQUIRE(namesIndex.Find(elements, "Element0", getName) == 0);
+    REQUIRE(namesIndex.Find(elements, "Copy", getName) == gd::String::npos);
+    REQUIRE(getNameCallsCount == 0);
+    REQUIRE(otherNamesIndex.Find(otherElements, "RenamedOther", getName) == 0);
+    REQUIRE(getNameCallsCount == 1);
+  }
+
+  SECTION("Unlinked elements do not invalidate the index") {
+    elements[0].namesIndexLink.Unlink(namesIndex);
+    elements[0].SetName("Renamed");
+    REQUIRE(namesIndex.Find(elements, "Element0", getName) == 0);
+    REQUIRE(getNameCallsCount == 0);
+  }
+}
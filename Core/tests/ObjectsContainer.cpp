@@ -0,0 +1,121 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lookup of objects and layouts by their names.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsContainer", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Objects lookup") {
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    gd::Object& object1 =
+        layout.InsertNewObject(project, "MyExtension::Sprite", "Object1", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Object2", 1);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Object0", 0);
+    REQUIRE(layout.GetObjectPosition("Object0") == 0);
+    REQUIRE(layout.GetObjectPosition("Object1") == 1);
+    REQUIRE(layout.GetObjectPosition("Object2") == 2);
+    REQUIRE(&layout.GetObject("Object1") == &object1);
+    REQUIRE(layout.HasObjectNamed("Unknown") == false);
+
+    layout.MoveObject(0, 2);
+    REQUIRE(layout.GetObjectPosition("Object0") == 2);
+    layout.SwapObjects(0, 1);
+    REQUIRE(layout.GetObjectPosition("Object1") == 1);
+
+    // Objects are renamed without the container being notified.
+    object1.SetName("RenamedObject");
+    REQUIRE(layout.HasObjectNamed("Object1") == false);
+    REQUIRE(&layout.GetObject("RenamedObject") == &object1);
+
+    // A name can be reused by another object.
+    gd::Object& object0 = layout.GetObject("Object0");
+    object0.SetName("Object1");
+    REQUIRE(&layout.GetObject("Object1") == &object0);
+    REQUIRE(layout.HasObjectNamed("Object0") == false);
+    object0 = gd::Object("Object0");
+    REQUIRE(&layout.GetObject("Object0") == &object0);
+    REQUIRE(layout.HasObjectNamed("Object1") == false);
+
+    layout.RemoveObject("Object2");
+    REQUIRE(layout.HasObjectNamed("Object2") == false);
+    REQUIRE(layout.GetObjectPosition("RenamedObject") == 0);
+
+    gd::Layout copy(layout);
+    REQUIRE(copy.GetObjectPosition("Object0") == 1);
+    REQUIRE(&copy.GetObject("RenamedObject") != &object1);
+  }
+
+  SECTION("Layouts lookup") {
+    gd::Layout& layout1 = project.InsertNewLayout("Layout1", -1);
+    project.InsertNewLayout("Layout2", -1);
+    project.InsertNewLayout("Layout0", 0);
+    REQUIRE(project.GetLayoutPosition("Layout0") == 0);
+    REQUIRE(project.GetLayoutPosition("Layout2") == 2);
+    REQUIRE(&project.GetLayout("Layout1") == &layout1);
+
+    layout1.SetName("RenamedLayout");
+    REQUIRE(project.HasLayoutNamed("Layout1") == false);
+    REQUIRE(&project.GetLayout("RenamedLayout") == &layout1);
+
+    project.SwapLayouts(0, 2);
+    REQUIRE(project.GetLayoutPosition("Layout0") == 2);
+    project.RemoveLayout("Layout2");
+    REQUIRE(project.HasLayoutNamed("Layout2") == false);
+    REQUIRE(project.GetLayoutPosition("Layout0") == 1);
+  }
+
+  SECTION("Interleaved inserts, lookups and renames") {
+    gd::Layout& otherLayout = project.InsertNewLayout("OtherLayout", -1);
+    gd::Object& otherObject = otherLayout.InsertNewObject(
+        project, "MyExtension::Sprite", "OtherObject", -1);
+    gd::ResourcesManager& resources = project.GetResourcesManager();
+    for (std::size_t i = 0; i < 200; ++i) {
+      gd::String name = "Element" + gd::String::From(i);
+      REQUIRE(project.HasLayoutNamed(name) == false);
+      gd::Layout& layout = project.InsertNewLayout(name, -1);
+      REQUIRE(&project.GetLayout(name) == &layout);
+
+      REQUIRE(resources.HasResource(name) == false);
+      REQUIRE(resources.AddResource(name, name + ".png", "image"));
+      REQUIRE(resources.GetResource(name).GetFile() == name + ".png");
+
+      REQUIRE(otherLayout.HasObjectNamed(name) == false);
+      gd::Object& object = otherLayout.InsertNewObject(
+          project, "MyExtension::Sprite", name, -1);
+      REQUIRE(&otherLayout.GetObject(name) == &object);
+
+      // Objects of other containers, or not in a container, can be renamed.
+      otherObject.SetName("OtherObject" + gd::String::From(i));
+      REQUIRE(&otherLayout.GetObject("OtherObject" + gd::String::From(i)) ==
+              &otherObject);
+      gd::Object copy(object);
+      copy.SetName("Copy");
+      REQUIRE(&otherLayout.GetObject(name) == &object);
+      REQUIRE(otherLayout.HasObjectNamed("Copy") == false);
+    }
+    REQUIRE(project.GetLayoutPosition("Element199") == 200);
+    REQUIRE(otherLayout.GetObjectPosition("Element199") == 200);
+
+    // Resources removed from the manager are not linked to it anymore.
+    resources.RenameResource("Element0", "RenamedElement0");
+    REQUIRE(resources.HasResource("Element0") == false);
+    REQUIRE(resources.HasResource("RenamedElement0"));
+    resources.RemoveResource("RenamedElement0");
+    REQUIRE(resources.HasResource("RenamedElement0") == false);
+    REQUIRE(resources.HasResource("Element1"));
+  }
+}
@@ -0,0 +1,57 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the tasks run on several threads.
+ */
+#include "GDCore/Tools/ParallelTasks.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
+#include "catch.hpp"
+
+TEST_CASE("ParallelTasks", "[common]") {
+  SECTION("All tasks are run once") {
+    std::vector<int> results(1000, 0);
+    gd::ParallelTasks::Run(results.size(),
+                           [&](std::size_t i) { results[i] += i * 2; }, 4);
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+      REQUIRE(results[i] == i * 2);
+  }
+
+  SECTION("No tasks") {
+    bool called = false;
+    gd::ParallelTasks::Run(0, [&](std::size_t) { called = true; });
+    REQUIRE(called == false);
+  }
+
+  SECTION("Exceptions are rethrown") {
+    std::atomic<std::size_t> tasksRun(0);
+    REQUIRE_THROWS_AS(gd::ParallelTasks::Run(100,
+                                             [&](std::size_t i) {
+                                               ++tasksRun;
+                                               if (i == 10)
+                                                 throw std::runtime_error(
+                                                     "Task failed");
+                                             },
+                                             4),
+                      const std::runtime_error&);
+    REQUIRE(tasksRun > 0);
+  }
+
+  SECTION("Names mangling from several threads") {
+    EventsCodeNameMangler::DestroySingleton();
+    std::vector<gd::String> names(100);
+    gd::ParallelTasks::Run(names.size(),
+                           [&](std::size_t i) {
+                             names[i] = ManObjListName("My object");
+                           },
+                           8);
+
+    for (auto& name : names) REQUIRE(name == "GDMy_32objectObjects");
+  }
+}
@@ -46,6 +46,37 @@ TEST_CASE("Resources", "[common][resources]") {
     image.SetFile("Lots\\\\Of\\\\\\..\\Backslashs");
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
+  SECTION("Names lookup") {
+    gd::ResourcesManager resourcesManager;
+    resourcesManager.AddResource("res1", "path/to/file1.png", "image");
+    resourcesManager.AddResource("res2", "path/to/file2.png", "image");
+    resourcesManager.AddResource("res3", "path/to/file3.png", "audio");
+    REQUIRE(resourcesManager.HasResource("res2") == true);
+    REQUIRE(resourcesManager.GetResource("res3").GetFile() ==
+            "path/to/file3.png");
+    REQUIRE(resourcesManager.GetResourcePosition("res3") == 2);
+
+    resourcesManager.MoveResource(2, 0);
+    REQUIRE(resourcesManager.GetResourcePosition("res3") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("res1") == 1);
+
+    resourcesManager.RenameResource("res1", "renamed1");
+    REQUIRE(resourcesManager.HasResource("res1") == false);
+    REQUIRE(resourcesManager.GetResourcePosition("renamed1") == 1);
+
+    // Resources can also be renamed directly.
+    resourcesManager.GetResource("res2").SetName("renamed2");
+    REQUIRE(resourcesManager.HasResource("res2") == false);
+    REQUIRE(resourcesManager.GetResource("renamed2").GetFile() ==
+            "path/to/file2.png");
+
+    resourcesManager.RemoveResource("renamed1");
+    REQUIRE(resourcesManager.HasResource("renamed1") == false);
+    REQUIRE(resourcesManager.GetResourcePosition("renamed2") == 1);
+
+    gd::ResourcesManager copy(resourcesManager);
+    REQUIRE(copy.GetResourcePosition("renamed2") == 1);
+  }
   SECTION("ArbitraryResourceWorker") {
     gd::Project project;
     project.GetResourcesManager().AddResource(
@@ -4,7 +4,7 @@
  * reserved. This project is released under the MIT License.
  */
 /**
- * @file Tests covering serialization to JSON.
+ * @file Tests covering serialization to JSON and to the binary format.
  */
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/CommonTools.h"
@@ -103,6 +103,85 @@ TEST_CASE("Serializer", "[common]") {
     }
   }
 
+  SECTION("Binary") {
+    SECTION("Round-trip with JSON") {
+      auto toBinaryAndBackToJSON = [](const gd::String& originalJSON) {
+        SerializerElement element = Serializer::FromJSON(originalJSON);
+        return Serializer::ToJSON(
+            Serializer::FromBinary(Serializer::ToBinary(element)));
+      };
+
+      gd::String test1 = "\"\"";
+      REQUIRE(toBinaryAndBackToJSON(test1) == test1);
+      gd::String test2 = "[]";
+      REQUIRE(toBinaryAndBackToJSON(test2) == test2);
+      gd::String test3 =
+          "{\"hello\": {\"world\": [{},[],3,\"4\"],\"world2\": [-1,\"-2\","
+          "{\"-3\": [-4.5]}]},\"ok\": true,\"ko\": false}";
+      REQUIRE(toBinaryAndBackToJSON(test3) == test3);
+      gd::String test4 =
+          u8"{\"\\\"hello\\\"\": \" \\\"quote\\\" \",\"Hello 官话 "
+          u8"world\": \"官话\",\"special-\\b\\f\\n\\r\\t\\\"\": "
+          u8"\"\\b\\f\\n\\r\\t\"}";
+      REQUIRE(toBinaryAndBackToJSON(test4) == test4);
+    }
+    SECTION("Types, attributes and arrays") {
+      SerializerElement root;
+      root.SetAttribute("bool", true);
+      root.SetAttribute("int", -123456);
+      root.SetAttribute("double", 0.1);
+      root.SetAttribute("string", "hello");
+      SerializerValue unknownValue;
+      unknownValue.Set("42");
+      root.SetAttribute("unknown", unknownValue);
+      auto& layouts = root.AddChild("layouts");
+      layouts.ConsiderAsArrayOf("layout");
+      for (auto i = 0; i < 3; ++i)
+        layouts.AddChild("layout").SetAttribute("name",
+                                                 "layout" + gd::String::From(i));
+      root.AddChild("value").SetValue(2147483647);
+
+      SerializerElement element =
+          Serializer::FromBinary(Serializer::ToBinary(root));
+      REQUIRE(element.GetAllAttributes().size() == 5);
+      REQUIRE(element.GetAllAttributes().at("bool").IsBoolean());
+      REQUIRE(element.GetBoolAttribute("bool") == true);
+      REQUIRE(element.GetAllAttributes().at("int").IsInt());
+      REQUIRE(element.GetIntAttribute("int") == -123456);
+      REQUIRE(element.GetAllAttributes().at("double").IsDouble());
+      REQUIRE(element.GetDoubleAttribute("double") == 0.1);
+      REQUIRE(element.GetAllAttributes().at("string").IsString());
+      REQUIRE(element.GetStringAttribute("string") == "hello");
+      const SerializerValue& unknown = element.GetAllAttributes().at("unknown");
+      REQUIRE(!unknown.IsBoolean());
+      REQUIRE(!unknown.IsString());
+      REQUIRE(!unknown.IsInt());
+      REQUIRE(!unknown.IsDouble());
+      REQUIRE(unknown.GetInt() == 42);
+
+      REQUIRE(element.GetChild("layouts").ConsideredAsArrayOf() == "layout");
+      REQUIRE(element.GetChild("layouts").GetChildrenCount() == 3);
+      REQUIRE(element.GetChild("layouts").GetChild(2).GetStringAttribute(
+                  "name") == "layout2");
+      REQUIRE(element.GetChild("value").GetValue().IsInt());
+      REQUIRE(element.GetChild("value").GetValue().GetInt() == 2147483647);
+      REQUIRE(Serializer::ToJSON(element) == Serializer::ToJSON(root));
+    }
+    SECTION("Invalid data") {
+      REQUIRE(Serializer::FromBinary("").GetAllChildren().empty());
+      REQUIRE(Serializer::FromBinary("{\"a\": 1}").GetAllChildren().empty());
+
+      SerializerElement root;
+      root.AddChild("a").SetValue(1);
+      root.AddChild("b").SetValue(2);
+      std::string binary = Serializer::ToBinary(root);
+      SerializerElement truncated =
+          Serializer::FromBinary(binary.substr(0, binary.size() - 1));
+      REQUIRE(truncated.GetChild("a").GetValue().GetInt() == 1);
+      REQUIRE(!truncated.HasChild("b"));
+    }
+  }
+
   SECTION("Splitter") {
     SECTION("Split elements") {
       // Create some elements
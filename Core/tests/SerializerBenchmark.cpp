@@ -0,0 +1,161 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmark comparing the JSON and binary serialization formats, and
+ * the reading of JSON (and of a project saved as JSON) with gd::Serializer and
+ * gd::JSONReader.
+ *
+ * The benchmarks are not part of GDCore_tests: run them with
+ * `GDCore_benchmarks`.
+ */
+#include <iostream>
+#include <sstream>
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/JSONReader.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+
+/**
+ * Create an element looking like a big project, with layouts full of
+ * initial instances.
+ */
+SerializerElement CreateBigProjectElement(std::size_t layoutsCount,
+                                          std::size_t instancesCount) {
+  SerializerElement root;
+  root.AddChild("properties").SetAttribute("name", "Benchmark project");
+  auto& layouts = root.AddChild("layouts");
+  layouts.ConsiderAsArrayOf("layout");
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    auto& layout = layouts.AddChild("layout");
+    layout.AddChild("name").SetValue("Layout " + gd::String::From(i));
+    layout.AddChild("standardSortMethod").SetValue(true);
+    auto& instances = layout.AddChild("instances");
+    instances.ConsiderAsArrayOf("instance");
+    for (std::size_t j = 0; j < instancesCount; ++j) {
+      auto& instance = instances.AddChild("instance");
+      instance.AddChild("name").SetValue("Object" + gd::String::From(j % 50));
+      instance.AddChild("layer").SetValue(gd::String(""));
+      instance.AddChild("x").SetValue(j * 32.5);
+      instance.AddChild("y").SetValue(j * 16.25);
+      instance.AddChild("angle").SetValue(0.0);
+      instance.AddChild("zOrder").SetValue((double)j);
+      instance.AddChild("locked").SetValue(false);
+      instance.AddChild("customSize").SetValue(false);
+      instance.AddChild("numberProperties").ConsiderAsArrayOf("");
+      instance.AddChild("stringProperties").ConsiderAsArrayOf("");
+      instance.AddChild("initialVariables").ConsiderAsArrayOf("");
+    }
+  }
+
+  return root;
+}
+
+}  // namespace
+
+TEST_CASE("Serializer benchmark", "[benchmark]") {
+  // The JSON form is the reference: the binary form must keep everything.
+  SerializerElement original = Serializer::FromJSON(
+      Serializer::ToJSON(CreateBigProjectElement(200, 400)));
+
+  gd::String json;
+  std::string binary;
+  SerializerElement fromJSON;
+  SerializerElement fromBinary;
+  SerializerElement fromReader;
+  double toJSONTime = MeasureMilliseconds(
+      [&]() { json = Serializer::ToJSON(original); });
+  double fromJSONTime = MeasureMilliseconds(
+      [&]() { fromJSON = Serializer::FromJSON(json); });
+  double readerTime = MeasureMilliseconds([&]() {
+    std::istringstream input(json.Raw());
+    JSONReader reader(input);
+    reader.ReadElement(fromReader);
+  });
+  double toBinaryTime = MeasureMilliseconds(
+      [&]() { binary = Serializer::ToBinary(original); });
+  double fromBinaryTime = MeasureMilliseconds(
+      [&]() { fromBinary = Serializer::FromBinary(binary); });
+
+  std::cout << "JSON:   " << json.Raw().size() << " bytes, written in "
+            << toJSONTime << "ms, read in " << fromJSONTime << "ms"
+            << std::endl;
+  std::cout << "JSON, read with JSONReader in " << readerTime << "ms"
+            << std::endl;
+  std::cout << "Binary: " << binary.size() << " bytes, written in "
+            << toBinaryTime << "ms, read in " << fromBinaryTime << "ms"
+            << std::endl;
+
+  REQUIRE(Serializer::ToJSON(fromBinary) == json);
+  REQUIRE(Serializer::ToJSON(fromJSON) == json);
+  REQUIRE(Serializer::ToJSON(fromReader) == json);
+}
+
+TEST_CASE("Project loading benchmark", "[benchmark]") {
+  const std::size_t layoutsCount = 200;
+  const std::size_t instancesCount = 400;
+
+  gd::String json;
+  {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    for (std::size_t i = 0; i < layoutsCount; ++i) {
+      gd::Layout& layout =
+          project.InsertNewLayout("Layout " + gd::String::From(i), i);
+      layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+      for (std::size_t j = 0; j < instancesCount; ++j) {
+        gd::InitialInstance& instance =
+            layout.GetInitialInstances().InsertNewInitialInstance();
+        instance.SetObjectName("MyObject");
+        instance.SetX(j * 32.5);
+        instance.SetY(j * 16.25);
+      }
+    }
+
+    SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    json = Serializer::ToJSON(projectElement);
+  }
+
+  // Load the project as the games do: from the JSON, either parsed into
+  // elements first, or read while parsing it.
+  gd::Project fromElement;
+  gd::Platform fromElementPlatform;
+  SetupProjectWithDummyPlatform(fromElement, fromElementPlatform);
+  double fromElementTime = MeasureMilliseconds(
+      [&]() { fromElement.UnserializeFrom(Serializer::FromJSON(json)); });
+
+  gd::Project fromReader;
+  gd::Platform fromReaderPlatform;
+  SetupProjectWithDummyPlatform(fromReader, fromReaderPlatform);
+  double fromReaderTime = MeasureMilliseconds([&]() {
+    std::istringstream input(json.Raw());
+    JSONReader reader(input);
+    fromReader.UnserializeFrom(reader);
+  });
+
+  std::cout << "Project of " << layoutsCount << " layouts with "
+            << instancesCount << " instances each, loaded in "
+            << fromElementTime << "ms with Serializer::FromJSON and "
+            << fromReaderTime << "ms with JSONReader" << std::endl;
+
+  for (gd::Project* project : {&fromElement, &fromReader}) {
+    REQUIRE(project->GetLayoutsCount() == layoutsCount);
+    REQUIRE(project->GetLayout(layoutsCount - 1)
+                .GetInitialInstances()
+                .GetInstancesCount() == instancesCount);
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmark of the gd::String operations covered by the utf8 tests, on
+ * ASCII strings (like most names, paths and events code) and on strings with
+ * non ASCII characters.
+ *
+ * The benchmarks are not part of GDCore_tests: run them with
+ * `GDCore_benchmarks`.
+ */
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "BenchmarkTools.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * Run the operations of the utf8 tests on a string made of \a sentence
+ * repeated, and print the time taken by each of them.
+ */
+void BenchmarkOperations(const gd::String &description,
+                         const gd::String &sentence,
+                         const gd::String &searched) {
+  const std::size_t repetitions = 200;
+  const std::size_t iterations = 200;
+  gd::String str;
+  for (std::size_t i = 0; i < repetitions; ++i) str += sentence;
+
+  std::size_t checksum = 0;
+  std::vector<std::pair<gd::String, double>> timings;
+  auto measure = [&](const gd::String &operation, std::function<void()> run) {
+    double time = MeasureMilliseconds([&]() {
+      for (std::size_t i = 0; i < iterations; ++i) run();
+    });
+    timings.push_back(std::make_pair(operation, time));
+  };
+
+  measure("size", [&]() { checksum += str.size(); });
+  measure("operator[]", [&]() {
+    for (std::size_t i = 0; i < 10; ++i)
+      checksum += str[(i * 997) % str.size()];
+  });
+  measure("substr", [&]() {
+    checksum += str.substr(str.size() / 2, sentence.size()).size();
+  });
+  measure("find", [&]() { checksum += str.find(searched, str.size() / 2); });
+  measure("rfind", [&]() { checksum += str.rfind(searched, str.size() / 2); });
+  measure("find_first_of", [&]() {
+    checksum += str.find_first_of(searched, str.size() / 2);
+  });
+  measure("find_last_not_of", [&]() {
+    checksum += str.find_last_not_of(sentence, str.size() / 2);
+  });
+  measure("insert and erase", [&]() {
+    gd::String copy = str;
+    copy.insert(copy.size() / 2, searched);
+    copy.erase(copy.size() / 3, searched.size());
+    checksum += copy.size();
+  });
+  measure("replace", [&]() {
+    gd::String copy = str;
+    copy.replace(copy.size() / 2, sentence.size(), searched);
+    checksum += copy.size();
+  });
+  measure("operator+= and push_back", [&]() {
+    gd::String built;
+    for (std::size_t i = 0; i < 10; ++i) {
+      built += sentence;
+      built.push_back(U'!');
+      checksum += built.size();
+    }
+  });
+  measure("Split", [&]() { checksum += str.Split(U' ').size(); });
+  measure("FindAndReplace", [&]() {
+    checksum += str.substr(0, sentence.size() * 10)
+                    .FindAndReplace(searched, sentence)
+                    .size();
+  });
+  measure("IsValid", [&]() { checksum += str.IsValid(); });
+
+  std::cout << description << " (" << str.size() << " characters, "
+            << iterations << " iterations):" << std::endl;
+  for (auto &timing : timings)
+    std::cout << "  " << timing.first << ": " << timing.second << "ms"
+              << std::endl;
+
+  REQUIRE(checksum > 0);
+}
+
+}  // namespace
+
+TEST_CASE("Utf8 String benchmark", "[benchmark]") {
+  BenchmarkOperations("ASCII string",
+                      "MyObject.Variable(Counter) + GetNumber(12) ",
+                      "GetNumber");
+  BenchmarkOperations("Non ASCII string",
+                      u8"Une fonctionnalité a été testée ! ",
+                      u8"testée");
+}
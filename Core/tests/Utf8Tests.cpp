@@ -11,6 +11,7 @@
 #include <exception>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 #include "GDCore/String.h"
 #include "catch.hpp"
@@ -37,6 +38,68 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(str.size() == 18);
   }
 
+  SECTION("size after modifications") {
+    // The size is kept by the String: check it against the iterators after
+    // each modification, with ASCII and non ASCII characters.
+    gd::String str = "Hello";
+    auto requireSize = [&str](std::size_t size) {
+      REQUIRE(str.size() == size);
+      REQUIRE(std::distance(str.begin(), str.end()) == size);
+    };
+
+    requireSize(5);
+    str += " world";
+    requireSize(11);
+    str.push_back(U'!');
+    requireSize(12);
+    str.insert(5, ",");
+    requireSize(13);
+    str.replace(0, 5, u8"Salut à");
+    requireSize(15);
+    REQUIRE(str == u8"Salut à, world!");
+    str.erase(5, 2);
+    requireSize(13);
+    str.pop_back();
+    requireSize(12);
+    str.Raw() += u8" é";
+    requireSize(14);
+    REQUIRE(str[13] == U'é');
+    REQUIRE(str[5] == U',');
+    str.clear();
+    requireSize(0);
+    str += u8"été";
+    requireSize(3);
+    str += str;
+    requireSize(6);
+    REQUIRE(str == u8"étéété");
+
+    gd::String movedStr = std::move(str);
+    REQUIRE(movedStr.size() == 6);
+    requireSize(0);
+    str += "Reused";
+    requireSize(6);
+  }
+
+  SECTION("ASCII strings") {
+    gd::String str = "MyObject.Variable(Counter)";
+
+    REQUIRE(str[2] == U'O');
+    REQUIRE(str.substr(9, 8) == "Variable");
+    REQUIRE(str.find("Counter") == 18);
+    REQUIRE(str.find(u8"é") == gd::String::npos);
+    REQUIRE(str.rfind(U'e', 17) == 16);
+    REQUIRE(str.find_first_of(u8"é.") == 8);
+    REQUIRE(str.find_first_not_of(u8"éMyObject") == 8);
+    REQUIRE(str.find_last_of("()", 20) == 17);
+    REQUIRE(str.find_last_not_of(")r") == 23);
+    REQUIRE(str.IsValid());
+
+    str.insert(8, u8"é");
+    REQUIRE(str == u8"MyObjecté.Variable(Counter)");
+    REQUIRE(str.find("Counter") == 19);
+    REQUIRE(str[9] == U'.');
+  }
+
   SECTION("substr") {
     gd::String str = u8"UTF8 a été testé !";
 
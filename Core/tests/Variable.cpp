@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <initializer_list>
 #include <map>
+#include <sstream>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/VariablesContainer.h"
@@ -87,4 +88,65 @@ TEST_CASE("Variable", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(variable3.GetChild("Child2").GetValue() == 44);
   }
+  SECTION("Number and string representations") {
+    gd::Variable variable;
+    variable.SetString("1.50");
+    REQUIRE(variable.GetValue() == 1.5);
+    REQUIRE(variable.GetString() == "1.50");  // The string is kept.
+
+    variable.SetValue(0.1);
+    REQUIRE(variable.GetString() == "0.1");
+    REQUIRE(variable.GetValue() == 0.1);  // The number is kept.
+    variable += 1;
+    REQUIRE(variable.GetString() == "1.1");
+  }
+  SECTION("Number conversions") {
+    // Conversions must be the same as the ones done by streams.
+    for (double number : {0.0, -0.0, 1.0, -1.0, 42.0, 999999.0, 1000000.0,
+                          -1234567.0, 0.1, 1.0 / 3.0, -2.5, 1e-7, 1.5e300,
+                          123456.7, 1e21}) {
+      std::ostringstream stream;
+      stream << number;
+      REQUIRE(gd::Variable::NumberToString(number).Raw() == stream.str());
+    }
+
+    for (const char* str : {"0", "-0", "42", "+42", "  42", "-12.25", ".5",
+                            "5.", "0.1", "3.14159265358979", "1e3", "-1.5E-3",
+                            "12345678901234567890", "0.30000000000000004",
+                            "12abc", "abc", "", "-", ".", "1e"}) {
+      std::istringstream stream(str);
+      double number = 0;
+      stream >> number;
+      REQUIRE(gd::Variable::StringToNumber(str) == number);
+    }
+  }
+  SECTION("Children") {
+    gd::Variable variable;
+    variable.GetChild("b").SetValue(2);
+    variable.GetChild("c").SetValue(3);
+    gd::Variable& a = variable.GetChild("a");
+    a.SetValue(1);
+    REQUIRE(variable.IsStructure() == true);
+    REQUIRE(variable.GetChildrenCount() == 3);
+    REQUIRE(variable.HasChild("a") == true);
+    REQUIRE(variable.HasChild("d") == false);
+
+    // Children are sorted by their names, and are not moved in memory when
+    // other children are added.
+    REQUIRE(variable.GetAllChildrenNames() ==
+            std::vector<gd::String>({"a", "b", "c"}));
+    REQUIRE(&variable.GetChild("a") == &a);
+
+    REQUIRE(variable.RenameChild("a", "d") == true);
+    REQUIRE(variable.RenameChild("b", "c") == false);
+    REQUIRE(&variable.GetChild("d") == &a);
+    REQUIRE(variable.GetAllChildrenNames() ==
+            std::vector<gd::String>({"b", "c", "d"}));
+
+    variable.RemoveChild("c");
+    variable.RemoveChild("unknown");
+    REQUIRE(variable.GetAllChildrenNames() ==
+            std::vector<gd::String>({"b", "d"}));
+    REQUIRE(variable.GetChild("d").GetValue() == 1);
+  }
 }
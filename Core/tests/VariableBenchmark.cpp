@@ -0,0 +1,66 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmark of the patterns used by events to access variables.
+ *
+ * The benchmarks are not part of GDCore_tests: run them with
+ * `GDCore_benchmarks`.
+ */
+#include <iostream>
+#include "BenchmarkTools.h"
+#include "GDCore/Project/Variable.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+TEST_CASE("Variable benchmark", "[benchmark]") {
+  const std::size_t iterations = 1000000;
+
+  // A score incremented and displayed in a text every frame.
+  Variable score;
+  std::size_t displayedLength = 0;
+  double scoreTime = MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      score += 1;
+      displayedLength += score.GetString().size();
+    }
+  });
+
+  // A variable read both as a number and as a string by events, without
+  // being changed.
+  Variable speed;
+  speed.SetString("12.5");
+  double speedSum = 0;
+  double alternateTime = MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      speedSum += speed.GetValue();
+      displayedLength += speed.GetString().size();
+    }
+  });
+
+  // A structure used as a dictionary of counters.
+  Variable structure;
+  std::vector<gd::String> names;
+  for (std::size_t i = 0; i < 100; ++i)
+    names.push_back("Counter" + gd::String::From(i));
+  double structureTime = MeasureMilliseconds([&]() {
+    for (std::size_t i = 0; i < iterations; ++i)
+      structure.GetChild(names[i % names.size()]) += 1;
+  });
+
+  std::cout << "Score incremented and displayed: " << scoreTime << "ms"
+            << std::endl;
+  std::cout << "Value read as a number and a string: " << alternateTime << "ms"
+            << std::endl;
+  std::cout << "Structure children incremented: " << structureTime << "ms"
+            << std::endl;
+
+  REQUIRE(score.GetValue() == iterations);
+  REQUIRE(speedSum == 12.5 * iterations);
+  REQUIRE(displayedLength > 0);
+  REQUIRE(structure.GetChild("Counter0").GetValue() ==
+          iterations / names.size());
+}
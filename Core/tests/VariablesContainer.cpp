@@ -49,4 +49,29 @@ TEST_CASE("VariablesContainer", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(container3.Get("Variable2").GetValue() == 44);
   }
+  SECTION("Names lookup") {
+    gd::VariablesContainer container;
+    container.InsertNew("Variable1", -1).SetValue(1);
+    container.InsertNew("Variable2", -1).SetValue(2);
+    container.InsertNew("Variable0", 0).SetValue(0);
+    REQUIRE(container.GetPosition("Variable0") == 0);
+    REQUIRE(container.GetPosition("Variable1") == 1);
+    REQUIRE(container.GetPosition("Variable2") == 2);
+    REQUIRE(container.GetPosition("Unknown") == gd::String::npos);
+
+    REQUIRE(container.Rename("Variable1", "RenamedVariable") == true);
+    REQUIRE(container.Has("Variable1") == false);
+    REQUIRE(container.Get("RenamedVariable").GetValue() == 1);
+
+    container.Move(0, 2);
+    REQUIRE(container.GetPosition("RenamedVariable") == 0);
+    REQUIRE(container.GetPosition("Variable0") == 2);
+    container.Swap(0, 1);
+    REQUIRE(container.GetPosition("Variable2") == 0);
+
+    container.Remove("Variable2");
+    REQUIRE(container.Has("Variable2") == false);
+    REQUIRE(container.GetPosition("RenamedVariable") == 0);
+    REQUIRE(container.Get("Variable0").GetValue() == 0);
+  }
 }
@@ -136,6 +136,17 @@ class LinkedObjectsCppExtension : public ExtensionBase {
         .RemoveAllLinksOf(object);
   }
 
+  /**
+   * Remove the links of all the objects deleted during a frame, looking for
+   * the manager of the scene only once.
+   */
+  virtual void ObjectsDeletedFromScene(
+      RuntimeScene& scene, const std::vector<RuntimeObject*>& objects) {
+    GDpriv::LinkedObjects::ObjectsLinksManager& manager =
+        GDpriv::LinkedObjects::ObjectsLinksManager::managers[&scene];
+    for (RuntimeObject* object : objects) manager.RemoveAllLinksOf(object);
+  }
+
   /**
    * Initialize manager of linked objects of scene
    */
@@ -44,7 +44,10 @@ void ObjectsLinksManager::RemoveLinkBetween(RuntimeObject* a,
 }
 
 void ObjectsLinksManager::RemoveAllLinksOf(RuntimeObject* object) {
-  std::set<RuntimeObject*>& objectLinks = links[object];
+  auto it = links.find(object);
+  if (it == links.end()) return;  // The object has no links.
+
+  std::set<RuntimeObject*>& objectLinks = it->second;
   for (std::set<RuntimeObject*>::iterator linkedObj = objectLinks.begin();
        linkedObj != objectLinks.end();
        ++linkedObj) {
@@ -52,7 +55,7 @@ void ObjectsLinksManager::RemoveAllLinksOf(RuntimeObject* object) {
     linkedObjectLinks.erase(object);
   }
 
-  links.erase(object);  // Remove all links of object
+  links.erase(it);  // Remove all links of object
 }
 
 std::vector<RuntimeObject*> ObjectsLinksManager::GetObjectsLinkedWith(
@@ -462,6 +462,8 @@ void ParticleEmitterBase::CreateParticleSystem() {
       SPK::Vector3D(particleGravityX, -particleGravityY, particleGravityZ));
   particleSystem->group->setFriction(friction);
   particleSystem->group->setRenderer(particleSystem->renderer);
+  // No modifiers are used, so particles can be updated in batch.
+  particleSystem->group->enableBatchUpdate(true);
 
   // Create the System
   particleSystem->particleSystem = SPK::System::create();
@@ -12,6 +12,27 @@ This project is released under the MIT License.
 
 bool ParticleSystemWrapper::SPKinitialized = false;
 
+namespace {
+
+/**
+ * \brief Return a copy of \a renderer, owned by the caller.
+ */
+SPK::GL::GLRenderer* CopyRenderer(const SPK::GL::GLRenderer* renderer) {
+  if (const SPK::GL::GLQuadRenderer* quadRenderer =
+          dynamic_cast<const SPK::GL::GLQuadRenderer*>(renderer))
+    return new SPK::GL::GLQuadRenderer(*quadRenderer);
+  if (const SPK::GL::GLLineRenderer* lineRenderer =
+          dynamic_cast<const SPK::GL::GLLineRenderer*>(renderer))
+    return new SPK::GL::GLLineRenderer(*lineRenderer);
+  if (const SPK::GL::GLPointRenderer* pointRenderer =
+          dynamic_cast<const SPK::GL::GLPointRenderer*>(renderer))
+    return new SPK::GL::GLPointRenderer(*pointRenderer);
+
+  return NULL;
+}
+
+}  // namespace
+
 ParticleSystemWrapper::ParticleSystemWrapper()
     : particleSystem(NULL),
       particleModel(NULL),
@@ -47,6 +68,12 @@ void ParticleSystemWrapper::Init(const ParticleSystemWrapper& other) {
   if (zone) delete zone;
   if (group) delete group;
   if (renderer) delete renderer;
+  particleSystem = NULL;
+  particleModel = NULL;
+  emitter = NULL;
+  zone = NULL;
+  group = NULL;
+  renderer = NULL;
 
   // Don't initialize members if the other object's member are NULL.
   if (other.particleModel == NULL) return;
@@ -61,6 +88,10 @@ void ParticleSystemWrapper::Init(const ParticleSystemWrapper& other) {
   group->setModel(particleModel);
   group->removeEmitter(other.emitter);
   group->addEmitter(emitter);
+  // The copy of the group shares the renderer of the other group, which is
+  // owned (and deleted) by the other wrapper: give it its own renderer.
+  renderer = CopyRenderer(other.renderer);
+  group->setRenderer(renderer);
 
   particleSystem = new SPK::System(*other.particleSystem);
   particleSystem->removeGroup(other.group);
@@ -242,6 +242,20 @@ namespace SPK
 		*/
 		void enableAABBComputing(bool AABB);
 
+		/**
+		* @brief Enables or disables the update of the particles in batch
+		*
+		* When the update in batch is enabled, all the particles are updated in a single loop over the arrays of particle data and parameters,
+		* with everything that does not depend on a particle (model parameters, gravity, friction...) computed once per update instead of once per particle.
+		* Dead particles are then removed from the active particles, the last active particle taking their place.<br>
+		* <br>
+		* The update in batch gives the same results as the update of each particle. It is only used when the Group has no active Modifier
+		* and no custom update callback, as those must be called for each particle during its update.
+		*
+		* @param batch : true to enable the update of the particles in batch, false to disable it
+		*/
+		void enableBatchUpdate(bool batch);
+
 		/**
 		* @brief Enables or not Renderer buffers management in a statix way
 		*
@@ -389,6 +403,15 @@ namespace SPK
 		*/
 		bool isAABBComputingEnabled() const;
 
+		/**
+		* @brief Tells whether the update of the particles in batch is enabled
+		*
+		* For a description of the update in batch, see enableBatchUpdate(bool).
+		*
+		* @return true if the update in batch is enabled, false if it is disabled
+		*/
+		bool isBatchUpdateEnabled() const;
+
 		/**
 		* @brief Gets a Vector3D holding the minimum coordinates of the AABB of the Group.
 		*
@@ -861,6 +884,9 @@ namespace SPK
 		Vector3D AABBMin;
 		Vector3D AABBMax;
 
+		// update in batch
+		bool batchUpdateEnabled;
+
 		// additional buffers
 		mutable std::map<std::string,Buffer*> additionalBuffers;
 		mutable std::set<Buffer*> swappableBuffers;
@@ -874,6 +900,8 @@ namespace SPK
 
 		void updateAABB(const Particle& particle);
 
+		void updateParticlesInBatch(float deltaTime);
+
 		void sortParticles(int start,int end);
 	};
 
@@ -927,6 +955,11 @@ namespace SPK
 		boundingBoxEnabled = AABB;
 	}
 
+	inline void Group::enableBatchUpdate(bool batch)
+	{
+		batchUpdateEnabled = batch;
+	}
+
 	inline const Pool<Particle>& Group::getParticles() const
 	{
 		return pool;
@@ -1012,6 +1045,11 @@ namespace SPK
 		return boundingBoxEnabled;
 	}
 
+	inline bool Group::isBatchUpdateEnabled() const
+	{
+		return batchUpdateEnabled;
+	}
+
 	inline const Vector3D& Group::getAABBMin() const
 	{
 		return AABBMin;
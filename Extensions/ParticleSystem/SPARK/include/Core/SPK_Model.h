@@ -95,6 +95,7 @@ namespace SPK
 	class SPK_PREFIX Model : public Registerable
 	{
 	friend class Particle;
+	friend class Group;
 
 		SPK_IMPLEMENT_REGISTERABLE(Model)	
 	
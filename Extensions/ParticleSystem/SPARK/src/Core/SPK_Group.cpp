@@ -51,6 +51,7 @@ namespace SPK
 		fbirth(NULL),
 		fdeath(NULL),
 		boundingBoxEnabled(false),
+		batchUpdateEnabled(false),
 		emitters(),
 		modifiers(),
 		activeModifiers(),
@@ -74,6 +75,7 @@ namespace SPK
 		fbirth(group.fbirth),
 		fdeath(group.fdeath),
 		boundingBoxEnabled(group.boundingBoxEnabled),
+		batchUpdateEnabled(group.batchUpdateEnabled),
 		emitters(group.emitters),
 		modifiers(group.modifiers),
 		activeModifiers(group.activeModifiers.capacity()),
@@ -323,10 +325,14 @@ namespace SPK
 				activeModifiers.push_back(*it);
 		}
 
-		// Updates particles
+		// Updates particles (in batch if possible, in which case only deaths are checked for each particle)
+		bool batchUpdate = (batchUpdateEnabled)&&(fupdate == NULL)&&(activeModifiers.empty());
+		if (batchUpdate)
+			updateParticlesInBatch(deltaTime);
+
 		for (size_t i = 0; i < pool.getNbActive(); ++i)
 		{
-			if ((pool[i].update(deltaTime))||((fupdate != NULL)&&((*fupdate)(pool[i],deltaTime))))
+			if ((batchUpdate ? particleData[i].life <= 0.0f : pool[i].update(deltaTime))||((fupdate != NULL)&&((*fupdate)(pool[i],deltaTime))))
 			{
 				if (fdeath != NULL)
 					(*fdeath)(pool[i]);
@@ -375,6 +381,56 @@ namespace SPK
 		return (hasActiveEmitters)||(pool.getNbActive() > 0);
 	}
 
+	void Group::updateParticlesInBatch(float deltaTime)
+	{
+		// Same computations as Particle::update, with everything that does not depend on the particle computed once
+		const size_t nbParticles = pool.getNbActive();
+		const size_t currentStride = model->getSizeOfParticleCurrentArray();
+		const size_t extendedStride = model->getSizeOfParticleExtendedArray();
+		const bool mortal = !model->immortal;
+		const size_t nbMutableParams = model->nbMutableParams;
+		const bool interpolated = model->nbInterpolatedParams > 0;
+
+		size_t mutableIndices[Model::NB_PARAMS];
+		for (size_t j = 0; j < nbMutableParams; ++j)
+			mutableIndices[j] = model->particleEnableIndices[model->mutableParams[j]];
+
+		const Vector3D gravityStep = gravity * deltaTime;
+		const bool hasFriction = friction != 0.0f;
+		const bool hasMass = model->isEnabled(PARAM_MASS) != 0;
+		const size_t massIndex = hasMass ? model->particleEnableIndices[PARAM_MASS] : 0;
+		const float defaultFrictionRatio = 1.0f - std::min(1.0f,friction * deltaTime / Model::getDefaultValue(PARAM_MASS));
+
+		Particle::ParticleData* data = particleData;
+		float* currentParams = particleCurrentParams;
+		const float* extendedParams = particleExtendedParams;
+		for (size_t i = 0; i < nbParticles; ++i,++data,currentParams += currentStride,extendedParams += extendedStride)
+		{
+			data->age += deltaTime;
+
+			if (mortal)
+			{
+				// updates mutable parameters
+				float ratio = std::min(1.0f,deltaTime / data->life);
+				data->life -= deltaTime;
+				for (size_t j = 0; j < nbMutableParams; ++j)
+					currentParams[mutableIndices[j]] += (extendedParams[j] - currentParams[mutableIndices[j]]) * ratio;
+			}
+
+			// updates interpolated parameters
+			if (interpolated)
+				pool[i].interpolateParameters();
+
+			// updates position and velocity
+			data->oldPosition = data->position;
+			data->position += data->velocity * deltaTime;
+			data->velocity += gravityStep;
+
+			if (hasFriction)
+				data->velocity *= hasMass ? 1.0f - std::min(1.0f,friction * deltaTime / currentParams[massIndex]) : defaultFrictionRatio;
+		}
+	}
+
 	void Group::pushParticle(std::vector<EmitterData>::iterator& emitterIt,unsigned int& nbManualBorn)
 	{
 		Particle* ptr = pool.makeActive();
@@ -0,0 +1,55 @@
+/**
+
+GDevelop - Particle System Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Tests for the Particle System extension.
+ */
+#define CATCH_CONFIG_MAIN
+#include <memory>
+#include "../ParticleEmitterObject.h"
+#include "../ParticleSystemWrapper.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+// Included last, as the OpenGL headers define macros clashing with SFML and
+// Catch.
+#include <SPK.h>
+#include <SPK_GL.h>
+
+TEST_CASE("ParticleEmitterObject", "[game-engine]") {
+  SECTION("Cloned emitters outlive the emitter they are cloned from") {
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    for (ParticleEmitterBase::RendererType rendererType :
+         {ParticleEmitterBase::Point,
+          ParticleEmitterBase::Line,
+          ParticleEmitterBase::Quad}) {
+      ParticleEmitterObject object("MyEmitter");
+      object.SetRendererType(rendererType);
+
+      std::unique_ptr<RuntimeObject> prototype(
+          new RuntimeParticleEmitterObject(scene, object));
+      std::unique_ptr<RuntimeObject> clone = prototype->Clone();
+      const SPK::GL::GLRenderer* prototypeRenderer =
+          static_cast<RuntimeParticleEmitterObject&>(*prototype)
+              .GetParticleSystem()
+              ->renderer;
+      prototype.reset();
+
+      const ParticleSystemWrapper* particleSystem =
+          static_cast<RuntimeParticleEmitterObject&>(*clone)
+              .GetParticleSystem();
+      REQUIRE(particleSystem->renderer != NULL);
+      REQUIRE(particleSystem->renderer != prototypeRenderer);
+      REQUIRE(particleSystem->group->getRenderer() ==
+              particleSystem->renderer);
+
+      particleSystem->particleSystem->update(0.1f);
+      REQUIRE(particleSystem->group->getNbParticles() > 0);
+    }
+  }
+}
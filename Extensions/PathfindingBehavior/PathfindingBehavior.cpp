@@ -8,10 +8,11 @@ This project is released under the MIT License.
 #include "PathfindingBehavior.h"
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <iostream>
 #include <memory>
-#include <set>
 #include <unordered_map>
+#include <vector>
 #include "GDCore/Tools/Localization.h"
 #include "GDCpp/Extensions/Builtin/MathematicalTools.h"
 #include "GDCpp/Runtime/CommonTools.h"
@@ -21,6 +22,7 @@ This project is released under the MIT License.
 #include "GDCpp/Runtime/Serialization/SerializerElement.h"
 #include "PathfindingObstacleBehavior.h"
 #include "ScenePathfindingObstaclesManager.h"
+#include "ScenePathfindingRequestsManager.h"
 #if defined(GD_IDE_ONLY)
 #include <map>
 #include "GDCore/IDE/Dialogs/PropertyDescriptor.h"
@@ -73,21 +75,27 @@ class Node {
         smallestCost(-1),
         estimateCost(-1),
         parent(NULL),
-        open(true){};
+        open(true),
+        openOrder(0),
+        heapIndex(0){};
   Node(int x, int y)
       : pos(x, y),
         cost(0),
         smallestCost(-1),
         estimateCost(-1),
         parent(NULL),
-        open(true){};
+        open(true),
+        openOrder(0),
+        heapIndex(0){};
   Node(const NodePosition& pos_)
       : pos(pos_),
         cost(0),
         smallestCost(-1),
         estimateCost(-1),
         parent(NULL),
-        open(true){};
+        open(true),
+        openOrder(0),
+        heapIndex(0){};
 
   NodePosition pos;
   float cost;          ///< The cost for traveling on this node
@@ -100,16 +108,17 @@ class Node {
                        ///< (when considering the shortest path).
   bool open;  ///< true if the node is "open" (must be explored), false if
               ///< "close" (already explored)
+  std::size_t openOrder;  ///< When the node was last put in the open nodes,
+                          ///< to explore first the oldest of equivalent nodes.
+  std::size_t heapIndex;  ///< The position of the node in the open nodes heap.
 
   /**
-   * \brief Tool function used to store a Node in a priority_queue.
+   * \brief Return true if the node must be explored before the other one.
    */
-  class NodeComparator {
-   public:
-    bool operator()(const Node* n1, const Node* n2) {
-      return n1->estimateCost < n2->estimateCost;
-    }
-  };
+  bool IsMorePromisingThan(const Node& other) const {
+    return estimateCost < other.estimateCost ||
+           (estimateCost == other.estimateCost && openOrder < other.openOrder);
+  }
 };
 
 bool operator==(Node const& n1, Node const& n2) {
@@ -117,16 +126,21 @@ bool operator==(Node const& n1, Node const& n2) {
 };
 
 typedef float (*DistanceFunPtr)(const NodePosition&, const NodePosition&);
+typedef ScenePathfindingObstaclesManager::ObstacleInfo ObstacleInfo;
 
 /**
  * \brief Internal tool class containing the structures used by A* and members
  * functions related to them.
+ *
+ * \tparam Obstacles The obstacles to be considered: either the obstacles
+ * manager of the scene or a snapshot of it.
  */
+template <typename Obstacles>
 class SearchContext {
  public:
-  SearchContext(ScenePathfindingObstaclesManager& obstacles_,
-                bool allowsDiagonal_ = true)
-      : obstacles(obstacles_),
+  SearchContext(const Obstacles& obstacles_, bool allowsDiagonal_ = true)
+      : openNodesInsertionCount(0),
+        obstacles(obstacles_),
         finalNode(NULL),
         destination(0, 0),
         startX(0),
@@ -196,11 +210,13 @@ class SearchContext {
 
     // Initialize the algorithm
     allNodes.clear();
+    nodesPool.clear();
     Node& startNode = GetNode(start);
     startNode.smallestCost = 0;
     startNode.estimateCost = 0 + distanceFunction(start, destination);
     openNodes.clear();
-    openNodes.insert(&startNode);
+    openNodesInsertionCount = 0;
+    PushOpenNode(startNode);
 
     // A* algorithm main loop
     std::size_t iterationCount = 0;
@@ -210,10 +226,8 @@ class SearchContext {
       if (iterationCount++ > maxIterationCount)
         return false;  // Make sure we do not search forever.
 
-      Node* n = *openNodes.begin();  // Get the most promising node...
-      n->open = false;               //...and flag it as explored
-      openNodes.erase(
-          openNodes.begin());  // Be sure to remove ONLY the first element!
+      Node* n = PopOpenNode();  // Get the most promising node...
+      n->open = false;          //...and flag it as explored
 
       // Check if we reached destination?
       if (n->pos.x == destination.x && n->pos.y == destination.y) {
@@ -278,44 +292,49 @@ class SearchContext {
    * computed thanks to the objects flagged as obstacles.
    */
   Node& GetNode(const NodePosition& pos) {
-    if (allNodes.find(pos) != allNodes.end()) return allNodes.find(pos)->second;
-
-    Node newNode(pos);
+    auto existingNode = allNodes.find(pos);
+    if (existingNode != allNodes.end()) return *existingNode->second;
+
+    nodesPool.emplace_back(pos);
+    Node& newNode = nodesPool.back();
+
+    // Only the obstacles around the cell, including the borders of the object,
+    // can be on the cell.
+    closeObstacles.clear();
+    obstacles.GetAllObstaclesAround(
+        sf::FloatRect(pos.x * cellWidth - leftBorder,
+                      pos.y * cellHeight - topBorder,
+                      leftBorder + rightBorder,
+                      topBorder + bottomBorder),
+        closeObstacles);
 
     bool objectsOnCell = false;
-    const std::set<PathfindingObstacleBehavior*>& allObstacles =
-        obstacles.GetAllObstacles();
-    for (std::set<PathfindingObstacleBehavior*>::const_iterator it =
-             allObstacles.begin();
-         it != allObstacles.end();
+    for (std::vector<ObstacleInfo>::const_iterator it = closeObstacles.begin();
+         it != closeObstacles.end();
          ++it) {
-      RuntimeObject* obj = (*it)->GetObject();
-      int topLeftCellX =
-          floor((obj->GetDrawableX() - rightBorder) / (float)cellWidth);
-      int topLeftCellY =
-          floor((obj->GetDrawableY() - bottomBorder) / (float)cellHeight);
+      const sf::FloatRect& box = it->box;
+      int topLeftCellX = floor((box.left - rightBorder) / (float)cellWidth);
+      int topLeftCellY = floor((box.top - bottomBorder) / (float)cellHeight);
       int bottomRightCellX =
-          ceil((obj->GetDrawableX() + obj->GetWidth() + leftBorder) /
-               (float)cellWidth);
+          ceil((box.left + box.width + leftBorder) / (float)cellWidth);
       int bottomRightCellY =
-          ceil((obj->GetDrawableY() + obj->GetHeight() + topBorder) /
-               (float)cellHeight);
+          ceil((box.top + box.height + topBorder) / (float)cellHeight);
       if (topLeftCellX < pos.x && pos.x < bottomRightCellX &&
           topLeftCellY < pos.y && pos.y < bottomRightCellY) {
         objectsOnCell = true;
-        if ((*it)->IsImpassable()) {
+        if (it->impassable) {
           newNode.cost = -1;
           break;  // The cell is impassable, stop here.
         } else    // Superimpose obstacles
-          newNode.cost += (*it)->GetCost();
+          newNode.cost += it->cost;
       }
     }
 
     if (!objectsOnCell)
       newNode.cost = 1;  // Default cost when no objects put on the cell.
 
-    allNodes[pos] = newNode;
-    return allNodes[pos];
+    allNodes[pos] = &newNode;
+    return newNode;
   }
 
   /**
@@ -350,15 +369,7 @@ class SearchContext {
         neighbor.smallestCost >
             currentNode.smallestCost +
                 (currentNode.cost + neighbor.cost) / 2.0 * factor) {
-      if (neighbor.smallestCost != -1)  // The node is already in the open list:
-      {
-        // remove it as its estimate cost will be updated.
-        auto it = openNodes.find(&neighbor);
-        if (it !=
-            openNodes.end())  // /!\ ALWAYS use an iterator with multiset::erase
-          openNodes.erase(it);  // otherwise, other nodes which are equivalent
-                                // get removed too.
-      }
+      bool alreadyOpen = neighbor.smallestCost != -1;
 
       neighbor.smallestCost = currentNode.smallestCost +
                               (currentNode.cost + neighbor.cost) / 2.0 * factor;
@@ -366,15 +377,90 @@ class SearchContext {
       neighbor.estimateCost =
           neighbor.smallestCost + distanceFunction(neighbor.pos, destination);
 
-      openNodes.insert(&neighbor);
+      if (alreadyOpen)  // The node is already in the open list: move it
+        UpdateOpenNode(neighbor);  // according to its new estimate cost.
+      else
+        PushOpenNode(neighbor);
+    }
+  }
+
+  /**
+   * \brief Add a node to the open nodes heap.
+   */
+  void PushOpenNode(Node& node) {
+    node.openOrder = openNodesInsertionCount++;
+    node.heapIndex = openNodes.size();
+    openNodes.push_back(&node);
+    SiftUp(node.heapIndex);
+  }
+
+  /**
+   * \brief Remove the most promising node from the open nodes heap and
+   * return it.
+   */
+  Node* PopOpenNode() {
+    Node* node = openNodes.front();
+    openNodes.front() = openNodes.back();
+    openNodes.front()->heapIndex = 0;
+    openNodes.pop_back();
+    if (!openNodes.empty()) SiftDown(0);
+
+    return node;
+  }
+
+  /**
+   * \brief Restore the order of the open nodes heap after the estimate cost of
+   * a node it contains was changed.
+   */
+  void UpdateOpenNode(Node& node) {
+    node.openOrder = openNodesInsertionCount++;
+    SiftUp(node.heapIndex);
+    SiftDown(node.heapIndex);
+  }
+
+  void SiftUp(std::size_t index) {
+    Node* node = openNodes[index];
+    while (index > 0) {
+      std::size_t parentIndex = (index - 1) / 2;
+      if (!node->IsMorePromisingThan(*openNodes[parentIndex])) break;
+
+      openNodes[index] = openNodes[parentIndex];
+      openNodes[index]->heapIndex = index;
+      index = parentIndex;
+    }
+    openNodes[index] = node;
+    node->heapIndex = index;
+  }
+
+  void SiftDown(std::size_t index) {
+    Node* node = openNodes[index];
+    while (true) {
+      std::size_t childIndex = index * 2 + 1;
+      if (childIndex >= openNodes.size()) break;
+      if (childIndex + 1 < openNodes.size() &&
+          openNodes[childIndex + 1]->IsMorePromisingThan(
+              *openNodes[childIndex]))
+        childIndex++;
+      if (!openNodes[childIndex]->IsMorePromisingThan(*node)) break;
+
+      openNodes[index] = openNodes[childIndex];
+      openNodes[index]->heapIndex = index;
+      index = childIndex;
     }
+    openNodes[index] = node;
+    node->heapIndex = index;
   }
 
-  std::unordered_map<NodePosition, Node> allNodes;  ///< All the nodes
-  std::multiset<Node*, Node::NodeComparator>
-      openNodes;  ///< Only the open nodes (Such that Node::open == true)
-  const ScenePathfindingObstaclesManager&
-      obstacles;    ///< A reference to all the obstacles of the scene
+  std::unordered_map<NodePosition, Node*> allNodes;  ///< All the nodes
+  std::deque<Node> nodesPool;  ///< The storage of the nodes (in allNodes).
+  std::vector<Node*> openNodes;  ///< Only the open nodes (Such that Node::open
+                                 ///< == true), as a binary heap with the most
+                                 ///< promising node first.
+  std::size_t openNodesInsertionCount;
+  std::vector<ObstacleInfo>
+      closeObstacles;  ///< Used by GetNode to store the obstacles near a node.
+  const Obstacles& obstacles;  ///< A reference to all the obstacles of the
+                               ///< scene
   Node* finalNode;  // If computation succeeded, the final node is stored here.
   NodePosition destination;
   int startX;  ///< The start X position, in "world" coordinates (not in "node"
@@ -394,14 +480,66 @@ class SearchContext {
   static const float sqrt2;
 };
 
-const float SearchContext::sqrt2 = 1.414213562;
+template <typename Obstacles>
+const float SearchContext<Obstacles>::sqrt2 = 1.414213562;
+
+/**
+ * \brief Compute the path of a request, considering the specified obstacles.
+ */
+template <typename Obstacles>
+void ComputePathWithObstacles(const Obstacles& obstacles,
+                              PathfindingRequest& request) {
+  request.path.clear();
+
+  // First be sure that there is a path to compute.
+  int targetCellX = GDRound(request.targetX / (float)request.cellWidth);
+  int targetCellY = GDRound(request.targetY / (float)request.cellHeight);
+  int startCellX = GDRound(request.startX / (float)request.cellWidth);
+  int startCellY = GDRound(request.startY / (float)request.cellHeight);
+  if (startCellX == targetCellX && startCellY == targetCellY) {
+    request.path.push_back(sf::Vector2f(request.startX, request.startY));
+    request.path.push_back(sf::Vector2f(request.targetX, request.targetY));
+    request.pathFound = true;
+    return;
+  }
+
+  // Start searching for a path
+  // TODO: Customizable heuristic.
+  ::SearchContext<Obstacles> ctx(obstacles, request.allowDiagonals);
+  ctx.SetCellSize(request.cellWidth, request.cellHeight)
+      .SetStartPosition(request.startX, request.startY);
+  ctx.SetObjectSize(request.leftBorder,
+                    request.topBorder,
+                    request.rightBorder,
+                    request.bottomBorder);
+  if (ctx.ComputePathTo(request.targetX, request.targetY)) {
+    // Path found: memorize it
+    const ::Node* node = ctx.GetFinalNode();
+    while (node) {
+      request.path.push_back(
+          sf::Vector2f(node->pos.x * (float)request.cellWidth,
+                       node->pos.y * (float)request.cellHeight));
+      node = node->parent;
+    }
+
+    std::reverse(request.path.begin(), request.path.end());
+    request.path[0] = sf::Vector2f(request.startX, request.startY);
+    request.pathFound = true;
+    return;
+  }
+
+  // Not path found
+  request.pathFound = false;
+}
 
 }  // namespace
 
 PathfindingBehavior::PathfindingBehavior()
     : parentScene(NULL),
       sceneManager(NULL),
+      requestsManager(NULL),
       pathFound(false),
+      pathPending(false),
       allowDiagonals(true),
       acceleration(400),
       maxSpeed(200),
@@ -411,6 +549,7 @@ PathfindingBehavior::PathfindingBehavior()
       cellWidth(20),
       cellHeight(20),
       extraBorder(0),
+      asynchronous(false),
       speed(0),
       angularSpeed(0),
       timeOnSegment(0),
@@ -418,6 +557,10 @@ PathfindingBehavior::PathfindingBehavior()
       currentSegment(0),
       reachedEnd(false) {}
 
+PathfindingBehavior::~PathfindingBehavior() {
+  if (requestsManager && pathPending) requestsManager->CancelRequests(this);
+}
+
 void PathfindingBehavior::MoveTo(RuntimeScene& scene, float x, float y) {
   if (parentScene != &scene)  // Parent scene has changed
   {
@@ -425,53 +568,64 @@ void PathfindingBehavior::MoveTo(RuntimeScene& scene, float x, float y) {
     sceneManager = parentScene
                        ? &ScenePathfindingObstaclesManager::managers[&scene]
                        : NULL;
+    requestsManager = parentScene
+                          ? &ScenePathfindingRequestsManager::managers[&scene]
+                          : NULL;
   }
 
-  path.clear();
-
-  // First be sure that there is a path to compute.
-  int targetCellX = GDRound(x / (float)cellWidth);
-  int targetCellY = GDRound(y / (float)cellHeight);
-  int startCellX = GDRound(object->GetX() / (float)cellWidth);
-  int startCellY = GDRound(object->GetY() / (float)cellHeight);
-  if (startCellX == targetCellX && startCellY == targetCellY) {
-    path.push_back(sf::Vector2f(object->GetX(), object->GetY()));
-    path.push_back(sf::Vector2f(x, y));
-    EnterSegment(0);
-    pathFound = true;
+  PathfindingRequest request;
+  request.behavior = this;
+  request.startX = object->GetX();
+  request.startY = object->GetY();
+  request.targetX = x;
+  request.targetY = y;
+  request.leftBorder = object->GetX() - object->GetDrawableX() + extraBorder;
+  request.topBorder = object->GetY() - object->GetDrawableY() + extraBorder;
+  request.rightBorder = object->GetWidth() -
+                        (object->GetX() - object->GetDrawableX()) + extraBorder;
+  request.bottomBorder = object->GetHeight() -
+                         (object->GetY() - object->GetDrawableY()) +
+                         extraBorder;
+  request.cellWidth = cellWidth;
+  request.cellHeight = cellHeight;
+  request.allowDiagonals = allowDiagonals;
+
+  if (asynchronous) {
+    // Stop the object until the path is computed.
+    path.clear();
+    pathFound = false;
+    pathPending = true;
+    requestsManager->AddRequest(request);
     return;
   }
 
-  // Start searching for a path
-  // TODO: Customizable heuristic.
-  ::SearchContext ctx(*sceneManager, allowDiagonals);
-  ctx.SetCellSize(cellWidth, cellHeight)
-      .SetStartPosition(object->GetX(), object->GetY());
-  ctx.SetObjectSize(object->GetX() - object->GetDrawableX() + extraBorder,
-                    object->GetY() - object->GetDrawableY() + extraBorder,
-                    object->GetWidth() -
-                        (object->GetX() - object->GetDrawableX()) + extraBorder,
-                    object->GetHeight() -
-                        (object->GetY() - object->GetDrawableY()) +
-                        extraBorder);
-  if (ctx.ComputePathTo(x, y)) {
-    // Path found: memorize it
-    const ::Node* node = ctx.GetFinalNode();
-    while (node) {
-      path.push_back(sf::Vector2f(node->pos.x * (float)cellWidth,
-                                  node->pos.y * (float)cellHeight));
-      node = node->parent;
-    }
-
-    std::reverse(path.begin(), path.end());
-    path[0] = sf::Vector2f(object->GetX(), object->GetY());
-    EnterSegment(0);
-    pathFound = true;
-    return;
+  if (pathPending) {
+    requestsManager->CancelRequests(this);
+    pathPending = false;
   }
+  // Obstacles can have been moved by the events since they were last stepped.
+  sceneManager->UpdateObstaclesMovedByEvents();
+  ComputePath(*sceneManager, request);
+  OnPathComputed(request);
+}
 
-  // Not path found
-  pathFound = false;
+void PathfindingBehavior::ComputePath(
+    const ScenePathfindingObstaclesManager& obstacles,
+    PathfindingRequest& request) {
+  ComputePathWithObstacles(obstacles, request);
+}
+
+void PathfindingBehavior::ComputePath(
+    const ScenePathfindingObstaclesManager::Snapshot& obstacles,
+    PathfindingRequest& request) {
+  ComputePathWithObstacles(obstacles, request);
+}
+
+void PathfindingBehavior::OnPathComputed(PathfindingRequest& request) {
+  pathPending = false;
+  pathFound = request.pathFound;
+  path.swap(request.path);
+  if (pathFound) EnterSegment(0);
 }
 
 void PathfindingBehavior::EnterSegment(std::size_t segmentNumber) {
@@ -496,10 +650,16 @@ void PathfindingBehavior::DoStepPreEvents(RuntimeScene& scene) {
     sceneManager = parentScene
                        ? &ScenePathfindingObstaclesManager::managers[&scene]
                        : NULL;
+    requestsManager = parentScene
+                          ? &ScenePathfindingRequestsManager::managers[&scene]
+                          : NULL;
   }
 
   if (!sceneManager) return;
 
+  // Paths requested during the last frame are now computed.
+  requestsManager->DeliverResults();
+
   if (path.empty() || reachedEnd) return;
 
   // Update the speed of the object
@@ -542,7 +702,13 @@ void PathfindingBehavior::DoStepPostEvents(RuntimeScene& scene) {
     sceneManager = parentScene
                        ? &ScenePathfindingObstaclesManager::managers[&scene]
                        : NULL;
+    requestsManager = parentScene
+                          ? &ScenePathfindingRequestsManager::managers[&scene]
+                          : NULL;
   }
+
+  // Compute in the background the paths requested during the events.
+  if (sceneManager) requestsManager->LaunchRequests(*sceneManager);
 }
 
 float PathfindingBehavior::GetNodeX(std::size_t index) const {
@@ -609,6 +775,7 @@ void PathfindingBehavior::UnserializeFrom(
   rotateObject = element.GetBoolAttribute("rotateObject");
   angleOffset = element.GetDoubleAttribute("angleOffset");
   extraBorder = element.GetDoubleAttribute("extraBorder");
+  asynchronous = element.GetBoolAttribute("asynchronous", false);
   {
     int value = element.GetIntAttribute("cellWidth", 0);
     if (value > 0) cellWidth = value;
@@ -630,6 +797,7 @@ void PathfindingBehavior::SerializeTo(gd::SerializerElement& element) const {
   element.SetAttribute("cellWidth", (int)cellWidth);
   element.SetAttribute("cellHeight", (int)cellHeight);
   element.SetAttribute("extraBorder", extraBorder);
+  element.SetAttribute("asynchronous", asynchronous);
 }
 
 std::map<gd::String, gd::PropertyDescriptor> PathfindingBehavior::GetProperties(
@@ -649,6 +817,13 @@ std::map<gd::String, gd::PropertyDescriptor> PathfindingBehavior::GetProperties(
   properties[_("Virtual cell width")].SetValue(gd::String::From(cellWidth));
   properties[_("Virtual cell height")].SetValue(gd::String::From(cellHeight));
   properties[_("Extra border size")].SetValue(gd::String::From(extraBorder));
+#if !defined(EMSCRIPTEN)
+  // Paths are always computed synchronously by the JS runtime, used by the
+  // web-based IDE.
+  properties[_("Compute paths in the background")]
+      .SetValue(asynchronous ? "true" : "false")
+      .SetType("Boolean");
+#endif
 
   return properties;
 }
@@ -664,6 +839,10 @@ bool PathfindingBehavior::UpdateProperty(const gd::String& name,
     rotateObject = (value != "0");
     return true;
   }
+  if (name == _("Compute paths in the background")) {
+    asynchronous = (value != "0");
+    return true;
+  }
   if (name == _("Extra border size")) {
     extraBorder = value.To<float>();
     return true;
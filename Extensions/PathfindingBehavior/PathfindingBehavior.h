@@ -11,12 +11,14 @@ This project is released under the MIT License.
 #include <vector>
 #include "GDCpp/Runtime/Project/Behavior.h"
 #include "GDCpp/Runtime/Project/Object.h"
+#include "ScenePathfindingObstaclesManager.h"
 namespace gd {
 class Layout;
 }
 class RuntimeScene;
 class PlatformBehavior;
-class ScenePathfindingObstaclesManager;
+class ScenePathfindingRequestsManager;
+struct PathfindingRequest;
 namespace gd {
 class SerializerElement;
 }
@@ -28,20 +30,51 @@ class RuntimeScenePlatformData;
 class GD_EXTENSION_API PathfindingBehavior : public Behavior {
  public:
   PathfindingBehavior();
-  virtual ~PathfindingBehavior(){};
-  virtual Behavior* Clone() const { return new PathfindingBehavior(*this); }
+  virtual ~PathfindingBehavior();
+  virtual Behavior* Clone() const {
+    PathfindingBehavior* clone = new PathfindingBehavior(*this);
+    clone->pathPending = false;  // The requests are not shared with the clone.
+    return clone;
+  }
 
   /**
    * \brief Compute and move on the path to the specified destination.
+   *
+   * If paths are computed asynchronously, the object stops and the path is
+   * computed in the background: it is available at the beginning of the next
+   * frame.
+   *
+   * \see PathfindingBehavior::SetAsynchronous
    */
   void MoveTo(RuntimeScene& scene, float x, float y);
 
   // Path information:
   /**
-   * \brief Return true if the latest call to MoveTo succeeded.
+   * \brief Return true if the latest call to MoveTo succeeded (false while
+   * the path is being computed).
    */
   bool PathFound() { return pathFound; }
 
+  /**
+   * \brief Return true if the path requested by the latest call to MoveTo is
+   * still being computed in the background.
+   */
+  bool IsPathPending() const { return pathPending; }
+
+  /**
+   * \brief Compute the path of a request with the obstacles as they are now.
+   */
+  static void ComputePath(const ScenePathfindingObstaclesManager& obstacles,
+                          PathfindingRequest& request);
+
+  /**
+   * \brief Compute the path of a request with a snapshot of the obstacles.
+   * \note Can be called from any thread.
+   */
+  static void ComputePath(
+      const ScenePathfindingObstaclesManager::Snapshot& obstacles,
+      PathfindingRequest& request);
+
   /**
    * \brief Return true if the object reached its destination
    */
@@ -68,6 +101,7 @@ class GD_EXTENSION_API PathfindingBehavior : public Behavior {
   unsigned int GetCellWidth() { return cellWidth; };
   unsigned int GetCellHeight() { return cellHeight; };
   float GetExtraBorder() { return extraBorder; };
+  bool IsAsynchronous() { return asynchronous; };
 
   void SetAllowDiagonals(bool allowDiagonals_) {
     allowDiagonals = allowDiagonals_;
@@ -82,6 +116,7 @@ class GD_EXTENSION_API PathfindingBehavior : public Behavior {
   void SetCellWidth(unsigned int cellWidth_) { cellWidth = cellWidth_; };
   void SetCellHeight(unsigned int cellHeight_) { cellHeight = cellHeight_; };
   void SetExtraBorder(float extraBorder_) { extraBorder = extraBorder_; };
+  void SetAsynchronous(bool asynchronous_) { asynchronous = asynchronous_; };
 
   float GetSpeed() { return speed; };
   void SetSpeed(float speed_) { speed = speed_; };
@@ -105,15 +140,25 @@ class GD_EXTENSION_API PathfindingBehavior : public Behavior {
 #endif
 
  private:
+  friend class ScenePathfindingRequestsManager;
+
   virtual void DoStepPreEvents(RuntimeScene& scene);
   virtual void DoStepPostEvents(RuntimeScene& scene);
   void EnterSegment(std::size_t segmentNumber);
 
+  /**
+   * \brief Start moving on the path computed for a request.
+   */
+  void OnPathComputed(PathfindingRequest& request);
+
   RuntimeScene* parentScene;  ///< The scene the object belongs to.
   ScenePathfindingObstaclesManager*
       sceneManager;  ///< The platform objects manager associated to the scene.
+  ScenePathfindingRequestsManager*
+      requestsManager;  ///< The manager computing the paths asynchronously.
   std::vector<sf::Vector2f> path;  ///< The computed path
   bool pathFound;
+  bool pathPending;  ///< true if a path is being computed in the background.
 
   // Behavior configuration:
   bool allowDiagonals;
@@ -127,6 +172,7 @@ class GD_EXTENSION_API PathfindingBehavior : public Behavior {
   unsigned int cellWidth;
   unsigned int cellHeight;
   float extraBorder;
+  bool asynchronous;  ///< If true, paths are computed in the background.
 
   // Attributes used for traveling on the path:
   float speed;
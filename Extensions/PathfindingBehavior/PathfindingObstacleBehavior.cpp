@@ -52,9 +52,15 @@ void PathfindingObstacleBehavior::DoStepPreEvents(RuntimeScene& scene) {
       registeredInManager = true;
     }
   }
+
+  // Track changes in size or position
+  if (registeredInManager && sceneManager) sceneManager->UpdateObstacle(this);
 }
 
-void PathfindingObstacleBehavior::DoStepPostEvents(RuntimeScene& scene) {}
+void PathfindingObstacleBehavior::DoStepPostEvents(RuntimeScene& scene) {
+  // Track changes in size or position made by the events
+  if (registeredInManager && sceneManager) sceneManager->UpdateObstacle(this);
+}
 
 void PathfindingObstacleBehavior::OnActivate() {
   if (sceneManager) {
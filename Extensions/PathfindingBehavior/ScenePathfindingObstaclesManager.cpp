@@ -5,11 +5,15 @@ Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
 This project is released under the MIT License.
 */
 #include "ScenePathfindingObstaclesManager.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include "PathfindingObstacleBehavior.h"
 
 std::map<RuntimeScene*, ScenePathfindingObstaclesManager>
     ScenePathfindingObstaclesManager::managers;
+const float ScenePathfindingObstaclesManager::cellSize = 128;
+const int ScenePathfindingObstaclesManager::maxCellsPerObstacle = 256;
 
 ScenePathfindingObstaclesManager::~ScenePathfindingObstaclesManager() {
   for (std::set<PathfindingObstacleBehavior*>::iterator it =
@@ -22,9 +26,205 @@ ScenePathfindingObstaclesManager::~ScenePathfindingObstaclesManager() {
 
 void ScenePathfindingObstaclesManager::AddObstacle(
     PathfindingObstacleBehavior* obstacle) {
-  allObstacles.insert(obstacle);
+  if (!allObstacles.insert(obstacle).second) return;  // Already added.
+
+  ObstacleCells& cells = obstaclesCells[obstacle];
+  cells.box = GetBoundingBox(*obstacle);
+  InsertInCells(obstacle, cells);
 }
+
 void ScenePathfindingObstaclesManager::RemoveObstacle(
     PathfindingObstacleBehavior* obstacle) {
+  auto it = obstaclesCells.find(obstacle);
+  if (it != obstaclesCells.end()) {
+    RemoveFromCells(obstacle, it->second);
+    obstaclesCells.erase(it);
+  }
+
   allObstacles.erase(obstacle);
 }
+
+void ScenePathfindingObstaclesManager::UpdateObstacle(
+    PathfindingObstacleBehavior* obstacle) {
+  // The obstacles are stepped: the events can move them again.
+  movedByEventsUpdated = false;
+
+  auto it = obstaclesCells.find(obstacle);
+  if (it == obstaclesCells.end()) return;
+
+  ObstacleCells& cells = it->second;
+  sf::FloatRect box = GetBoundingBox(*obstacle);
+  if (box.left == cells.box.left && box.top == cells.box.top &&
+      box.width == cells.box.width && box.height == cells.box.height)
+    return;
+
+  RemoveFromCells(obstacle, cells);
+  cells.box = box;
+  InsertInCells(obstacle, cells);
+}
+
+void ScenePathfindingObstaclesManager::UpdateObstaclesMovedByEvents() {
+  if (movedByEventsUpdated) return;
+
+  for (PathfindingObstacleBehavior* obstacle : allObstacles)
+    UpdateObstacle(obstacle);
+  movedByEventsUpdated = true;
+}
+
+void ScenePathfindingObstaclesManager::GetAllObstaclesAround(
+    const sf::FloatRect& area,
+    std::vector<PathfindingObstacleBehavior*>& result) const {
+  result.insert(result.end(), largeObstacles.begin(), largeObstacles.end());
+
+  if (!ForEachInCells(grid,
+                      area,
+                      [&result](PathfindingObstacleBehavior* obstacle) {
+                        result.push_back(obstacle);
+                      })) {
+    // The area is too large: return all the obstacles stored in the cells.
+    for (const auto& obstacleCells : obstaclesCells) {
+      if (!obstacleCells.second.large) result.push_back(obstacleCells.first);
+    }
+  }
+}
+
+void ScenePathfindingObstaclesManager::GetAllObstaclesAround(
+    const sf::FloatRect& area, std::vector<ObstacleInfo>& result) const {
+  for (PathfindingObstacleBehavior* obstacle : largeObstacles)
+    result.push_back(GetObstacleInfo(*obstacle));
+
+  if (!ForEachInCells(grid,
+                      area,
+                      [&result](PathfindingObstacleBehavior* obstacle) {
+                        result.push_back(GetObstacleInfo(*obstacle));
+                      })) {
+    for (const auto& obstacleCells : obstaclesCells) {
+      if (!obstacleCells.second.large)
+        result.push_back(GetObstacleInfo(*obstacleCells.first));
+    }
+  }
+}
+
+void ScenePathfindingObstaclesManager::TakeSnapshot(Snapshot& snapshot) const {
+  // Keep the memory of the previous snapshot to be reused.
+  snapshot.obstacles.clear();
+  snapshot.largeObstacles.clear();
+  for (auto& cell : snapshot.grid) cell.second.clear();
+
+  for (PathfindingObstacleBehavior* obstacle : allObstacles) {
+    std::size_t index = snapshot.obstacles.size();
+    snapshot.obstacles.push_back(GetObstacleInfo(*obstacle));
+
+    int minCellX, minCellY, maxCellX, maxCellY;
+    if (GetCellsRange(snapshot.obstacles.back().box,
+                      minCellX,
+                      minCellY,
+                      maxCellX,
+                      maxCellY))
+      InsertInGrid(
+          snapshot.grid, index, minCellX, minCellY, maxCellX, maxCellY);
+    else
+      snapshot.largeObstacles.push_back(index);
+  }
+}
+
+void ScenePathfindingObstaclesManager::Snapshot::GetAllObstaclesAround(
+    const sf::FloatRect& area, std::vector<ObstacleInfo>& result) const {
+  if (!ForEachInCells(grid, area, [this, &result](std::size_t index) {
+        result.push_back(obstacles[index]);
+      })) {
+    // The area is too large: return all the obstacles.
+    result.insert(result.end(), obstacles.begin(), obstacles.end());
+    return;
+  }
+
+  for (std::size_t index : largeObstacles) result.push_back(obstacles[index]);
+}
+
+bool ScenePathfindingObstaclesManager::GetCellsRange(const sf::FloatRect& box,
+                                                     int& minCellX,
+                                                     int& minCellY,
+                                                     int& maxCellX,
+                                                     int& maxCellY) {
+  float minX = std::floor(std::min(box.left, box.left + box.width) / cellSize);
+  float minY = std::floor(std::min(box.top, box.top + box.height) / cellSize);
+  float maxX = std::floor(std::max(box.left, box.left + box.width) / cellSize);
+  float maxY = std::floor(std::max(box.top, box.top + box.height) / cellSize);
+
+  // Also reject NaN and infinite coordinates.
+  if (!((maxX - minX + 1) * (maxY - minY + 1) <= maxCellsPerObstacle))
+    return false;
+
+  minCellX = static_cast<int>(minX);
+  minCellY = static_cast<int>(minY);
+  maxCellX = static_cast<int>(maxX);
+  maxCellY = static_cast<int>(maxY);
+  return true;
+}
+
+sf::FloatRect ScenePathfindingObstaclesManager::GetBoundingBox(
+    const PathfindingObstacleBehavior& obstacle) {
+  const RuntimeObject* object = obstacle.GetObject();
+  return sf::FloatRect(object->GetDrawableX(),
+                       object->GetDrawableY(),
+                       object->GetWidth(),
+                       object->GetHeight());
+}
+
+ScenePathfindingObstaclesManager::ObstacleInfo
+ScenePathfindingObstaclesManager::GetObstacleInfo(
+    const PathfindingObstacleBehavior& obstacle) {
+  ObstacleInfo info;
+  info.box = GetBoundingBox(obstacle);
+  info.impassable = obstacle.IsImpassable();
+  info.cost = obstacle.GetCost();
+  return info;
+}
+
+void ScenePathfindingObstaclesManager::InsertInCells(
+    PathfindingObstacleBehavior* obstacle, ObstacleCells& cells) {
+  cells.large = !GetCellsRange(cells.box,
+                               cells.minCellX,
+                               cells.minCellY,
+                               cells.maxCellX,
+                               cells.maxCellY);
+  if (cells.large) {
+    largeObstacles.push_back(obstacle);
+    return;
+  }
+
+  InsertInGrid(grid,
+               obstacle,
+               cells.minCellX,
+               cells.minCellY,
+               cells.maxCellX,
+               cells.maxCellY);
+}
+
+void ScenePathfindingObstaclesManager::RemoveFromCells(
+    PathfindingObstacleBehavior* obstacle, const ObstacleCells& cells) {
+  if (cells.large) {
+    largeObstacles.erase(
+        std::remove(largeObstacles.begin(), largeObstacles.end(), obstacle),
+        largeObstacles.end());
+    return;
+  }
+
+  for (int x = cells.minCellX; x <= cells.maxCellX; ++x) {
+    for (int y = cells.minCellY; y <= cells.maxCellY; ++y) {
+      auto cell = grid.find(GetCellKey(x, y));
+      if (cell == grid.end()) continue;
+
+      std::vector<CellEntry<PathfindingObstacleBehavior*>>& entries =
+          cell->second;
+      for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].value == obstacle) {
+          entries[i] = entries.back();
+          entries.pop_back();
+          break;
+        }
+      }
+      if (entries.empty()) grid.erase(cell);
+    }
+  }
+}
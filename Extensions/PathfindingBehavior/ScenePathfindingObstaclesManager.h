@@ -6,23 +6,45 @@ This project is released under the MIT License.
 */
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
+#include <SFML/Graphics/Rect.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 #include "GDCpp/Runtime/RuntimeScene.h"
 class PathfindingObstacleBehavior;
 
 /**
  * \brief Contains lists of all obstacle related objects of a scene.
+ *
+ * Obstacles are also stored in a grid, according to their bounding box, so
+ * that the obstacles around a position can be found without iterating on all
+ * of them. Obstacles behaviors call UpdateObstacle when they are stepped, and
+ * UpdateObstaclesMovedByEvents must be called before searching for obstacles
+ * during the events.
  */
 class ScenePathfindingObstaclesManager {
  public:
+  class Snapshot;
+
+  /**
+   * \brief The information about an obstacle used to compute paths.
+   */
+  struct ObstacleInfo {
+    sf::FloatRect box;  ///< The bounding box of the object of the obstacle.
+    bool impassable;
+    float cost;
+  };
+
   /**
    * \brief Map containing, for each RuntimeScene, its associated
    * ScenePathfindingObstaclesManager.
    */
   static std::map<RuntimeScene*, ScenePathfindingObstaclesManager> managers;
 
-  ScenePathfindingObstaclesManager(){};
+  ScenePathfindingObstaclesManager() : movedByEventsUpdated(false){};
   virtual ~ScenePathfindingObstaclesManager();
 
   /**
@@ -37,6 +59,47 @@ class ScenePathfindingObstaclesManager {
    */
   void RemoveObstacle(PathfindingObstacleBehavior* obstacle);
 
+  /**
+   * \brief Update the position of the obstacle in the grid, if its object was
+   * moved or resized since it was added or last updated.
+   * \param obstacle The obstacle, which must have been added before.
+   */
+  void UpdateObstacle(PathfindingObstacleBehavior* obstacle);
+
+  /**
+   * \brief Update the position in the grid of the obstacles moved or resized
+   * by the events since the obstacles behaviors were last stepped.
+   *
+   * The obstacles are only checked the first time this is called after the
+   * obstacles behaviors were stepped, so that it can be called before each
+   * search without iterating on all the obstacles each time. An obstacle moved
+   * after this during the same events is found at its new position once its
+   * behavior is stepped.
+   */
+  void UpdateObstaclesMovedByEvents();
+
+  /**
+   * \brief Add to \a result the obstacles that may be overlapping the
+   * specified area (considering their position when they were last updated).
+   *
+   * Each obstacle is added at most once. \a result is not cleared first.
+   */
+  void GetAllObstaclesAround(
+      const sf::FloatRect& area,
+      std::vector<PathfindingObstacleBehavior*>& result) const;
+
+  /**
+   * \brief Same as GetAllObstaclesAround, but add to \a result the information
+   * about the obstacles, as they are now.
+   */
+  void GetAllObstaclesAround(const sf::FloatRect& area,
+                             std::vector<ObstacleInfo>& result) const;
+
+  /**
+   * \brief Copy the obstacles, as they are now, into \a snapshot.
+   */
+  void TakeSnapshot(Snapshot& snapshot) const;
+
   /**
    * \brief Get a read only access to the list of all obstacles
    */
@@ -45,8 +108,147 @@ class ScenePathfindingObstaclesManager {
   }
 
  private:
+  /**
+   * \brief The cells covered by the bounding box of an obstacle.
+   */
+  struct ObstacleCells {
+    sf::FloatRect box;  ///< The bounding box used to compute the cells.
+    bool large;         ///< true if the obstacle is not stored in the cells.
+    int minCellX, minCellY, maxCellX, maxCellY;
+  };
+
+  /**
+   * \brief An obstacle (or the index of an obstacle) stored in a cell of a
+   * grid.
+   */
+  template <typename T>
+  struct CellEntry {
+    T value;
+    int minCellX;  ///< The first cell of the obstacle, used to return
+    int minCellY;  ///< the obstacle only once when querying several cells.
+  };
+
+  template <typename T>
+  using Grid = std::unordered_map<std::int64_t, std::vector<CellEntry<T>>>;
+
+  static std::int64_t GetCellKey(int x, int y) {
+    return (static_cast<std::int64_t>(x) << 32) ^
+           static_cast<std::int64_t>(static_cast<std::uint32_t>(y));
+  }
+
+  /**
+   * \brief Compute the range of cells covered by a box.
+   * \return false if the box covers too many cells (or is invalid) to be
+   * stored in the cells.
+   */
+  static bool GetCellsRange(const sf::FloatRect& box,
+                            int& minCellX,
+                            int& minCellY,
+                            int& maxCellX,
+                            int& maxCellY);
+
+  /**
+   * \brief Store \a value in all the cells of the range.
+   */
+  template <typename T>
+  static void InsertInGrid(Grid<T>& grid,
+                           const T& value,
+                           int minCellX,
+                           int minCellY,
+                           int maxCellX,
+                           int maxCellY) {
+    CellEntry<T> entry;
+    entry.value = value;
+    entry.minCellX = minCellX;
+    entry.minCellY = minCellY;
+    for (int x = minCellX; x <= maxCellX; ++x) {
+      for (int y = minCellY; y <= maxCellY; ++y)
+        grid[GetCellKey(x, y)].push_back(entry);
+    }
+  }
+
+  /**
+   * \brief Call \a callback with each value stored in the cells covered by the
+   * area. Each value is passed only once.
+   * \return false, without calling \a callback, if the area covers too many
+   * cells.
+   */
+  template <typename T, typename Callback>
+  static bool ForEachInCells(const Grid<T>& grid,
+                             const sf::FloatRect& area,
+                             Callback callback) {
+    int minCellX, minCellY, maxCellX, maxCellY;
+    if (!GetCellsRange(area, minCellX, minCellY, maxCellX, maxCellY))
+      return false;
+
+    for (int x = minCellX; x <= maxCellX; ++x) {
+      for (int y = minCellY; y <= maxCellY; ++y) {
+        auto cell = grid.find(GetCellKey(x, y));
+        if (cell == grid.end()) continue;
+
+        for (const CellEntry<T>& entry : cell->second) {
+          // A value stored in several cells of the area is only passed when
+          // visiting the first of these cells.
+          if (x == std::max(entry.minCellX, minCellX) &&
+              y == std::max(entry.minCellY, minCellY))
+            callback(entry.value);
+        }
+      }
+    }
+    return true;
+  }
+
+  static sf::FloatRect GetBoundingBox(
+      const PathfindingObstacleBehavior& obstacle);
+  static ObstacleInfo GetObstacleInfo(
+      const PathfindingObstacleBehavior& obstacle);
+
+  void InsertInCells(PathfindingObstacleBehavior* obstacle,
+                     ObstacleCells& cells);
+  void RemoveFromCells(PathfindingObstacleBehavior* obstacle,
+                       const ObstacleCells& cells);
+
   std::set<PathfindingObstacleBehavior*>
       allObstacles;  ///< The list of all obstacles of the scene.
+  std::unordered_map<PathfindingObstacleBehavior*, ObstacleCells>
+      obstaclesCells;  ///< The cells where each obstacle is stored.
+  Grid<PathfindingObstacleBehavior*>
+      grid;  ///< The obstacles overlapping each cell.
+  std::vector<PathfindingObstacleBehavior*>
+      largeObstacles;  ///< The obstacles covering too many cells.
+  bool movedByEventsUpdated;  ///< true if UpdateObstaclesMovedByEvents was
+                              ///< called since an obstacle was last stepped.
+
+  static const float cellSize;
+  static const int maxCellsPerObstacle;
+};
+
+/**
+ * \brief An immutable copy of the obstacles of a scene, that can be used to
+ * compute paths in other threads while the scene is running.
+ *
+ * \see ScenePathfindingObstaclesManager::TakeSnapshot
+ */
+class ScenePathfindingObstaclesManager::Snapshot {
+ public:
+  /**
+   * \brief Add to \a result the obstacles that may be overlapping the
+   * specified area.
+   *
+   * Each obstacle is added at most once. \a result is not cleared first.
+   */
+  void GetAllObstaclesAround(const sf::FloatRect& area,
+                             std::vector<ObstacleInfo>& result) const;
+
+ private:
+  friend class ScenePathfindingObstaclesManager;
+
+  std::vector<ObstacleInfo> obstacles;
+  Grid<std::size_t> grid;  ///< The indices of the obstacles overlapping each
+                           ///< cell.
+  std::vector<std::size_t>
+      largeObstacles;  ///< The indices of the obstacles covering too many
+                       ///< cells.
 };
 
 #endif
@@ -0,0 +1,109 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+#include "ScenePathfindingRequestsManager.h"
+#include <algorithm>
+#include "PathfindingBehavior.h"
+
+std::map<RuntimeScene*, ScenePathfindingRequestsManager>
+    ScenePathfindingRequestsManager::managers;
+
+ScenePathfindingRequestsManager::~ScenePathfindingRequestsManager() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  requestsLaunched.notify_all();
+
+  for (std::thread& worker : workers) worker.join();
+}
+
+void ScenePathfindingRequestsManager::AddRequest(
+    const PathfindingRequest& request) {
+  for (PathfindingRequest& pendingRequest : pendingRequests) {
+    if (pendingRequest.behavior == request.behavior) {
+      pendingRequest = request;
+      return;
+    }
+  }
+
+  pendingRequests.push_back(request);
+}
+
+void ScenePathfindingRequestsManager::CancelRequests(
+    const PathfindingBehavior* behavior) {
+  pendingRequests.erase(
+      std::remove_if(pendingRequests.begin(),
+                     pendingRequests.end(),
+                     [behavior](const PathfindingRequest& request) {
+                       return request.behavior == behavior;
+                     }),
+      pendingRequests.end());
+
+  // Workers never read the behavior of the requests, so it can be changed
+  // while they are running.
+  for (PathfindingRequest& request : launchedRequests) {
+    if (request.behavior == behavior) request.behavior = NULL;
+  }
+}
+
+void ScenePathfindingRequestsManager::LaunchRequests(
+    const ScenePathfindingObstaclesManager& obstacles) {
+  if (pendingRequests.empty()) return;
+
+  DeliverResults();  // Make sure that the previous requests are finished.
+
+  obstacles.TakeSnapshot(obstaclesSnapshot);
+  launchedRequests.swap(pendingRequests);
+
+  StartWorkers();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    nextRequest = 0;
+    requestsCount = launchedRequests.size();
+    remainingRequests = launchedRequests.size();
+  }
+  requestsLaunched.notify_all();
+}
+
+void ScenePathfindingRequestsManager::DeliverResults() {
+  WaitForWorkers();
+
+  for (PathfindingRequest& request : launchedRequests) {
+    if (request.behavior) request.behavior->OnPathComputed(request);
+  }
+  launchedRequests.clear();
+}
+
+void ScenePathfindingRequestsManager::StartWorkers() {
+  if (!workers.empty()) return;
+
+  std::size_t workersCount = std::max(1u, std::thread::hardware_concurrency());
+  for (std::size_t i = 0; i < workersCount; ++i)
+    workers.push_back(std::thread(&ScenePathfindingRequestsManager::Work, this));
+}
+
+void ScenePathfindingRequestsManager::WaitForWorkers() {
+  std::unique_lock<std::mutex> lock(mutex);
+  requestsComputed.wait(lock, [this]() { return remainingRequests == 0; });
+}
+
+void ScenePathfindingRequestsManager::Work() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    requestsLaunched.wait(
+        lock, [this]() { return stopping || nextRequest < requestsCount; });
+    if (stopping) return;
+
+    // The launched requests are not modified until they are all computed.
+    std::size_t i = nextRequest++;
+    lock.unlock();
+    PathfindingBehavior::ComputePath(obstaclesSnapshot, launchedRequests[i]);
+    lock.lock();
+
+    if (--remainingRequests == 0) requestsComputed.notify_all();
+  }
+}
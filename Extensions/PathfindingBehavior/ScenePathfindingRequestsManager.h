@@ -0,0 +1,120 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+#ifndef SCENEPATHFINDINGREQUESTSMANAGER_H
+#define SCENEPATHFINDINGREQUESTSMANAGER_H
+#include <SFML/System/Vector2.hpp>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ScenePathfindingObstaclesManager.h"
+class PathfindingBehavior;
+class RuntimeScene;
+
+/**
+ * \brief A path to be computed for a PathfindingBehavior, and the result of
+ * the computation.
+ */
+struct PathfindingRequest {
+  PathfindingBehavior* behavior;  ///< The behavior that made the request, or
+                                  ///< NULL if the request was cancelled.
+  float startX;
+  float startY;
+  float targetX;
+  float targetY;
+  float leftBorder;  ///< The size of the object around its position.
+  float topBorder;
+  float rightBorder;
+  float bottomBorder;
+  unsigned int cellWidth;
+  unsigned int cellHeight;
+  bool allowDiagonals;
+
+  bool pathFound;  ///< Set when the path is computed.
+  std::vector<sf::Vector2f> path;  ///< Set when the path is computed.
+};
+
+/**
+ * \brief Compute in the background the paths requested by the
+ * PathfindingBehavior of a scene using the asynchronous mode.
+ *
+ * Paths requested during a frame are all computed at once, by a pool of
+ * threads, using a snapshot of the obstacles taken at the end of the events.
+ * The results are given to the behaviors at the beginning of the next frame.
+ *
+ * The threads are started the first time requests are launched, and wait for
+ * the next requests until the manager is destroyed.
+ */
+class ScenePathfindingRequestsManager {
+ public:
+  /**
+   * \brief Map containing, for each RuntimeScene, its associated
+   * ScenePathfindingRequestsManager.
+   */
+  static std::map<RuntimeScene*, ScenePathfindingRequestsManager> managers;
+
+  ScenePathfindingRequestsManager()
+      : nextRequest(0),
+        requestsCount(0),
+        remainingRequests(0),
+        stopping(false){};
+  virtual ~ScenePathfindingRequestsManager();
+
+  /**
+   * \brief Add a request to be computed. A request not yet launched of the same
+   * behavior is replaced.
+   */
+  void AddRequest(const PathfindingRequest& request);
+
+  /**
+   * \brief Cancel the requests of the behavior. To be called when the behavior
+   * is destroyed.
+   */
+  void CancelRequests(const PathfindingBehavior* behavior);
+
+  /**
+   * \brief Start computing the requests added since the last launch, in other
+   * threads, with the obstacles as they are now.
+   */
+  void LaunchRequests(const ScenePathfindingObstaclesManager& obstacles);
+
+  /**
+   * \brief Wait for the launched requests to be computed and give the paths
+   * to the behaviors that requested them.
+   */
+  void DeliverResults();
+
+ private:
+  void StartWorkers();
+  void WaitForWorkers();
+  void Work();
+
+  std::vector<PathfindingRequest>
+      pendingRequests;  ///< The requests not yet launched.
+  std::vector<PathfindingRequest>
+      launchedRequests;  ///< The requests being computed by the workers.
+  ScenePathfindingObstaclesManager::Snapshot
+      obstaclesSnapshot;  ///< The obstacles used by the workers.
+  std::vector<std::thread> workers;
+
+  std::mutex mutex;  ///< Protects the members below, shared with the workers.
+  std::condition_variable
+      requestsLaunched;  ///< Notified when requests are launched or when the
+                         ///< workers must stop.
+  std::condition_variable
+      requestsComputed;  ///< Notified when the last launched request is
+                         ///< computed.
+  std::size_t nextRequest;  ///< The index of the next launched request to
+                            ///< compute.
+  std::size_t requestsCount;      ///< The number of launched requests.
+  std::size_t remainingRequests;  ///< The number of launched requests not yet
+                                  ///< computed.
+  bool stopping;  ///< true when the workers must stop.
+};
+
+#endif
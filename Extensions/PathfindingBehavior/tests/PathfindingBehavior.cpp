@@ -19,6 +19,7 @@ This project is released under the MIT License.
 #include "GDCpp/Extensions/Builtin/ObjectTools.h"
 #include "../PathfindingBehavior.h"
 #include "../PathfindingObstacleBehavior.h"
+#include "../ScenePathfindingObstaclesManager.h"
 
 //Mock objects that can have a specific size
 class ResizableRuntimeObject : public RuntimeObject {
@@ -193,4 +194,113 @@ TEST_CASE( "PathfindingBehavior", "[game-engine][pathfinding]" ) {
 		REQUIRE(runtimeBehavior->GetNodeX(4) == 20);
 		REQUIRE(runtimeBehavior->GetNodeY(4) == 80);
 	}
+	SECTION("Asynchronous paths") {
+		RuntimeGame game;
+
+		gd::Object playerObj("player");
+		auto behavior = new PathfindingBehavior();
+		behavior->SetName("Pathfinding");
+		playerObj.AddBehavior(behavior);
+
+		gd::Object obstacleObj("obstacle");
+		obstacleObj.AddBehavior(new PathfindingObstacleBehavior());
+
+		RuntimeScene scene(NULL, &game);
+		auto * player = scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, playerObj)));
+		auto * obstacle = scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new ResizableRuntimeObject(scene, obstacleObj)));
+
+		obstacle->SetX(300);
+		obstacle->SetY(600);
+		obstacle->SetWidth(600);
+		obstacle->SetHeight(32);
+		scene.RenderAndStep();
+
+		PathfindingBehavior * runtimeBehavior =
+			static_cast<PathfindingBehavior *>(player->GetBehaviorRawPointer("Pathfinding"));
+		runtimeBehavior->SetAsynchronous(true);
+
+		//The path is computed in the background...
+		runtimeBehavior->MoveTo(scene, 1200, 1300);
+		REQUIRE(runtimeBehavior->IsPathPending() == true);
+		REQUIRE(runtimeBehavior->PathFound() == false);
+		scene.RenderAndStep();
+
+		//...and given to the behavior at the beginning of the next frame.
+		scene.RenderAndStep();
+		REQUIRE(runtimeBehavior->IsPathPending() == false);
+		REQUIRE(runtimeBehavior->PathFound() == true);
+		REQUIRE(runtimeBehavior->GetNodeCount() == 77);
+	}
+	SECTION("Obstacles grid") {
+		RuntimeGame game;
+
+		gd::Object obstacleObj("obstacle");
+		obstacleObj.AddBehavior(new PathfindingObstacleBehavior());
+
+		RuntimeScene scene(NULL, &game);
+		auto * obstacle1 = scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new ResizableRuntimeObject(scene, obstacleObj)));
+		auto * obstacle2 = scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new ResizableRuntimeObject(scene, obstacleObj)));
+
+		obstacle1->SetX(0);
+		obstacle1->SetWidth(500);
+		obstacle1->SetHeight(20);
+		obstacle2->SetX(2000);
+		obstacle2->SetWidth(20);
+		obstacle2->SetHeight(20);
+		scene.RenderAndStep();
+
+		ScenePathfindingObstaclesManager & manager = ScenePathfindingObstaclesManager::managers[&scene];
+		std::vector<PathfindingObstacleBehavior*> result;
+		manager.GetAllObstaclesAround(sf::FloatRect(0, 0, 1000, 10), result);
+		REQUIRE(result.size() == 1); //Each obstacle is returned only once.
+		REQUIRE(result[0]->GetObject() == obstacle1);
+
+		//Obstacles are updated when moved
+		obstacle2->SetX(300);
+		scene.RenderAndStep();
+
+		result.clear();
+		manager.GetAllObstaclesAround(sf::FloatRect(0, 0, 1000, 10), result);
+		REQUIRE(result.size() == 2);
+
+		result.clear();
+		manager.GetAllObstaclesAround(sf::FloatRect(1990, 0, 20, 10), result);
+		REQUIRE(result.empty());
+	}
+	SECTION("Obstacles moved by the events") {
+		RuntimeGame game;
+
+		gd::Object playerObj("player");
+		auto behavior = new PathfindingBehavior();
+		behavior->SetName("Pathfinding");
+		playerObj.AddBehavior(behavior);
+
+		gd::Object obstacleObj("obstacle");
+		obstacleObj.AddBehavior(new PathfindingObstacleBehavior());
+
+		RuntimeScene scene(NULL, &game);
+		auto * player = scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, playerObj)));
+		auto * obstacle = scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new ResizableRuntimeObject(scene, obstacleObj)));
+
+		obstacle->SetX(3000);
+		obstacle->SetY(3000);
+		obstacle->SetWidth(200);
+		obstacle->SetHeight(200);
+		scene.RenderAndStep();
+
+		//Move the obstacle on the destination, without stepping the scene
+		obstacle->SetX(1100);
+		obstacle->SetY(1200);
+
+		PathfindingBehavior * runtimeBehavior =
+			static_cast<PathfindingBehavior *>(player->GetBehaviorRawPointer("Pathfinding"));
+		runtimeBehavior->MoveTo(scene, 1200, 1300);
+		REQUIRE(runtimeBehavior->PathFound() == false);
+
+		//Obstacles are updated by their behaviors on the next frame
+		obstacle->SetX(3000);
+		scene.RenderAndStep();
+		runtimeBehavior->MoveTo(scene, 1200, 1300);
+		REQUIRE(runtimeBehavior->PathFound() == true);
+	}
 }
@@ -52,32 +52,12 @@ PhysicsBehavior::~PhysicsBehavior() {
 
 /**
  * Called at each frame before events :
- * Simulate the world if necessary and update body positions.
+ * Create the body if necessary. The world was simulated and the object updated
+ * from the body by RuntimeScenePhysicsDatas.
  */
 void PhysicsBehavior::DoStepPreEvents(RuntimeScene &scene) {
   if (!body) CreateBody(scene);
 
-  if (!runtimeScenesPhysicsDatas
-           ->stepped)  // Simulate the world, once at each frame
-  {
-    runtimeScenesPhysicsDatas->StepWorld(
-        static_cast<double>(scene.GetTimeManager().GetElapsedTime()) /
-            1000000.0,
-        6,
-        10);
-    runtimeScenesPhysicsDatas->stepped = true;
-  }
-
-  // Update object position according to Box2D body
-  b2Vec2 position = body->GetPosition();
-  object->SetX(position.x * runtimeScenesPhysicsDatas->GetScaleX() -
-               object->GetWidth() / 2 + object->GetX() -
-               object->GetDrawableX());
-  object->SetY(-position.y * runtimeScenesPhysicsDatas->GetScaleY() -
-               object->GetHeight() / 2 + object->GetY() -
-               object->GetDrawableY());                  // Y axis is inverted
-  object->SetAngle(-body->GetAngle() * 180.0f / b2_pi);  // Angles are inverted
-
   objectOldX = object->GetX();
   objectOldY = object->GetY();
   objectOldAngle = object->GetAngle();
@@ -98,18 +78,8 @@ void PhysicsBehavior::DoStepPostEvents(RuntimeScene &scene) {
   float newWidth = object->GetWidth();
   float newHeight = object->GetHeight();
   if ((int)objectOldWidth != (int)newWidth ||
-      (int)objectOldHeight != (int)newHeight) {
-    double oldAngularVelocity = body->GetAngularVelocity();
-    b2Vec2 oldVelocity = body->GetLinearVelocity();
-
-    runtimeScenesPhysicsDatas->world->DestroyBody(body);
-    CreateBody(scene);
-
-    body->SetAngularVelocity(oldAngularVelocity);
-    body->SetLinearVelocity(oldVelocity);
-  }
-
-  runtimeScenesPhysicsDatas->stepped = false;  // Prepare for a new simulation
+      (int)objectOldHeight != (int)newHeight)
+    UpdateFixtures();
 
   if (objectOldX == object->GetX() && objectOldY == object->GetY() &&
       objectOldAngle == object->GetAngle())
@@ -123,6 +93,32 @@ void PhysicsBehavior::DoStepPostEvents(RuntimeScene &scene) {
   body->SetTransform(
       oldPos, -object->GetAngle() * b2_pi / 180.0f);  // Angles are inverted
   body->SetAwake(true);
+  StorePreviousBodyTransform();  // Don't interpolate from the old position.
+}
+
+void PhysicsBehavior::StorePreviousBodyTransform() {
+  bodyPreviousX = body->GetPosition().x;
+  bodyPreviousY = body->GetPosition().y;
+  bodyPreviousAngle = body->GetAngle();
+}
+
+void PhysicsBehavior::UpdateObjectFromBody(float alpha) {
+  // Update object position according to Box2D body
+  b2Vec2 position = body->GetPosition();
+  float angle = body->GetAngle();
+  if (alpha < 1) {
+    position.x = bodyPreviousX + (position.x - bodyPreviousX) * alpha;
+    position.y = bodyPreviousY + (position.y - bodyPreviousY) * alpha;
+    angle = bodyPreviousAngle + (angle - bodyPreviousAngle) * alpha;
+  }
+
+  object->SetX(position.x * runtimeScenesPhysicsDatas->GetScaleX() -
+               object->GetWidth() / 2 + object->GetX() -
+               object->GetDrawableX());
+  object->SetY(-position.y * runtimeScenesPhysicsDatas->GetScaleY() -
+               object->GetHeight() / 2 + object->GetY() -
+               object->GetDrawableY());       // Y axis is inverted
+  object->SetAngle(-angle * 180.0f / b2_pi);  // Angles are inverted
 }
 
 /**
@@ -148,16 +144,20 @@ void PhysicsBehavior::CreateBody(const RuntimeScene &scene) {
   body = runtimeScenesPhysicsDatas->world->CreateBody(&bodyDef);
   body->SetUserData(this);
 
-  // Setup body
+  CreateFixtures();
+  StorePreviousBodyTransform();
+}
+
+/**
+ * Create the fixtures of the body, according to the shape and the size of the
+ * object.
+ */
+void PhysicsBehavior::CreateFixtures() {
   if (shapeType == Circle) {
     b2FixtureDef fixtureDef;
 
     b2CircleShape circle;
-    circle.m_radius =
-        (object->GetWidth() * runtimeScenesPhysicsDatas->GetInvScaleX() +
-         object->GetHeight() * runtimeScenesPhysicsDatas->GetInvScaleY()) /
-        4;  // Radius is based on the average of height and width
-    if (circle.m_radius <= 0) circle.m_radius = 1;
+    circle.m_radius = GetCircleRadius();
     fixtureDef.shape = &circle;
     fixtureDef.density = massDensity;
     fixtureDef.friction = averageFriction;
@@ -230,10 +230,7 @@ void PhysicsBehavior::CreateBody(const RuntimeScene &scene) {
     b2FixtureDef fixtureDef;
 
     b2PolygonShape dynamicBox;
-    dynamicBox.SetAsBox((object->GetWidth() > 0 ? object->GetWidth() : 1.0f) *
-                            runtimeScenesPhysicsDatas->GetInvScaleX() / 2,
-                        (object->GetHeight() > 0 ? object->GetHeight() : 1.0f) *
-                            runtimeScenesPhysicsDatas->GetInvScaleY() / 2);
+    SetAsBox(dynamicBox);
     fixtureDef.shape = &dynamicBox;
     fixtureDef.density = massDensity;
     fixtureDef.friction = averageFriction;
@@ -246,6 +243,56 @@ void PhysicsBehavior::CreateBody(const RuntimeScene &scene) {
   objectOldHeight = object->GetHeight();
 }
 
+/**
+ * Update the fixtures of the body after the object size changed. The body is
+ * kept, with its velocities and its contacts.
+ */
+void PhysicsBehavior::UpdateFixtures() {
+  b2Fixture *fixture = body->GetFixtureList();
+  bool hasSingleFixture = fixture && !fixture->GetNext();
+  if (shapeType == Circle && hasSingleFixture &&
+      fixture->GetType() == b2Shape::e_circle) {
+    fixture->GetShape()->m_radius = GetCircleRadius();
+  } else if (shapeType == Box && hasSingleFixture &&
+             fixture->GetType() == b2Shape::e_polygon) {
+    SetAsBox(*static_cast<b2PolygonShape *>(fixture->GetShape()));
+  } else {
+    // Custom polygons are triangulated: replace all their fixtures.
+    while (body->GetFixtureList())
+      body->DestroyFixture(body->GetFixtureList());
+    CreateFixtures();
+  }
+
+  body->ResetMassData();
+  // Move the body to the new center of the object (like when the body is
+  // created), which also updates the broad-phase of the world with the new
+  // bounds of the fixtures.
+  b2Vec2 position;
+  position.x = (object->GetDrawableX() + object->GetWidth() / 2) *
+               runtimeScenesPhysicsDatas->GetInvScaleX();
+  position.y = -(object->GetDrawableY() + object->GetHeight() / 2) *
+               runtimeScenesPhysicsDatas->GetInvScaleY();  // Y axis is inverted
+  body->SetTransform(position, body->GetAngle());
+  StorePreviousBodyTransform();  // Don't interpolate from the old center.
+  objectOldWidth = object->GetWidth();
+  objectOldHeight = object->GetHeight();
+}
+
+float PhysicsBehavior::GetCircleRadius() const {
+  float radius =
+      (object->GetWidth() * runtimeScenesPhysicsDatas->GetInvScaleX() +
+       object->GetHeight() * runtimeScenesPhysicsDatas->GetInvScaleY()) /
+      4;  // Radius is based on the average of height and width
+  return radius > 0 ? radius : 1;
+}
+
+void PhysicsBehavior::SetAsBox(b2PolygonShape &shape) const {
+  shape.SetAsBox((object->GetWidth() > 0 ? object->GetWidth() : 1.0f) *
+                     runtimeScenesPhysicsDatas->GetInvScaleX() / 2,
+                 (object->GetHeight() > 0 ? object->GetHeight() : 1.0f) *
+                     runtimeScenesPhysicsDatas->GetInvScaleY() / 2);
+}
+
 void PhysicsBehavior::OnDeActivate() {
   if (runtimeScenesPhysicsDatas && body) {
     runtimeScenesPhysicsDatas->world->DestroyBody(body);
@@ -582,14 +629,13 @@ double PhysicsBehavior::GetAngularDamping(const RuntimeScene &scene) {
  * Test if there is a contact with another object
  */
 bool PhysicsBehavior::CollisionWith(
-    std::map<gd::String, std::vector<RuntimeObject *> *> otherObjectsLists,
+    const RuntimeObjectsLists &otherObjectsLists,
     RuntimeScene &scene) {
   if (!body) CreateBody(scene);
 
   // Getting a list of all objects which are tested
   std::vector<RuntimeObject *> objects;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
-           otherObjectsLists.begin();
+  for (RuntimeObjectsLists::const_iterator it = otherObjectsLists.begin();
        it != otherObjectsLists.end();
        ++it) {
     if (it->second != NULL) {
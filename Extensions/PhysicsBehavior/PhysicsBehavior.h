@@ -13,6 +13,7 @@ This project is released under the MIT License.
 #include <vector>
 #include "GDCpp/Runtime/Project/Behavior.h"
 #include "GDCpp/Runtime/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "SFML/Config.hpp"
 #include "SFML/System/Vector2.hpp"
 namespace gd {
@@ -22,6 +23,7 @@ class SerializerElement;
 }
 class RuntimeScene;
 class b2Body;
+class b2PolygonShape;
 class RuntimeScenePhysicsDatas;
 
 namespace sf {
@@ -161,13 +163,30 @@ class GD_EXTENSION_API PhysicsBehavior : public Behavior {
       char32_t composantSep = U';');
 
   bool CollisionWith(
-      std::map<gd::String, std::vector<RuntimeObject *> *> otherObjectsLists,
+      const RuntimeObjectsLists &otherObjectsLists,
       RuntimeScene &scene);
 
+  /**
+   * Remember the current transform of the body, before the world is stepped.
+   * \see RuntimeScenePhysicsDatas::UpdateObjectsFromBodies
+   */
+  void StorePreviousBodyTransform();
+
+  /**
+   * Update the object position and angle from the body.
+   * \param alpha The interpolation between the previous transform of the body
+   * (0) and its current transform (1).
+   */
+  void UpdateObjectFromBody(float alpha);
+
  private:
   virtual void DoStepPreEvents(RuntimeScene &scene);
   virtual void DoStepPostEvents(RuntimeScene &scene);
   void CreateBody(const RuntimeScene &scene);
+  void CreateFixtures();
+  void UpdateFixtures();
+  float GetCircleRadius() const;
+  void SetAsBox(b2PolygonShape &shape) const;
 
   enum ShapeType {
     Box,
@@ -207,6 +226,10 @@ class GD_EXTENSION_API PhysicsBehavior : public Behavior {
   float objectOldWidth;
   float objectOldHeight;
 
+  float bodyPreviousX;  ///< Position of the body before the last step.
+  float bodyPreviousY;
+  float bodyPreviousAngle;
+
   sf::Clock *stepClock;
 
   b2Body *body;  ///< Box2D body, representing the object in the Box2D world
@@ -6,9 +6,12 @@ This project is released under the MIT License.
 */
 
 #include "RuntimeScenePhysicsDatas.h"
+#include <algorithm>
 #include <iostream>
 #include "Box2D/Box2D.h"
 #include "ContactListener.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "PhysicsBehavior.h"
 #include "ScenePhysicsDatas.h"
 
 RuntimeScenePhysicsDatas::RuntimeScenePhysicsDatas(
@@ -18,13 +21,15 @@ RuntimeScenePhysicsDatas::RuntimeScenePhysicsDatas(
           true)),
       contactListener(new ContactListener),
       staticBody(NULL),
-      stepped(false),
       scaleX(behaviorSharedDatas.scaleX),
       scaleY(behaviorSharedDatas.scaleY),
       invScaleX(1 / scaleX),
       invScaleY(1 / scaleY),
-      fixedTimeStep(1.f / 60.f),
-      maxSteps(5),
+      fixedTimeStep(1.f / std::max(behaviorSharedDatas.stepsPerSecond, 1.f)),
+      maxSteps(std::max(behaviorSharedDatas.maxStepsPerFrame, 1)),
+      velocityIterations(std::max(behaviorSharedDatas.velocityIterations, 1)),
+      positionIterations(std::max(behaviorSharedDatas.positionIterations, 1)),
+      interpolation(behaviorSharedDatas.interpolation),
       totalTime(0) {
   world->SetContactListener(contactListener);
   world->SetAutoClearForces(false);
@@ -33,24 +38,45 @@ RuntimeScenePhysicsDatas::RuntimeScenePhysicsDatas(
   staticBody = world->CreateBody(&bodyWithoutFixture);
 }
 
-void RuntimeScenePhysicsDatas::StepWorld(float dt, int v, int p) {
+void RuntimeScenePhysicsDatas::DoStepPreEvents(RuntimeScene& scene) {
+  StepWorld(static_cast<double>(scene.GetTimeManager().GetElapsedTime()) /
+            1000000.0);
+  UpdateObjectsFromBodies();
+}
+
+void RuntimeScenePhysicsDatas::StepWorld(float dt) {
   totalTime += dt;
 
-  if (totalTime > fixedTimeStep) {
+  if (totalTime >= fixedTimeStep) {
     std::size_t numberOfSteps(std::floor(totalTime / fixedTimeStep));
     totalTime -= numberOfSteps * fixedTimeStep;
 
     std::size_t numberOfStepToProcess = std::min(numberOfSteps, maxSteps);
 
     for (std::size_t a = 0; a < numberOfStepToProcess; a++) {
-      world->Step(fixedTimeStep, v, p);
+      // Objects are interpolated from the transforms before the last step.
+      if (interpolation && a == numberOfStepToProcess - 1) {
+        for (b2Body* body = world->GetBodyList(); body;
+             body = body->GetNext()) {
+          PhysicsBehavior* behavior =
+              static_cast<PhysicsBehavior*>(body->GetUserData());
+          if (behavior) behavior->StorePreviousBodyTransform();
+        }
+      }
+
+      world->Step(fixedTimeStep, velocityIterations, positionIterations);
       world->ClearForces();
     }
   }
+}
 
-  // Old method
-  /*world->Step(dt, v, p);
-  world->ClearForces();*/
+void RuntimeScenePhysicsDatas::UpdateObjectsFromBodies() {
+  float alpha = interpolation ? totalTime / fixedTimeStep : 1;
+  for (b2Body* body = world->GetBodyList(); body; body = body->GetNext()) {
+    PhysicsBehavior* behavior =
+        static_cast<PhysicsBehavior*>(body->GetUserData());
+    if (behavior) behavior->UpdateObjectFromBody(alpha);
+  }
 }
 
 RuntimeScenePhysicsDatas::~RuntimeScenePhysicsDatas() {
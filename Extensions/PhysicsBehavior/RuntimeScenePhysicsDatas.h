@@ -30,8 +30,6 @@ class RuntimeScenePhysicsDatas : public BehaviorsRuntimeSharedData {
   ContactListener* contactListener;
   b2Body*
       staticBody;  ///< A simple static body with no fixture. Used for joints.
-  bool stepped;    ///< Used to be sure that Step is called only once at each
-                   ///< frame.
 
   /**
    * Get the scale between world coordinates and scene pixels in x axis
@@ -53,11 +51,28 @@ class RuntimeScenePhysicsDatas : public BehaviorsRuntimeSharedData {
    */
   inline float GetInvScaleY() const { return invScaleY; }
 
+  /**
+   * Simulate the world and update the objects from their bodies. Called by the
+   * scene at each frame, before the behaviors and the events.
+   */
+  virtual void DoStepPreEvents(RuntimeScene& scene);
+
   /**
    * Call world->Step(), ensuring that the timeStep passed to Step() is fixed.
-   * This method is to be called once a frame ( by PhysicsBehavior ).
+   * The time left after the last step is kept for the next frame.
+   */
+  void StepWorld(float dt);
+
+  /**
+   * Update the position and angle of the objects of all the bodies, in a
+   * single pass on the bodies of the world.
+   *
+   * When interpolation is activated, objects are placed between the
+   * transforms of their bodies before and after the last step, according to
+   * the time left after the last step, so that objects move smoothly even if
+   * the frame rate is not the physics steps rate.
    */
-  void StepWorld(float dt, int v, int p);
+  void UpdateObjectsFromBodies();
 
  private:
   float scaleX;
@@ -72,8 +87,11 @@ class RuntimeScenePhysicsDatas : public BehaviorsRuntimeSharedData {
       maxSteps;  ///< Maximum steps per frames, to prevent slow down (a slow
                  ///< down will force the computer to make more steps which will
                  ///< force it to make even more steps...)
+  int velocityIterations;  ///< Velocity iterations of each step.
+  int positionIterations;  ///< Position iterations of each step.
+  bool interpolation;  ///< True to interpolate the objects between two steps.
 
-  float totalTime;
+  float totalTime;  ///< Time not simulated yet, less than fixedTimeStep.
 };
 
 #endif  // RUNTIMESCENEPHYSICSDATAS_H
@@ -28,6 +28,21 @@ std::map<gd::String, gd::PropertyDescriptor> ScenePhysicsDatas::GetProperties(
       gd::String::From(scaleX));
   properties[_("Y Scale: number of pixels for 1 meter")].SetValue(
       gd::String::From(scaleY));
+#if !defined(EMSCRIPTEN)
+  // The JS runtime, used by the web-based IDE, steps the world with fixed
+  // settings and does not interpolate.
+  properties[_("Physics steps per second")].SetValue(
+      gd::String::From(stepsPerSecond));
+  properties[_("Maximum physics steps per frame")].SetValue(
+      gd::String::From(maxStepsPerFrame));
+  properties[_("Velocity iterations per step")].SetValue(
+      gd::String::From(velocityIterations));
+  properties[_("Position iterations per step")].SetValue(
+      gd::String::From(positionIterations));
+  properties[_("Interpolate objects positions between steps")]
+      .SetValue(interpolation ? "true" : "false")
+      .SetType("Boolean");
+#endif
 
   return properties;
 }
@@ -47,6 +62,21 @@ bool ScenePhysicsDatas::UpdateProperty(const gd::String& name,
   if (name == _("Y scale: number of pixels for 1 meter")) {
     scaleY = value.To<float>();
   }
+  if (name == _("Physics steps per second")) {
+    stepsPerSecond = value.To<float>();
+  }
+  if (name == _("Maximum physics steps per frame")) {
+    maxStepsPerFrame = value.To<int>();
+  }
+  if (name == _("Velocity iterations per step")) {
+    velocityIterations = value.To<int>();
+  }
+  if (name == _("Position iterations per step")) {
+    positionIterations = value.To<int>();
+  }
+  if (name == _("Interpolate objects positions between steps")) {
+    interpolation = (value == "1");
+  }
 
   return true;
 }
@@ -56,6 +86,11 @@ void ScenePhysicsDatas::SerializeTo(gd::SerializerElement& element) const {
   element.SetAttribute("gravityY", gravityY);
   element.SetAttribute("scaleX", scaleX);
   element.SetAttribute("scaleY", scaleY);
+  element.SetAttribute("stepsPerSecond", stepsPerSecond);
+  element.SetAttribute("maxStepsPerFrame", maxStepsPerFrame);
+  element.SetAttribute("velocityIterations", velocityIterations);
+  element.SetAttribute("positionIterations", positionIterations);
+  element.SetAttribute("interpolation", interpolation);
 }
 
 #endif
@@ -65,4 +100,9 @@ void ScenePhysicsDatas::UnserializeFrom(const gd::SerializerElement& element) {
   gravityY = element.GetDoubleAttribute("gravityY");
   scaleX = element.GetDoubleAttribute("scaleX");
   scaleY = element.GetDoubleAttribute("scaleY");
+  stepsPerSecond = element.GetDoubleAttribute("stepsPerSecond", 60);
+  maxStepsPerFrame = element.GetIntAttribute("maxStepsPerFrame", 5);
+  velocityIterations = element.GetIntAttribute("velocityIterations", 6);
+  positionIterations = element.GetIntAttribute("positionIterations", 10);
+  interpolation = element.GetBoolAttribute("interpolation", false);
 }
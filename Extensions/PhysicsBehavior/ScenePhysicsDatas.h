@@ -21,7 +21,12 @@ class ScenePhysicsDatas : public gd::BehaviorsSharedData {
         gravityX(0),
         gravityY(9),
         scaleX(100),
-        scaleY(100){};
+        scaleY(100),
+        stepsPerSecond(60),
+        maxStepsPerFrame(5),
+        velocityIterations(6),
+        positionIterations(10),
+        interpolation(false){};
   virtual ~ScenePhysicsDatas(){};
   virtual std::shared_ptr<gd::BehaviorsSharedData> Clone() const {
     return std::shared_ptr<gd::BehaviorsSharedData>(
@@ -32,6 +37,11 @@ class ScenePhysicsDatas : public gd::BehaviorsSharedData {
   float gravityY;
   float scaleX;
   float scaleY;
+  float stepsPerSecond;    ///< Number of fixed steps simulated in a second.
+  int maxStepsPerFrame;    ///< Steps skipped beyond this are not simulated.
+  int velocityIterations;  ///< Velocity iterations of the solver, per step.
+  int positionIterations;  ///< Position iterations of the solver, per step.
+  bool interpolation;      ///< True to interpolate objects between two steps.
 
   virtual std::shared_ptr<BehaviorsRuntimeSharedData>
   CreateRuntimeSharedDatas() {
@@ -26,7 +26,8 @@ PlatformBehavior::PlatformBehavior()
       registeredInManager(false),
       platformType(NormalPlatform),
       canBeGrabbed(true),
-      yGrabOffset(0) {}
+      yGrabOffset(0),
+      isStatic(false) {}
 
 PlatformBehavior::~PlatformBehavior() {
   if (sceneManager && registeredInManager) sceneManager->RemovePlatform(this);
@@ -53,9 +54,18 @@ void PlatformBehavior::DoStepPreEvents(RuntimeScene& scene) {
       registeredInManager = true;
     }
   }
+
+  // Track changes in size or position
+  if (registeredInManager && sceneManager && !isStatic)
+    sceneManager->UpdatePlatform(this);
 }
 
-void PlatformBehavior::DoStepPostEvents(RuntimeScene& scene) {}
+void PlatformBehavior::DoStepPostEvents(RuntimeScene& scene) {
+  // Also track the changes done by events, so that platformer objects find the
+  // platform where it is at the beginning of the next frame.
+  if (registeredInManager && sceneManager && !isStatic)
+    sceneManager->UpdatePlatform(this);
+}
 
 void PlatformBehavior::ChangePlatformType(const gd::String& platformType_) {
   if (platformType_ == "Ladder")
@@ -66,6 +76,14 @@ void PlatformBehavior::ChangePlatformType(const gd::String& platformType_) {
     platformType = NormalPlatform;
 }
 
+void PlatformBehavior::SetStatic(bool enable) {
+  // Take into account any change done while the platform was static.
+  if (isStatic && !enable && registeredInManager && sceneManager)
+    sceneManager->UpdatePlatform(this);
+
+  isStatic = enable;
+}
+
 void PlatformBehavior::OnActivate() {
   if (sceneManager) {
     sceneManager->AddPlatform(this);
@@ -87,6 +105,7 @@ void PlatformBehavior::UnserializeFrom(const gd::SerializerElement& element) {
           : (platformTypeStr == "Jumpthru" ? Jumpthru : NormalPlatform);
   canBeGrabbed = element.GetBoolAttribute("canBeGrabbed", true);
   yGrabOffset = element.GetDoubleAttribute("yGrabOffset");
+  isStatic = element.GetBoolAttribute("static", false);
 }
 
 #if defined(GD_IDE_ONLY)
@@ -99,6 +118,7 @@ void PlatformBehavior::SerializeTo(gd::SerializerElement& element) const {
     element.SetAttribute("platformType", "NormalPlatform");
   element.SetAttribute("canBeGrabbed", canBeGrabbed);
   element.SetAttribute("yGrabOffset", yGrabOffset);
+  element.SetAttribute("static", isStatic);
 }
 
 std::map<gd::String, gd::PropertyDescriptor> PlatformBehavior::GetProperties(
@@ -122,6 +142,13 @@ std::map<gd::String, gd::PropertyDescriptor> PlatformBehavior::GetProperties(
       .SetType("Boolean");
   properties[_("Grab offset on Y axis")].SetValue(
       gd::String::From(yGrabOffset));
+#if !defined(EMSCRIPTEN)
+  // The JS runtime, used by the web-based IDE, updates all the platforms
+  // the same way.
+  properties[_("Static (never moved nor resized)")]
+      .SetValue(isStatic ? "true" : "false")
+      .SetType("Boolean");
+#endif
 
   return properties;
 }
@@ -140,6 +167,8 @@ bool PlatformBehavior::UpdateProperty(const gd::String& name,
       platformType = NormalPlatform;
   } else if (name == _("Grab offset on Y axis"))
     yGrabOffset = value.To<double>();
+  else if (name == _("Static (never moved nor resized)"))
+    isStatic = (value == "1");
   else
     return false;
 
@@ -68,6 +68,19 @@ class GD_EXTENSION_API PlatformBehavior : public Behavior {
    */
   double GetYGrabOffset() const { return yGrabOffset; }
 
+  /**
+   * \brief Return true if the platform is never moved nor resized.
+   *
+   * Static platforms are not updated in the platforms grid of the scene after
+   * being added to it, so they have no cost when the scene is stepped.
+   */
+  bool IsStatic() const { return isStatic; }
+
+  /**
+   * \brief Change if the platform is never moved nor resized.
+   */
+  void SetStatic(bool enable);
+
   virtual void UnserializeFrom(const gd::SerializerElement& element);
 #if defined(GD_IDE_ONLY)
   virtual std::map<gd::String, gd::PropertyDescriptor> GetProperties(
@@ -94,6 +107,7 @@ class GD_EXTENSION_API PlatformBehavior : public Behavior {
   bool canBeGrabbed;  ///< True if the platform ledges can be grabbed by
                       ///< platformer objects.
   double yGrabOffset;
+  bool isStatic;  ///< True if the platform is never moved nor resized.
 };
 
 #endif  // PLATFORMBEHAVIOR_H
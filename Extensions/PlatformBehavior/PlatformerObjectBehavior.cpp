@@ -124,21 +124,21 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene& scene) {
   requestedDeltaX += currentSpeed * timeDelta;
 
   // Compute the list of the objects that will be used
-  std::set<PlatformBehavior*> potentialObjects =
-      GetPotentialCollidingObjects(std::max(requestedDeltaX, maxFallingSpeed));
-  std::set<PlatformBehavior*> overlappedJumpThru =
-      GetJumpthruCollidingWith(potentialObjects);
+  UpdatePotentialCollidingObjects(std::max(requestedDeltaX, maxFallingSpeed));
+  GetJumpthruCollidingWith(potentialObjects, overlappedJumpThru);
 
   // Check that the floor object still exists and is near the object.
   if (isOnFloor &&
-      potentialObjects.find(floorPlatform) == potentialObjects.end()) {
+      std::find(potentialObjects.begin(), potentialObjects.end(),
+                floorPlatform) == potentialObjects.end()) {
     isOnFloor = false;
     floorPlatform = NULL;
   }
 
   // Check that the grabbed platform object still exists and is near the object.
   if (isGrabbingPlatform &&
-      potentialObjects.find(grabbedPlatform) == potentialObjects.end()) {
+      std::find(potentialObjects.begin(), potentialObjects.end(),
+                grabbedPlatform) == potentialObjects.end()) {
     ReleaseGrabbedPlatform();
   }
 
@@ -417,7 +417,7 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene& scene) {
   }
 
   // 3) Update the current floor data for the next tick:
-  overlappedJumpThru = GetJumpthruCollidingWith(potentialObjects);
+  GetJumpthruCollidingWith(potentialObjects, overlappedJumpThru);
   if (!isOnLadder) {
     // Check if the object is on a floor:
     // In priority, check if the last floor platform is still the floor.
@@ -430,7 +430,7 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene& scene) {
       floorLastY = floorPlatform->GetObject()->GetY();
     } else {
       // Check if landing on a new floor: (Exclude already overlapped jump truh)
-      std::set<PlatformBehavior*> collidingObjects =
+      std::vector<PlatformBehavior*> collidingObjects =
           GetPlatformsCollidingWith(potentialObjects, overlappedJumpThru);
       if (!collidingObjects.empty())  // Just landed on floor
       {
@@ -489,9 +489,9 @@ void PlatformerObjectBehavior::ReleaseGrabbedPlatform() {
 }
 
 bool PlatformerObjectBehavior::SeparateFromPlatforms(
-    const std::set<PlatformBehavior*>& candidates, bool excludeJumpThrus) {
+    const std::vector<PlatformBehavior*>& candidates, bool excludeJumpThrus) {
   std::vector<RuntimeObject*> objects;
-  for (std::set<PlatformBehavior*>::iterator it = candidates.begin();
+  for (std::vector<PlatformBehavior*>::const_iterator it = candidates.begin();
        it != candidates.end();
        ++it) {
     if ((*it)->GetPlatformType() == PlatformBehavior::Ladder) continue;
@@ -505,30 +505,33 @@ bool PlatformerObjectBehavior::SeparateFromPlatforms(
   return object->SeparateFromObjects(objects, ignoreTouchingEdges);
 }
 
-std::set<PlatformBehavior*> PlatformerObjectBehavior::GetPlatformsCollidingWith(
-    const std::set<PlatformBehavior*>& candidates,
-    const std::set<PlatformBehavior*>& exceptTheseOnes) {
+std::vector<PlatformBehavior*>
+PlatformerObjectBehavior::GetPlatformsCollidingWith(
+    const std::vector<PlatformBehavior*>& candidates,
+    const std::vector<PlatformBehavior*>& exceptTheseOnes) {
   // TODO: This function could be refactored to return only the first colliding
   // platform.
-  std::set<PlatformBehavior*> result;
-  for (std::set<PlatformBehavior*>::iterator it = candidates.begin();
+  std::vector<PlatformBehavior*> result;
+  for (std::vector<PlatformBehavior*>::const_iterator it = candidates.begin();
        it != candidates.end();
        ++it) {
-    if (exceptTheseOnes.find(*it) != exceptTheseOnes.end()) continue;
+    if (std::find(exceptTheseOnes.begin(), exceptTheseOnes.end(), *it) !=
+        exceptTheseOnes.end())
+      continue;
     if ((*it)->GetPlatformType() == PlatformBehavior::Ladder) continue;
 
     if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
-      result.insert(*it);
+      result.push_back(*it);
   }
 
   return result;
 }
 
 bool PlatformerObjectBehavior::IsCollidingWith(
-    const std::set<PlatformBehavior*>& candidates,
+    const std::vector<PlatformBehavior*>& candidates,
     PlatformBehavior* exceptThisOne,
     bool excludeJumpThrus) {
-  for (std::set<PlatformBehavior*>::iterator it = candidates.begin();
+  for (std::vector<PlatformBehavior*>::const_iterator it = candidates.begin();
        it != candidates.end();
        ++it) {
     if (*it == exceptThisOne) continue;
@@ -545,12 +548,14 @@ bool PlatformerObjectBehavior::IsCollidingWith(
 }
 
 bool PlatformerObjectBehavior::IsCollidingWith(
-    const std::set<PlatformBehavior*>& candidates,
-    const std::set<PlatformBehavior*>& exceptTheseOnes) {
-  for (std::set<PlatformBehavior*>::iterator it = candidates.begin();
+    const std::vector<PlatformBehavior*>& candidates,
+    const std::vector<PlatformBehavior*>& exceptTheseOnes) {
+  for (std::vector<PlatformBehavior*>::const_iterator it = candidates.begin();
        it != candidates.end();
        ++it) {
-    if (exceptTheseOnes.find(*it) != exceptTheseOnes.end()) continue;
+    if (std::find(exceptTheseOnes.begin(), exceptTheseOnes.end(), *it) !=
+        exceptTheseOnes.end())
+      continue;
     if ((*it)->GetPlatformType() == PlatformBehavior::Ladder) continue;
 
     if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
@@ -560,24 +565,23 @@ bool PlatformerObjectBehavior::IsCollidingWith(
   return false;
 }
 
-std::set<PlatformBehavior*> PlatformerObjectBehavior::GetJumpthruCollidingWith(
-    const std::set<PlatformBehavior*>& candidates) {
-  std::set<PlatformBehavior*> result;
-  for (std::set<PlatformBehavior*>::iterator it = candidates.begin();
+void PlatformerObjectBehavior::GetJumpthruCollidingWith(
+    const std::vector<PlatformBehavior*>& candidates,
+    std::vector<PlatformBehavior*>& result) {
+  result.clear();
+  for (std::vector<PlatformBehavior*>::const_iterator it = candidates.begin();
        it != candidates.end();
        ++it) {
     if ((*it)->GetPlatformType() != PlatformBehavior::Jumpthru) continue;
 
     if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
-      result.insert(*it);
+      result.push_back(*it);
   }
-
-  return result;
 }
 
 bool PlatformerObjectBehavior::IsOverlappingLadder(
-    const std::set<PlatformBehavior*>& candidates) {
-  for (std::set<PlatformBehavior*>::iterator it = candidates.begin();
+    const std::vector<PlatformBehavior*>& candidates) {
+  for (std::vector<PlatformBehavior*>::const_iterator it = candidates.begin();
        it != candidates.end();
        ++it) {
     if ((*it)->GetPlatformType() != PlatformBehavior::Ladder) continue;
@@ -588,8 +592,7 @@ bool PlatformerObjectBehavior::IsOverlappingLadder(
   return false;
 }
 
-std::set<PlatformBehavior*>
-PlatformerObjectBehavior::GetPotentialCollidingObjects(
+void PlatformerObjectBehavior::UpdatePotentialCollidingObjects(
     double maxMovementLength) {
   // Compute the "bounding circle" radius of the object.
   float o1w = object->GetWidth();
@@ -598,28 +601,16 @@ PlatformerObjectBehavior::GetPotentialCollidingObjects(
       sqrt(o1w * o1w + o1h * o1h) / 2.0 +
       maxMovementLength / 2.0;  // Add to it the maximum magnitude of movement.
 
-  std::set<PlatformBehavior*> potentialObjects;
-  for (std::set<PlatformBehavior*>::iterator it =
-           sceneManager->GetAllPlatforms().begin();
-       it != sceneManager->GetAllPlatforms().end();
-       ++it) {
-    // First check if bounding circle are too far.
-    RuntimeObject* obj2 = (*it)->GetObject();
-    float o2w = obj2->GetWidth();
-    float o2h = obj2->GetHeight();
-
-    float x = object->GetDrawableX() + object->GetCenterX() -
-              (obj2->GetDrawableX() + obj2->GetCenterX());
-    float y = object->GetDrawableY() + object->GetCenterY() -
-              (obj2->GetDrawableY() + obj2->GetCenterY());
-    float obj2BoundingRadius = sqrt(o2w * o2w + o2h * o2h) / 2.0;
-
-    if (sqrt(x * x + y * y) <= obj1BoundingRadius + obj2BoundingRadius) {
-      potentialObjects.insert(*it);
-    }
-  }
-
-  return potentialObjects;
+  // Search the platforms in the box of this circle: it contains all the
+  // positions of the object during the movement, whatever its angle.
+  potentialObjects.clear();
+  sceneManager->GetAllPlatformsAround(
+      sf::FloatRect(
+          object->GetDrawableX() + object->GetCenterX() - obj1BoundingRadius,
+          object->GetDrawableY() + object->GetCenterY() - obj1BoundingRadius,
+          2 * obj1BoundingRadius,
+          2 * obj1BoundingRadius),
+      potentialObjects);
 }
 
 void PlatformerObjectBehavior::DoStepPostEvents(RuntimeScene& scene) {
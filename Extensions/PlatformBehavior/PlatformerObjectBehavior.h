@@ -9,7 +9,7 @@ This project is released under the MIT License.
 #define PLATFORMEROBJECTBEHAVIOR_H
 #include <SFML/System/Vector2.hpp>
 #include <map>
-#include <set>
+#include <vector>
 #include "GDCpp/Runtime/Project/Behavior.h"
 #include "GDCpp/Runtime/Project/Object.h"
 namespace gd {
@@ -104,20 +104,19 @@ class GD_EXTENSION_API PlatformerObjectBehavior : public Behavior {
   virtual void DoStepPostEvents(RuntimeScene& scene);
 
   /**
-   * \brief Return a list of all the platforms that could be colliding with the
-   * object if it is moved. \param maxMovementLength The maximum length of any
-   * movement that could be done by the object, in pixels. \warning sceneManager
-   * must be valid and not NULL.
+   * \brief Fill potentialObjects with all the platforms that could be colliding
+   * with the object if it is moved. \param maxMovementLength The maximum length
+   * of any movement that could be done by the object, in pixels. \warning
+   * sceneManager must be valid and not NULL.
    */
-  std::set<PlatformBehavior*> GetPotentialCollidingObjects(
-      double maxMovementLength);
+  void UpdatePotentialCollidingObjects(double maxMovementLength);
 
   /**
    * \brief Separate the object from all platforms passed as parameter, except
    * ladders. \param candidates The platform to be tested for collision \param
    * excludeJumpThrus If set to true, the jump thru platform will be excluded.
    */
-  bool SeparateFromPlatforms(const std::set<PlatformBehavior*>& candidates,
+  bool SeparateFromPlatforms(const std::vector<PlatformBehavior*>& candidates,
                              bool excludeJumpThrus);
 
   /**
@@ -126,9 +125,9 @@ class GD_EXTENSION_API PlatformerObjectBehavior : public Behavior {
    * from the test. \param candidates The platform to be tested for collision
    * \param exceptTheseOnes The platforms to be excluded from the test
    */
-  std::set<PlatformBehavior*> GetPlatformsCollidingWith(
-      const std::set<PlatformBehavior*>& candidates,
-      const std::set<PlatformBehavior*>& exceptTheseOnes);
+  std::vector<PlatformBehavior*> GetPlatformsCollidingWith(
+      const std::vector<PlatformBehavior*>& candidates,
+      const std::vector<PlatformBehavior*>& exceptTheseOnes);
 
   /**
    * \brief Among the platforms passed in parameter, return true if there is a
@@ -138,7 +137,7 @@ class GD_EXTENSION_API PlatformerObjectBehavior : public Behavior {
    * collision. \param excludeJumpThrus If set to true, the jump thru platform
    * will be excluded.
    */
-  bool IsCollidingWith(const std::set<PlatformBehavior*>& candidates,
+  bool IsCollidingWith(const std::vector<PlatformBehavior*>& candidates,
                        PlatformBehavior* exceptThisOne = NULL,
                        bool excludeJumpThrus = false);
 
@@ -148,23 +147,24 @@ class GD_EXTENSION_API PlatformerObjectBehavior : public Behavior {
    * from the test. \param candidates The platforms to be tested for collision
    * \param exceptTheseOnes The platforms to be excluded from the test
    */
-  bool IsCollidingWith(const std::set<PlatformBehavior*>& candidates,
-                       const std::set<PlatformBehavior*>& exceptTheseOnes);
+  bool IsCollidingWith(const std::vector<PlatformBehavior*>& candidates,
+                       const std::vector<PlatformBehavior*>& exceptTheseOnes);
 
   /**
    * \brief Among the platforms passed in parameter, return true if the object
    * is overlapping a ladder. \param candidates The platform to be tested for
    * collision
    */
-  bool IsOverlappingLadder(const std::set<PlatformBehavior*>& candidates);
+  bool IsOverlappingLadder(const std::vector<PlatformBehavior*>& candidates);
 
   /**
-   * \brief Among the platforms passed in parameter, return a list of the jump
-   * thru platforms colliding with the object. \param candidates The platform to
-   * be tested for collision
+   * \brief Among the platforms passed in parameter, fill \a result with the
+   * jump thru platforms colliding with the object. \param candidates The
+   * platform to be tested for collision
    */
-  std::set<PlatformBehavior*> GetJumpthruCollidingWith(
-      const std::set<PlatformBehavior*>& candidates);
+  void GetJumpthruCollidingWith(
+      const std::vector<PlatformBehavior*>& candidates,
+      std::vector<PlatformBehavior*>& result);
 
   /**
    * \brief Return true if the object owning the behavior can grab the specified
@@ -212,6 +212,12 @@ class GD_EXTENSION_API PlatformerObjectBehavior : public Behavior {
   RuntimeScene* parentScene;  ///< The scene the object belongs to.
   ScenePlatformObjectsManager*
       sceneManager;  ///< The platform objects manager associated to the scene.
+  std::vector<PlatformBehavior*>
+      potentialObjects;  ///< The platforms near the object, reused at each
+                         ///< step to avoid allocations.
+  std::vector<PlatformBehavior*>
+      overlappedJumpThru;  ///< The jump thru platforms overlapped by the
+                           ///< object, reused at each step.
   bool isOnFloor;    ///< True if the object is on a floor.
   bool isOnLadder;   ///< True if the object is on a ladder.
   PlatformBehavior* floorPlatform;  ///< The platform the object is on, when
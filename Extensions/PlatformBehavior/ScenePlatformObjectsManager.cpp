@@ -1,8 +1,13 @@
 #include "ScenePlatformObjectsManager.h"
+#include <algorithm>
+#include <cmath>
+#include "GDCpp/Runtime/RuntimeObject.h"
 #include "PlatformBehavior.h"
 
 std::map<RuntimeScene*, ScenePlatformObjectsManager>
     ScenePlatformObjectsManager::managers;
+const float ScenePlatformObjectsManager::cellSize = 128;
+const int ScenePlatformObjectsManager::maxCellsPerPlatform = 256;
 
 ScenePlatformObjectsManager::~ScenePlatformObjectsManager() {
   for (std::set<PlatformBehavior*>::iterator it = allPlatforms.begin();
@@ -12,8 +17,171 @@ ScenePlatformObjectsManager::~ScenePlatformObjectsManager() {
 }
 
 void ScenePlatformObjectsManager::AddPlatform(PlatformBehavior* platform) {
-  allPlatforms.insert(platform);
+  if (!allPlatforms.insert(platform).second) return;  // Already added.
+
+  PlatformCells& cells = platformsCells[platform];
+  UpdateGeometry(*platform, cells);
+  cells.box = GetBoundingBox(cells);
+  InsertInCells(platform, cells);
 }
+
 void ScenePlatformObjectsManager::RemovePlatform(PlatformBehavior* platform) {
+  auto it = platformsCells.find(platform);
+  if (it != platformsCells.end()) {
+    RemoveFromCells(platform, it->second);
+    platformsCells.erase(it);
+  }
+
   allPlatforms.erase(platform);
 }
+
+void ScenePlatformObjectsManager::UpdatePlatform(PlatformBehavior* platform) {
+  auto it = platformsCells.find(platform);
+  if (it == platformsCells.end()) return;
+
+  // Most platforms are not moved: avoid computing their box in this case.
+  PlatformCells& cells = it->second;
+  if (!UpdateGeometry(*platform, cells)) return;
+
+  sf::FloatRect box = GetBoundingBox(cells);
+  if (box.left == cells.box.left && box.top == cells.box.top &&
+      box.width == cells.box.width && box.height == cells.box.height)
+    return;
+
+  RemoveFromCells(platform, cells);
+  cells.box = box;
+  InsertInCells(platform, cells);
+}
+
+void ScenePlatformObjectsManager::GetAllPlatformsAround(
+    const sf::FloatRect& area, std::vector<PlatformBehavior*>& result) const {
+  result.insert(result.end(), largePlatforms.begin(), largePlatforms.end());
+
+  int minCellX, minCellY, maxCellX, maxCellY;
+  if (!GetCellsRange(area, minCellX, minCellY, maxCellX, maxCellY)) {
+    // The area is too large: return all the platforms stored in the cells.
+    for (const auto& platformCells : platformsCells) {
+      if (!platformCells.second.large) result.push_back(platformCells.first);
+    }
+    return;
+  }
+
+  for (int x = minCellX; x <= maxCellX; ++x) {
+    for (int y = minCellY; y <= maxCellY; ++y) {
+      auto cell = grid.find(GetCellKey(x, y));
+      if (cell == grid.end()) continue;
+
+      for (const CellEntry& entry : cell->second) {
+        // A platform covering several cells of the area is only returned
+        // when visiting the first of these cells.
+        if (x == std::max(entry.minCellX, minCellX) &&
+            y == std::max(entry.minCellY, minCellY))
+          result.push_back(entry.platform);
+      }
+    }
+  }
+}
+
+bool ScenePlatformObjectsManager::GetCellsRange(const sf::FloatRect& box,
+                                                int& minCellX,
+                                                int& minCellY,
+                                                int& maxCellX,
+                                                int& maxCellY) {
+  float minX = std::floor(std::min(box.left, box.left + box.width) / cellSize);
+  float minY = std::floor(std::min(box.top, box.top + box.height) / cellSize);
+  float maxX = std::floor(std::max(box.left, box.left + box.width) / cellSize);
+  float maxY = std::floor(std::max(box.top, box.top + box.height) / cellSize);
+
+  // Also reject NaN and infinite coordinates.
+  if (!((maxX - minX + 1) * (maxY - minY + 1) <= maxCellsPerPlatform))
+    return false;
+
+  minCellX = static_cast<int>(minX);
+  minCellY = static_cast<int>(minY);
+  maxCellX = static_cast<int>(maxX);
+  maxCellY = static_cast<int>(maxY);
+  return true;
+}
+
+bool ScenePlatformObjectsManager::UpdateGeometry(
+    const PlatformBehavior& platform, PlatformCells& cells) {
+  const RuntimeObject* object = platform.GetObject();
+  float drawableX = object->GetDrawableX();
+  float drawableY = object->GetDrawableY();
+  float centerX = object->GetCenterX();
+  float centerY = object->GetCenterY();
+  float width = object->GetWidth();
+  float height = object->GetHeight();
+  if (drawableX == cells.drawableX && drawableY == cells.drawableY &&
+      centerX == cells.centerX && centerY == cells.centerY &&
+      width == cells.width && height == cells.height)
+    return false;
+
+  cells.drawableX = drawableX;
+  cells.drawableY = drawableY;
+  cells.centerX = centerX;
+  cells.centerY = centerY;
+  cells.width = width;
+  cells.height = height;
+  return true;
+}
+
+sf::FloatRect ScenePlatformObjectsManager::GetBoundingBox(
+    const PlatformCells& cells) {
+  float radius =
+      sqrt(cells.width * cells.width + cells.height * cells.height) / 2.0;
+
+  return sf::FloatRect(cells.drawableX + cells.centerX - radius,
+                       cells.drawableY + cells.centerY - radius,
+                       2 * radius,
+                       2 * radius);
+}
+
+void ScenePlatformObjectsManager::InsertInCells(PlatformBehavior* platform,
+                                                PlatformCells& cells) {
+  cells.large = !GetCellsRange(cells.box,
+                               cells.minCellX,
+                               cells.minCellY,
+                               cells.maxCellX,
+                               cells.maxCellY);
+  if (cells.large) {
+    largePlatforms.push_back(platform);
+    return;
+  }
+
+  CellEntry entry;
+  entry.platform = platform;
+  entry.minCellX = cells.minCellX;
+  entry.minCellY = cells.minCellY;
+  for (int x = cells.minCellX; x <= cells.maxCellX; ++x) {
+    for (int y = cells.minCellY; y <= cells.maxCellY; ++y)
+      grid[GetCellKey(x, y)].push_back(entry);
+  }
+}
+
+void ScenePlatformObjectsManager::RemoveFromCells(PlatformBehavior* platform,
+                                                  const PlatformCells& cells) {
+  if (cells.large) {
+    largePlatforms.erase(
+        std::remove(largePlatforms.begin(), largePlatforms.end(), platform),
+        largePlatforms.end());
+    return;
+  }
+
+  for (int x = cells.minCellX; x <= cells.maxCellX; ++x) {
+    for (int y = cells.minCellY; y <= cells.maxCellY; ++y) {
+      auto cell = grid.find(GetCellKey(x, y));
+      if (cell == grid.end()) continue;
+
+      std::vector<CellEntry>& entries = cell->second;
+      for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].platform == platform) {
+          entries[i] = entries.back();
+          entries.pop_back();
+          break;
+        }
+      }
+      if (entries.empty()) grid.erase(cell);
+    }
+  }
+}
@@ -6,13 +6,22 @@ This project is released under the MIT License.
 */
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
+#include <SFML/Graphics/Rect.hpp>
+#include <cstdint>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 #include "GDCpp/Runtime/RuntimeScene.h"
 class PlatformBehavior;
 
 /**
  * \brief Contains lists of all platform related objects of a scene.
+ *
+ * Platforms are also stored in a grid, according to their bounding box, so
+ * that the platforms around a platformer object can be found without iterating
+ * on all of them. Platforms behaviors must call UpdatePlatform when their
+ * object is moved or resized (static platforms are never updated).
  */
 class ScenePlatformObjectsManager {
  public:
@@ -37,14 +46,91 @@ class ScenePlatformObjectsManager {
    */
   void RemovePlatform(PlatformBehavior* platform);
 
+  /**
+   * \brief Update the position of the platform in the grid, if its object was
+   * moved or resized since it was added or last updated.
+   * \param platform The platform, which must have been added before.
+   */
+  void UpdatePlatform(PlatformBehavior* platform);
+
+  /**
+   * \brief Add to \a result the platforms that may be overlapping the
+   * specified area (considering their position when they were last updated).
+   *
+   * Each platform is added at most once. \a result is not cleared first.
+   */
+  void GetAllPlatformsAround(const sf::FloatRect& area,
+                             std::vector<PlatformBehavior*>& result) const;
+
   /**
    * \brief Get a read only access to the list of all platforms
    */
   const std::set<PlatformBehavior*>& GetAllPlatforms() { return allPlatforms; }
 
  private:
+  /**
+   * \brief The cells covered by the bounding box of a platform.
+   */
+  struct PlatformCells {
+    sf::FloatRect box;  ///< The bounding box used to compute the cells.
+    float drawableX, drawableY, centerX, centerY, width,
+        height;  ///< The object geometry used to compute the box.
+    bool large;  ///< true if the platform is not stored in the cells.
+    int minCellX, minCellY, maxCellX, maxCellY;
+  };
+
+  /**
+   * \brief A platform stored in a cell of the grid.
+   */
+  struct CellEntry {
+    PlatformBehavior* platform;
+    int minCellX;  ///< The first cell of the platform, used to return
+    int minCellY;  ///< the platform only once when querying several cells.
+  };
+
+  static std::int64_t GetCellKey(int x, int y) {
+    return (static_cast<std::int64_t>(x) << 32) ^
+           static_cast<std::int64_t>(static_cast<std::uint32_t>(y));
+  }
+
+  /**
+   * \brief Compute the range of cells covered by a box.
+   * \return false if the box covers too many cells (or is invalid) to be
+   * stored in the cells.
+   */
+  static bool GetCellsRange(const sf::FloatRect& box,
+                            int& minCellX,
+                            int& minCellY,
+                            int& maxCellX,
+                            int& maxCellY);
+
+  /**
+   * \brief Store the geometry of the object of the platform in \a cells.
+   * \return false if the geometry is the same as the stored one.
+   */
+  static bool UpdateGeometry(const PlatformBehavior& platform,
+                             PlatformCells& cells);
+
+  /**
+   * \brief Return the box containing the object of the platform, whatever its
+   * angle (i.e: the box of its bounding circle), from its stored geometry.
+   */
+  static sf::FloatRect GetBoundingBox(const PlatformCells& cells);
+
+  void InsertInCells(PlatformBehavior* platform, PlatformCells& cells);
+  void RemoveFromCells(PlatformBehavior* platform, const PlatformCells& cells);
+
   std::set<PlatformBehavior*>
       allPlatforms;  ///< The list of all platforms of the scene.
+  std::unordered_map<PlatformBehavior*, PlatformCells>
+      platformsCells;  ///< The cells where each platform is stored.
+  std::unordered_map<std::int64_t, std::vector<CellEntry>>
+      grid;  ///< The platforms overlapping each cell.
+  std::vector<PlatformBehavior*>
+      largePlatforms;  ///< The platforms covering too many cells.
+
+  static const float cellSize;
+  static const int maxCellsPerPlatform;
 };
 
 #endif
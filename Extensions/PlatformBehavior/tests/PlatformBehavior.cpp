@@ -0,0 +1,104 @@
+/**
+
+GDevelop - Platform Behavior Extension
+Copyright (c) 2013-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Tests for the Platform Behavior extension.
+ */
+#define CATCH_CONFIG_MAIN
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "../PlatformBehavior.h"
+#include "../ScenePlatformObjectsManager.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+// Mock objects that can have a specific size
+class ResizableRuntimeObject : public RuntimeObject {
+ public:
+  ResizableRuntimeObject(RuntimeScene& scene, const gd::Object& obj)
+      : RuntimeObject(scene, obj), width(0), height(0) {}
+
+  float GetWidth() const override { return width; }
+  float GetHeight() const override { return height; }
+  void SetWidth(float newWidth) override { width = newWidth; }
+  void SetHeight(float newHeight) override { height = newHeight; }
+
+ private:
+  float width;
+  float height;
+};
+
+namespace {
+bool HasPlatformAround(const ScenePlatformObjectsManager& manager,
+                       const sf::FloatRect& area,
+                       PlatformBehavior* platform) {
+  std::vector<PlatformBehavior*> platforms;
+  manager.GetAllPlatformsAround(area, platforms);
+  return std::count(platforms.begin(), platforms.end(), platform) == 1;
+}
+}  // namespace
+
+TEST_CASE("PlatformBehavior", "[game-engine][platform]") {
+  SECTION("Moved platforms are updated in the grid") {
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    gd::Object platformObj("platform");
+    PlatformBehavior* behavior = new PlatformBehavior();
+    behavior->SetName("Platform");
+    platformObj.AddBehavior(behavior);
+
+    RuntimeObject* platformObject = scene.objectsInstances.AddObject(
+        std::unique_ptr<RuntimeObject>(
+            new ResizableRuntimeObject(scene, platformObj)));
+    platformObject->SetX(100);
+    platformObject->SetY(100);
+    platformObject->SetWidth(32);
+    platformObject->SetHeight(32);
+    PlatformBehavior* platform = static_cast<PlatformBehavior*>(
+        platformObject->GetBehaviorRawPointer("Platform"));
+
+    platformObject->DoBehaviorsPreEvents(scene);
+    const ScenePlatformObjectsManager& manager =
+        ScenePlatformObjectsManager::managers[&scene];
+    sf::FloatRect initialArea(110, 110, 10, 10);
+    sf::FloatRect farArea(1010, 110, 10, 10);
+    REQUIRE(HasPlatformAround(manager, initialArea, platform));
+    REQUIRE(!HasPlatformAround(manager, farArea, platform));
+
+    // Stepping an unchanged platform keeps it in the same cells.
+    platformObject->DoBehaviorsPostEvents(scene);
+    platformObject->DoBehaviorsPreEvents(scene);
+    REQUIRE(HasPlatformAround(manager, initialArea, platform));
+
+    // Moving the platform during the events updates the grid.
+    platformObject->SetX(1000);
+    platformObject->DoBehaviorsPostEvents(scene);
+    REQUIRE(!HasPlatformAround(manager, initialArea, platform));
+    REQUIRE(HasPlatformAround(manager, farArea, platform));
+
+    // Resizing it too.
+    platformObject->SetWidth(512);
+    platformObject->SetHeight(512);
+    platformObject->DoBehaviorsPreEvents(scene);
+    REQUIRE(HasPlatformAround(
+        manager, sf::FloatRect(1400, 500, 10, 10), platform));
+
+    // Static platforms are left where they were added.
+    platform->SetStatic(true);
+    platformObject->SetX(100);
+    platformObject->DoBehaviorsPostEvents(scene);
+    REQUIRE(HasPlatformAround(manager, farArea, platform));
+    platform->SetStatic(false);
+    REQUIRE(HasPlatformAround(manager, initialArea, platform));
+    REQUIRE(!HasPlatformAround(manager, farArea, platform));
+
+    ScenePlatformObjectsManager::managers.erase(&scene);
+  }
+}
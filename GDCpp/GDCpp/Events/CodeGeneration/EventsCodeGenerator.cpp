@@ -83,28 +83,41 @@ gd::String EventsCodeGenerator::GenerateObjectBehaviorFunctionCall(
              !context.GetCurrentObject().empty()) {
     if (!castNeeded)
       return "(" + ManObjListName(objectListName) +
-             "[i]->GetBehaviorRawPointer(\"" + behaviorName + "\")->" +
+             "[i]" + GenerateBehaviorAccessor(behaviorName) + "->" +
              codeInfo.functionCallName + "(" + parametersStr + "))";
     else
       return "(static_cast<" + autoInfo.className + "*>(" +
-             ManObjListName(objectListName) + "[i]->GetBehaviorRawPointer(\"" +
-             behaviorName + "\"))->" + codeInfo.functionCallName + "(" +
-             parametersStr + "))";
+             ManObjListName(objectListName) + "[i]" +
+             GenerateBehaviorAccessor(behaviorName) + ")->" +
+             codeInfo.functionCallName + "(" + parametersStr + "))";
   } else {
     if (!castNeeded)
       return "(( " + ManObjListName(objectListName) + ".empty() ) ? " +
              defaultOutput + " :" + ManObjListName(objectListName) +
-             "[0]->GetBehaviorRawPointer(\"" + behaviorName + "\")->" +
+             "[0]" + GenerateBehaviorAccessor(behaviorName) + "->" +
              codeInfo.functionCallName + "(" + parametersStr + "))";
     else
       return "(( " + ManObjListName(objectListName) + ".empty() ) ? " +
              defaultOutput + " : " + "static_cast<" + autoInfo.className +
              "*>(" + ManObjListName(objectListName) +
-             "[0]->GetBehaviorRawPointer(\"" + behaviorName + "\"))->" +
+             "[0]" + GenerateBehaviorAccessor(behaviorName) + ")->" +
              codeInfo.functionCallName + "(" + parametersStr + "))";
   }
 }
 
+gd::String EventsCodeGenerator::GenerateBehaviorAccessor(
+    const gd::String& behaviorName) {
+  // Behaviors are accessed using their slot, resolved once when the events
+  // are loaded, rather than by their name.
+  gd::String slotName =
+      "behaviorSlot" + gd::SceneNameMangler::GetMangledSceneName(behaviorName);
+  AddGlobalDeclaration("static const std::size_t " + slotName +
+                       " = RuntimeObject::GetBehaviorSlot(" +
+                       ConvertToStringExplicit(behaviorName) + ");");
+
+  return "->GetBehaviorInSlot(" + slotName + ")";
+}
+
 gd::String EventsCodeGenerator::GenerateObjectCondition(
     const gd::String& objectName,
     const gd::ObjectMetadata& objInfo,
@@ -172,11 +185,11 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
   gd::String objectFunctionCallNamePart =
       (!instrInfos.parameters[1].supplementaryInformation.empty())
           ? "static_cast<" + autoInfo.className + "*>(" +
-                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\"))->" +
+                ManObjListName(objectName) + "[i]" +
+                GenerateBehaviorAccessor(behaviorName) + ")->" +
                 instrInfos.codeExtraInformation.functionCallName
-          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\")->" +
+          : ManObjListName(objectName) + "[i]" +
+                GenerateBehaviorAccessor(behaviorName) + "->" +
                 instrInfos.codeExtraInformation.functionCallName;
 
   // Create call
@@ -289,10 +302,10 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
   gd::String objectPart =
       (!instrInfos.parameters[1].supplementaryInformation.empty())
           ? "static_cast<" + autoInfo.className + "*>(" +
-                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\"))->"
-          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\")->";
+                ManObjListName(objectName) + "[i]" +
+                GenerateBehaviorAccessor(behaviorName) + ")->"
+          : ManObjListName(objectName) + "[i]" +
+                GenerateBehaviorAccessor(behaviorName) + "->";
 
   // Create call
   gd::String call;
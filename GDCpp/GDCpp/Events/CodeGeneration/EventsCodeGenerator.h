@@ -95,6 +95,12 @@ class GD_API EventsCodeGenerator : public gd::EventsCodeGenerator {
       gd::String defaultOutput,
       gd::EventsCodeGenerationContext& context);
 
+  /**
+   * \brief Generate the code accessing to a behavior of an object, to be
+   * appended to a pointer to the object.
+   */
+  gd::String GenerateBehaviorAccessor(const gd::String& behaviorName);
+
   virtual gd::String GenerateObjectCondition(
       const gd::String& objectName,
       const gd::ObjectMetadata& objInfo,
@@ -77,7 +77,7 @@ int GD_API GetMouseWheelDelta(RuntimeScene &scene) {
 }
 
 bool GD_API CursorOnObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists,
+    const RuntimeObjectsLists &objectsLists,
     RuntimeScene &scene,
     bool precise,
     bool conditionInverted) {
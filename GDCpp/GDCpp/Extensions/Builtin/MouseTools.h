@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "GDCpp/Runtime/String.h"
 
 class RuntimeScene;
@@ -25,7 +26,7 @@ bool GD_API MouseButtonPressed(RuntimeScene &scene, const gd::String &key);
 bool GD_API MouseButtonReleased(RuntimeScene &scene, const gd::String &key);
 int GD_API GetMouseWheelDelta(RuntimeScene &scene);
 bool GD_API CursorOnObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists,
+    const RuntimeObjectsLists &objectsLists,
     RuntimeScene &scene,
     bool precise,
     bool conditionInverted);
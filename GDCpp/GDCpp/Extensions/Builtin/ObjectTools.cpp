@@ -14,11 +14,9 @@
 
 using namespace std;
 
-double GD_API PickedObjectsCount(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists) {
+double GD_API PickedObjectsCount(const RuntimeObjectsLists &objectsLists) {
   std::size_t size = 0;
-  std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
-      objectsLists.begin();
+  RuntimeObjectsLists::const_iterator it = objectsLists.begin();
   for (; it != objectsLists.end(); ++it) {
     if (it->second == NULL) continue;
 
@@ -29,23 +27,24 @@ double GD_API PickedObjectsCount(
 }
 
 bool GD_API HitBoxesCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     bool conditionInverted,
-    RuntimeScene & /*scene*/,
+    RuntimeScene &scene,
     bool ignoreTouchingEdges) {
   return TwoObjectListsTest(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      scene.GetObjectsSpatialHash(),
       [ignoreTouchingEdges](RuntimeObject *obj1, RuntimeObject *obj2) {
         return obj1->IsCollidingWith(obj2, ignoreTouchingEdges);
       });
 }
 
 bool GD_API ObjectsTurnedToward(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     float tolerance,
     bool conditionInverted) {
   return TwoObjectListsTest(
@@ -66,8 +65,8 @@ bool GD_API ObjectsTurnedToward(
 }
 
 float GD_API DistanceBetweenObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     float length,
     bool conditionInverted) {
   length *= length;
@@ -85,11 +84,10 @@ float GD_API DistanceBetweenObjects(
       });
 }
 
-bool GD_API
-MovesToward(std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-            std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
-            float tolerance,
-            bool conditionInverted) {
+bool GD_API MovesToward(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
+                        float tolerance,
+                        bool conditionInverted) {
   return TwoObjectListsTest(
       objectsLists1,
       objectsLists2,
@@ -9,6 +9,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "GDCpp/Runtime/String.h"
 
 class RuntimeScene;
@@ -18,8 +19,8 @@ class RuntimeObject;
  * Only used internally by GD events generated code.
  */
 bool GD_API ObjectsTurnedToward(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     float tolerance,
     bool conditionInverted);
 
@@ -27,8 +28,8 @@ bool GD_API ObjectsTurnedToward(
  * Only used internally by GD events generated code.
  */
 bool GD_API HitBoxesCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     bool conditionInverted,
     RuntimeScene &scene,
     bool ignoreTouchingEdges = false);
@@ -36,25 +37,23 @@ bool GD_API HitBoxesCollision(
 /**
  * Only used internally by GD events generated code.
  */
-double GD_API PickedObjectsCount(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists);
+double GD_API PickedObjectsCount(const RuntimeObjectsLists &objectsLists);
 
 /**
  * Only used internally by GD events generated code.
  */
 float GD_API DistanceBetweenObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     float length,
     bool conditionInverted);
 
 /**
  * Only used internally by GD events generated code.
  */
-bool GD_API
-MovesToward(std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-            std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
-            float tolerance,
-            bool conditionInverted);
+bool GD_API MovesToward(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
+                        float tolerance,
+                        bool conditionInverted);
 
 #endif  // OBJECTTOOLS_H
@@ -72,7 +72,7 @@ bool GD_API SceneJustBegins(RuntimeScene &scene) {
 }
 
 void GD_API MoveObjects(RuntimeScene &scene) {
-  RuntimeObjNonOwningPtrList allObjects =
+  const RuntimeObjNonOwningPtrList &allObjects =
       scene.objectsInstances.GetAllObjects();
 
   for (std::size_t id = 0; id < allObjects.size(); ++id) {
@@ -94,30 +94,26 @@ namespace {
 void DoCreateObjectOnScene(
     RuntimeScene &scene,
     gd::String objectName,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer) {
-  if (pickedObjectLists.empty()) return;
-
-  // Find the object to be created
-  std::vector<ObjSPtr>::const_iterator sceneObject =
-      std::find_if(scene.GetObjects().begin(),
-                   scene.GetObjects().end(),
-                   std::bind2nd(ObjectHasName(), objectName));
-  std::vector<ObjSPtr>::const_iterator globalObject =
-      std::find_if(scene.game->GetObjects().begin(),
-                   scene.game->GetObjects().end(),
-                   std::bind2nd(ObjectHasName(), objectName));
+  RuntimeObjectsLists::const_iterator pickedObjects =
+      pickedObjectLists.find(objectName);
+  if (pickedObjects == pickedObjectLists.end() ||
+      pickedObjects->second == nullptr)
+    return;
 
+  // Find the object to be created: we check first scene's objects' list, then
+  // the global object list.
   RuntimeObjSPtr newObject = std::unique_ptr<RuntimeObject>();
 
-  if (sceneObject !=
-      scene.GetObjects().end())  // We check first scene's objects' list.
-    newObject = CppPlatform::Get().CreateRuntimeObject(scene, **sceneObject);
-  else if (globalObject !=
-           scene.game->GetObjects().end())  // Then the global object list
-    newObject = CppPlatform::Get().CreateRuntimeObject(scene, **globalObject);
+  if (scene.HasObjectNamed(objectName))
+    newObject = CppPlatform::Get().CreateRuntimeObject(
+        scene, scene.GetObject(objectName));
+  else if (scene.game->HasObjectNamed(objectName))
+    newObject = CppPlatform::Get().CreateRuntimeObject(
+        scene, scene.game->GetObject(objectName));
 
   if (newObject == std::unique_ptr<RuntimeObject>())
     return;  // Unable to create the object
@@ -128,7 +124,7 @@ void DoCreateObjectOnScene(
   newObject->SetLayer(layer);
 
   // Add object to scene and let it be concerned by futures actions
-  pickedObjectLists[objectName]->push_back(
+  pickedObjects->second->push_back(
       scene.objectsInstances.AddObject(std::move(newObject)));
 }
 
@@ -136,7 +132,7 @@ void DoCreateObjectOnScene(
 
 void GD_API CreateObjectOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer) {
@@ -152,12 +148,15 @@ void GD_API CreateObjectOnScene(
 
 void GD_API CreateObjectFromGroupOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     const gd::String &objectWanted,
     float positionX,
     float positionY,
     const gd::String &layer) {
-  if (pickedObjectLists[objectWanted] == nullptr)
+  RuntimeObjectsLists::const_iterator pickedObjects =
+      pickedObjectLists.find(objectWanted);
+  if (pickedObjects == pickedObjectLists.end() ||
+      pickedObjects->second == nullptr)
     return;  // Bail out if the object is not present in the specified group
 
   ::DoCreateObjectOnScene(
@@ -166,7 +165,7 @@ void GD_API CreateObjectFromGroupOnScene(
 
 bool GD_API PickAllObjects(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   for (auto it = pickedObjectLists.begin(); it != pickedObjectLists.end();
        ++it) {
     if (it->second != nullptr) {
@@ -186,7 +185,7 @@ bool GD_API PickAllObjects(
 
 bool GD_API PickRandomObject(
     RuntimeScene &,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   // Create a list with all objects
   std::vector<RuntimeObject *> allObjects;
   for (auto it = pickedObjectLists.begin(); it != pickedObjectLists.end();
@@ -205,7 +204,7 @@ bool GD_API PickRandomObject(
 }
 
 bool GD_API PickNearestObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     double x,
     double y,
     bool inverted) {
@@ -235,7 +234,7 @@ bool GD_API PickNearestObject(
 }
 
 bool GD_API RaycastObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float x,
     float y,
     float angle,
@@ -251,7 +250,7 @@ bool GD_API RaycastObject(
 }
 
 bool GD_API RaycastObjectToPosition(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float x,
     float y,
     float endX,
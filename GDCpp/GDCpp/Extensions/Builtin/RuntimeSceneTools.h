@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 class RuntimeScene;
 namespace gd {
 class Variable;
@@ -72,7 +73,7 @@ void GD_API DisableInputWhenFocusIsLost(RuntimeScene &scene, bool disable);
  */
 void GD_API CreateObjectOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer);
@@ -82,7 +83,7 @@ void GD_API CreateObjectOnScene(
  */
 void GD_API CreateObjectFromGroupOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     const gd::String &objectWanted,
     float positionX,
     float positionY,
@@ -95,7 +96,7 @@ void GD_API CreateObjectFromGroupOnScene(
  */
 bool GD_API PickAllObjects(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists);
+    const RuntimeObjectsLists &pickedObjectLists);
 
 /**
  * Only used internally by GD events generated code.
@@ -104,7 +105,7 @@ bool GD_API PickAllObjects(
  */
 bool GD_API PickRandomObject(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists);
+    const RuntimeObjectsLists &pickedObjectLists);
 
 /**
  * Only used internally by GD events generated code.
@@ -112,7 +113,7 @@ bool GD_API PickRandomObject(
  * \return true if an object was picked, false otherwise
  */
 bool GD_API PickNearestObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     double x,
     double y,
     bool inverted);
@@ -121,7 +122,7 @@ bool GD_API PickNearestObject(
  * Only used internally by GD events generated code.
  */
 bool GD_API RaycastObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float x,
     float y,
     float angle,
@@ -134,7 +135,7 @@ bool GD_API RaycastObject(
  * Only used internally by GD events generated code.
  */
 bool GD_API RaycastObjectToPosition(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float x,
     float y,
     float targetX,
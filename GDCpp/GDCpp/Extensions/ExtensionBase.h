@@ -116,6 +116,22 @@ class GD_API ExtensionBase : public gd::PlatformExtension {
   virtual void ObjectDeletedFromScene(RuntimeScene& scene,
                                       RuntimeObject* objectDeleted){};
 
+  /**
+   * \brief Called by RuntimeScene, if ToBeNotifiedOnObjectDeletion() returns
+   * true, with all the objects that are about to be deleted at the end of a
+   * frame.
+   *
+   * By default, ObjectDeletedFromScene is called for each object. Redefine this
+   * method if the objects can be handled faster all at once.
+   *
+   * \see ExtensionBase::ObjectDeletedFromScene
+   */
+  virtual void ObjectsDeletedFromScene(
+      RuntimeScene& scene, const std::vector<RuntimeObject*>& objectsDeleted) {
+    for (RuntimeObject* objectDeleted : objectsDeleted)
+      ObjectDeletedFromScene(scene, objectDeleted);
+  };
+
 #if defined(GD_IDE_ONLY)
 
   /**
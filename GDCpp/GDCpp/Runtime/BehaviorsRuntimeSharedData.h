@@ -10,6 +10,7 @@
 namespace gd {
 class BehaviorsSharedData;
 }
+class RuntimeScene;
 #include <memory>
 
 /**
@@ -32,6 +33,15 @@ class BehaviorsRuntimeSharedData {
     return std::shared_ptr<BehaviorsRuntimeSharedData>(
         new BehaviorsRuntimeSharedData(*this));
   }
+
+  /**
+   * \brief Called by the scene at each frame, before the behaviors of the
+   * objects and the events.
+   *
+   * Redefine this to update, once a frame, data used by all the behaviors
+   * (for example, to simulate a world in which the objects live).
+   */
+  virtual void DoStepPreEvents(RuntimeScene& scene){};
 };
 
 #endif  // BEHAVIORSRUNTIMESHAREDDATAS_H
@@ -35,6 +35,10 @@ void BehaviorsRuntimeSharedDataHolder::LoadFrom(
   }
 }
 
+void BehaviorsRuntimeSharedDataHolder::DoStepPreEvents(RuntimeScene& scene) {
+  for (auto& it : behaviorsSharedDatas) it.second->DoStepPreEvents(scene);
+}
+
 BehaviorsRuntimeSharedDataHolder::BehaviorsRuntimeSharedDataHolder(
     const BehaviorsRuntimeSharedDataHolder& other) {
   Init(other);
@@ -10,6 +10,7 @@
 #include <string>
 #include "GDCpp/Runtime/String.h"
 class BehaviorsRuntimeSharedData;
+class RuntimeScene;
 namespace gd {
 class BehaviorsSharedData;
 }
@@ -41,6 +42,12 @@ class GD_API BehaviorsRuntimeSharedDataHolder {
       const std::map<gd::String, std::shared_ptr<gd::BehaviorsSharedData> >&
           sharedData);
 
+  /**
+   * \brief Call BehaviorsRuntimeSharedData::DoStepPreEvents on all the shared
+   * data.
+   */
+  void DoStepPreEvents(RuntimeScene& scene);
+
  private:
   void Init(const BehaviorsRuntimeSharedDataHolder& other);
 
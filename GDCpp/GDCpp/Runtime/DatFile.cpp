@@ -3,200 +3,448 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include "GDCpp/Runtime/Tools/FileStream.h"
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-DatFile::DatFile(void) { m_buffer = NULL; }
+namespace {
+const char datFileID[8] = {'E', 'X', 'E', 'G', 'D', '0', '2', '\0'};
 
-DatFile::~DatFile(void) {
-  if (m_buffer != NULL) delete[] m_buffer;
+enum Compression { NoCompression = 0, LZCompression = 1 };
+
+std::uint64_t HashName(const char* name, std::size_t size) {
+  // FNV-1a
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(name[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
 }
-bool DatFile::Create(std::vector<gd::String> files,
-                     gd::String directory,
-                     gd::String destination) {
-  // An file entry in order to push it in the object's std::vector
-  sFileEntry entry;
-  // An input file stream to read each file included
-  gd::FileStream file;
-  // An output file stream to write our DAT file
-  gd::FileStream datfile;
-  // The buffer used to read/write the DAT file
-  char buffer[1];
 
-  // DATHeader
-  // We start by filling it with 0
-  memset(&m_header, 0, sizeof(m_header));
-  // Then we copy the ID
-  memcpy(m_header.uniqueID, "EXEGD", 5);  // EXEcutable GDevelop
-  // Then the version
-  memcpy(m_header.version, "0.1", 3);
-  // Then the number of files to include
-  m_header.nb_files = files.size();
-
-  // Next, we open each file in orderto create the File Entries Table
-  for (std::size_t i = 0; i < files.size(); i++) {
-    gd::String fileToOpen = directory + "/" + files[i];
-    file.open(fileToOpen, std::ios_base::in | std::ios_base::binary);
-    if (file.is_open()) {
-      // Filling the FileEntry with 0
-      memset(&entry, 0, sizeof(sFileEntry));
-      // We keep the file name
-      memcpy(entry.name, files[i].c_str(), strlen(files[i].c_str()));
-      // We calculate its size
-      file.seekg(0, std::ios::end);
-      entry.size = file.tellg();
-      // Since we don't know exactly its final position in the DAT file, let's
-      // use 0
-      entry.offset = 0;
-      // We finished with this file
-      file.close();
-
-      // Finally, we add this File Entry in our std::vector
-      m_entries.push_back(entry);
-    } else {
-      // Simple error track
-      std::cout << "File " << files[i] << " raise an error." << std::endl;
-      return (false);
+std::size_t Align(std::size_t offset) {
+  return (offset + DatFile::dataAlignment - 1) & ~(DatFile::dataAlignment - 1);
+}
+
+/**
+ * Compress data with a LZ77 algorithm, using the same sequences as the LZ4
+ * block format: a token with the number of literals and the length of the
+ * match, the literals, and the offset of the match.
+ */
+std::string Compress(const std::string& data) {
+  const std::size_t minMatch = 4;
+  const std::size_t maxOffset = 0xFFFF;
+  const unsigned int hashLog = 16;
+
+  std::string result;
+  result.reserve(data.size() / 2);
+  auto writeLength = [&result](std::size_t length) {
+    while (length >= 255) {
+      result.push_back(static_cast<char>(255));
+      length -= 255;
+    }
+    result.push_back(static_cast<char>(length));
+  };
+  auto writeSequence = [&](std::size_t literalsStart,
+                           std::size_t literalsCount,
+                           std::size_t offset,
+                           std::size_t matchLength) {
+    std::size_t matchCode = matchLength ? matchLength - minMatch : 0;
+    result.push_back(static_cast<char>(
+        (std::min<std::size_t>(literalsCount, 15) << 4) |
+        std::min<std::size_t>(matchCode, 15)));
+    if (literalsCount >= 15) writeLength(literalsCount - 15);
+    result.append(data, literalsStart, literalsCount);
+    if (matchLength == 0) return;
+
+    result.push_back(static_cast<char>(offset & 0xFF));
+    result.push_back(static_cast<char>(offset >> 8));
+    if (matchCode >= 15) writeLength(matchCode - 15);
+  };
+  auto read32 = [&data](std::size_t pos) {
+    std::uint32_t value;
+    memcpy(&value, data.data() + pos, sizeof(value));
+    return value;
+  };
+
+  std::vector<std::size_t> lastPositions(1 << hashLog, std::string::npos);
+  std::size_t anchor = 0;
+  std::size_t pos = 0;
+  while (pos + minMatch <= data.size()) {
+    std::uint32_t sequence = read32(pos);
+    std::size_t& lastPosition =
+        lastPositions[(sequence * 2654435761U) >> (32 - hashLog)];
+    std::size_t candidate = lastPosition;
+    lastPosition = pos;
+
+    if (candidate == std::string::npos || pos - candidate > maxOffset ||
+        read32(candidate) != sequence) {
+      pos++;
+      continue;
     }
+
+    std::size_t matchLength = minMatch;
+    while (pos + matchLength < data.size() &&
+           data[candidate + matchLength] == data[pos + matchLength])
+      matchLength++;
+
+    writeSequence(anchor, pos - anchor, pos - candidate, matchLength);
+    pos += matchLength;
+    anchor = pos;
   }
 
-  // Now, we know everything about our files, we can update offsets
-  long actual_offset = 0;
-  actual_offset += sizeof(sDATHeader);
-  actual_offset += m_header.nb_files * sizeof(sFileEntry);
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
-    m_entries[i].offset = actual_offset;
-    actual_offset += m_entries[i].size;
+  writeSequence(anchor, data.size() - anchor, 0, 0);
+  return result;
+}
+
+/**
+ * Uncompress data compressed with Compress.
+ * \return false if the data is not valid.
+ */
+bool Uncompress(const char* source,
+                std::size_t sourceSize,
+                char* destination,
+                std::size_t destinationSize) {
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(source);
+  const unsigned char* inEnd = in + sourceSize;
+  std::size_t out = 0;
+
+  auto readLength = [&in, inEnd](std::size_t& length) {
+    unsigned char byte = 255;
+    while (byte == 255) {
+      if (in >= inEnd) return false;
+      byte = *in++;
+      length += byte;
+    }
+    return true;
+  };
+
+  while (in < inEnd) {
+    unsigned char token = *in++;
+
+    std::size_t literalsCount = token >> 4;
+    if (literalsCount == 15 && !readLength(literalsCount)) return false;
+    if (literalsCount > static_cast<std::size_t>(inEnd - in) ||
+        literalsCount > destinationSize - out)
+      return false;
+    memcpy(destination + out, in, literalsCount);
+    in += literalsCount;
+    out += literalsCount;
+
+    if (in == inEnd) break;  // The last sequence has no match.
+
+    if (inEnd - in < 2) return false;
+    std::size_t offset = in[0] | (in[1] << 8);
+    in += 2;
+    std::size_t matchLength = token & 15;
+    if (matchLength == 15 && !readLength(matchLength)) return false;
+    matchLength += 4;
+    if (offset == 0 || offset > out || matchLength > destinationSize - out)
+      return false;
+
+    // The match can overlap the bytes being written.
+    for (std::size_t i = 0; i < matchLength; ++i, ++out)
+      destination[out] = destination[out - offset];
   }
 
-  // And finally, we are writing the DAT file
-  datfile.open(destination, std::ios_base::out | std::ios_base::binary);
+  return out == destinationSize;
+}
+}  // namespace
+
+DatFile::DatFile(void)
+    : m_mappingSize(0),
+      m_buckets(NULL),
+      m_entries(NULL),
+      m_names(NULL) {
+  memset(&m_header, 0, sizeof(m_header));
+}
 
-  // First, we write the header
-  datfile.write((char*)&m_header, sizeof(sDATHeader));
+DatFile::~DatFile(void) { Close(); }
 
-  // Then, the File Entries Table
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
-    datfile.write((char*)&m_entries[i], sizeof(sFileEntry));
+bool DatFile::Create(std::vector<gd::String> files,
+                     gd::String directory,
+                     gd::String destination,
+                     bool compress) {
+  // The hash table has at least twice as many buckets as files, and at least
+  // 2 buckets so that the entries are aligned on 8 bytes.
+  std::uint32_t bucketsCount = 2;
+  while (bucketsCount < files.size() * 2) bucketsCount *= 2;
+
+  sDATHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.uniqueID, datFileID, sizeof(datFileID));
+  header.nb_files = files.size();
+  header.nb_buckets = bucketsCount;
+
+  std::vector<std::uint32_t> buckets(bucketsCount, 0);
+  std::vector<sFileEntry> entries(files.size());
+  std::string names;
+  for (std::size_t i = 0; i < files.size(); i++) {
+    const std::string& name = files[i].Raw();
+    sFileEntry& entry = entries[i];
+    memset(&entry, 0, sizeof(sFileEntry));
+    entry.name_hash = HashName(name.data(), name.size());
+    entry.name_offset = names.size();
+    entry.name_size = name.size();
+    names += name;
+
+    std::size_t bucket = entry.name_hash & (bucketsCount - 1);
+    while (buckets[bucket] != 0) bucket = (bucket + 1) & (bucketsCount - 1);
+    buckets[bucket] = i + 1;
+  }
+
+  std::size_t entriesOffset =
+      sizeof(sDATHeader) + bucketsCount * sizeof(std::uint32_t);
+  std::size_t namesOffset = entriesOffset + files.size() * sizeof(sFileEntry);
+  header.data_offset = Align(namesOffset + names.size());
+
+  gd::FileStream datfile;
+  datfile.open(destination, std::ios_base::out | std::ios_base::binary);
+  if (!datfile.is_open()) {
+    std::cout << "Unable to write " << destination << std::endl;
+    return false;
   }
 
-  // Finally, we write each file
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
+  // Write the data of each file, the table of contents being written once
+  // the offsets and sizes are known.
+  std::string padding(header.data_offset, '\0');
+  datfile.write(padding.data(), padding.size());
+  std::size_t offset = header.data_offset;
+  for (std::size_t i = 0; i < files.size(); i++) {
     gd::String fileToOpen = directory + "/" + files[i];
+    gd::FileStream file;
     file.open(fileToOpen, std::ios_base::in | std::ios_base::binary);
-    if (file.is_open()) {
-      file.seekg(0, std::ios::beg);
-      datfile << file.rdbuf();
-      file.close();
+    if (!file.is_open()) {
+      std::cout << "File " << files[i] << " raise an error." << std::endl;
+      return false;
     }
+
+    std::string content((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    file.close();
+
+    sFileEntry& entry = entries[i];
+    entry.offset = offset;
+    entry.size = content.size();
+    entry.compression = NoCompression;
+    if (compress) {
+      // Only keep the compression if it saves at least an eighth of the size.
+      std::string compressed = Compress(content);
+      if (compressed.size() < content.size() - content.size() / 8) {
+        content.swap(compressed);
+        entry.compression = LZCompression;
+      }
+    }
+    entry.stored_size = content.size();
+
+    datfile.write(content.data(), content.size());
+    std::size_t nextOffset = Align(offset + content.size());
+    padding.assign(nextOffset - offset - content.size(), '\0');
+    datfile.write(padding.data(), padding.size());
+    offset = nextOffset;
   }
-  // And it's finished
+
+  datfile.seekp(0, std::ios::beg);
+  datfile.write((char*)&header, sizeof(sDATHeader));
+  datfile.write((char*)buckets.data(), buckets.size() * sizeof(std::uint32_t));
+  datfile.write((char*)entries.data(), entries.size() * sizeof(sFileEntry));
+  datfile.write(names.data(), names.size());
+
+  bool success = datfile.good();
   datfile.close();
-  return true;
+  return success;
+}
+
+void DatFile::Close() {
+  m_uncompressedFiles.clear();
+  m_buckets = NULL;
+  m_entries = NULL;
+  m_names = NULL;
+  memset(&m_header, 0, sizeof(m_header));
+
+  m_mapping.reset();
+  m_mappingSize = 0;
 }
 
 /**
  * Load the DatFile from a file. Return true on success
  */
 bool DatFile::Read(gd::String source) {
-  bool success = false;
+  Close();
 
-  // The input file stream from which we want informations
-  gd::FileStream datfile;
-  // A file entry in order to push it in the object's std::vector
-  sFileEntry entry;
+  // Map the file in memory. The mapping is copy-on-write, so that the buffers
+  // returned by GetFile can be modified without changing the file.
+#if defined(WINDOWS)
+  HANDLE file = CreateFileW(source.ToWide().c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL);
+  if (file == INVALID_HANDLE_VALUE) return false;
 
-  // Filling the header with 0
-  memset(&m_header, 0, sizeof(m_header));
-  // We open the DAT file to read it
-  datfile.open(source, std::ios_base::in | std::ios_base::binary);
-  if (datfile.is_open()) {
-    // Getting to the Header position
-    datfile.seekg(0, std::ios::beg);
-    // Reading the DAT Header
-    datfile.read((char*)&m_header, sizeof(sDATHeader));
-    // Next we are reading each file entry
-    for (std::size_t i = 0; i < m_header.nb_files; i++) {
-      // Reading a File Entry
-      datfile.read((char*)&entry, sizeof(sFileEntry));
-      // Pushing it in our std::vector
-      m_entries.push_back(entry);
+  LARGE_INTEGER fileSize;
+  if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+    HANDLE mappingHandle =
+        CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (mappingHandle) {
+      char* mapping = static_cast<char*>(
+          MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0));
+      if (mapping) {
+        m_mapping.reset(mapping, [mappingHandle](char* mapping) {
+          UnmapViewOfFile(mapping);
+          CloseHandle(mappingHandle);
+        });
+      } else
+        CloseHandle(mappingHandle);
     }
-    // Since all seems ok, we keep the DAT file name
-    m_datfile = source;
-    success = true;
+    m_mappingSize = fileSize.QuadPart;
   }
-  // Closing the DAT file
-  datfile.close();
-  return success;
+  CloseHandle(file);
+#else
+  int file = ::open(source.ToLocale().c_str(), O_RDONLY);
+  if (file == -1) return false;
+
+  struct stat fileStat;
+  if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0) {
+    void* mapping = mmap(NULL,
+                         fileStat.st_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE,
+                         file,
+                         0);
+    std::size_t mappingSize = fileStat.st_size;
+    if (mapping != MAP_FAILED) {
+      m_mapping.reset(static_cast<char*>(mapping),
+                      [mappingSize](char* mapping) {
+                        munmap(mapping, mappingSize);
+                      });
+    }
+    m_mappingSize = mappingSize;
+  }
+  ::close(file);
+#endif
+  if (!m_mapping) {
+    m_mappingSize = 0;
+    return false;
+  }
+
+  // Check that the table of contents is valid, so that it can be used
+  // without further checks.
+  bool valid = m_mappingSize >= sizeof(sDATHeader);
+  if (valid) {
+    memcpy(&m_header, m_mapping.get(), sizeof(sDATHeader));
+    valid = memcmp(m_header.uniqueID, datFileID, sizeof(datFileID)) == 0 &&
+            m_header.nb_buckets >= 2 &&
+            m_header.nb_buckets <= m_mappingSize &&
+            (m_header.nb_buckets & (m_header.nb_buckets - 1)) == 0 &&
+            m_header.nb_buckets >= m_header.nb_files;
+  }
+
+  std::size_t entriesOffset =
+      sizeof(sDATHeader) + m_header.nb_buckets * sizeof(std::uint32_t);
+  std::size_t namesOffset =
+      entriesOffset + m_header.nb_files * sizeof(sFileEntry);
+  valid = valid && namesOffset <= m_header.data_offset &&
+          m_header.data_offset <= m_mappingSize;
+  if (valid) {
+    m_buckets = reinterpret_cast<const std::uint32_t*>(m_mapping.get() +
+                                                        sizeof(sDATHeader));
+    m_entries =
+        reinterpret_cast<const sFileEntry*>(m_mapping.get() + entriesOffset);
+    m_names = m_mapping.get() + namesOffset;
+
+    for (std::size_t i = 0; valid && i < m_header.nb_buckets; i++)
+      valid = m_buckets[i] <= m_header.nb_files;
+    for (std::size_t i = 0; valid && i < m_header.nb_files; i++) {
+      const sFileEntry& entry = m_entries[i];
+      valid = namesOffset + entry.name_offset + entry.name_size <=
+                  m_header.data_offset &&
+              entry.offset <= m_mappingSize &&
+              entry.stored_size <= m_mappingSize - entry.offset &&
+              (entry.compression == LZCompression ||
+               (entry.compression == NoCompression &&
+                entry.stored_size == entry.size));
+    }
+  }
+
+  if (!valid) {
+    std::cout << source << " is not a valid DAT file." << std::endl;
+    Close();
+    return false;
+  }
+
+  m_datfile = source;
+  return true;
+}
+
+const sFileEntry* DatFile::FindEntry(const gd::String& filename) const {
+  if (!m_entries) return NULL;
+
+  const std::string& name = filename.Raw();
+  std::uint64_t hash = HashName(name.data(), name.size());
+  std::size_t bucket = hash & (m_header.nb_buckets - 1);
+  for (std::size_t probes = 0; probes < m_header.nb_buckets; probes++) {
+    std::uint32_t entryIndex = m_buckets[bucket];
+    if (entryIndex == 0) return NULL;
+
+    const sFileEntry& entry = m_entries[entryIndex - 1];
+    if (entry.name_hash == hash && entry.name_size == name.size() &&
+        memcmp(m_names + entry.name_offset, name.data(), name.size()) == 0)
+      return &entry;
+
+    bucket = (bucket + 1) & (m_header.nb_buckets - 1);
+  }
+
+  return NULL;
 }
 
 ////////////////////////////////////////////////////////////
 /// Check if the DatFile contains a file
 ////////////////////////////////////////////////////////////
 bool DatFile::ContainsFile(const gd::String& filename) {
-  if (m_header.nb_files != m_entries.size()) return false;
-
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    if (gd::String(m_entries[i].name) == filename) return true;
-  }
-
-  return false;
+  return FindEntry(filename) != NULL;
 }
 
-char* DatFile::GetFile(gd::String filename) {
-  // The input file stream from which we want information
-  gd::FileStream datfile;
+std::shared_ptr<char> DatFile::GetFile(gd::String filename) {
+  const sFileEntry* entry = FindEntry(filename);
+  if (!entry) return nullptr;
 
-  // Cleaning properly an ancient file loaded
-  if (m_buffer != NULL) {
-    delete[] m_buffer;
-    m_buffer = NULL;
-  }
+  // Share the ownership of the mapping, so that it outlives the DAT file if
+  // the data is still used.
+  if (entry->compression == NoCompression)
+    return std::shared_ptr<char>(m_mapping, m_mapping.get() + entry->offset);
 
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // We are allocating memory to the buffer
-      m_buffer = new char[(m_entries[i].size)];
-      // Simple error catch
-      if (m_buffer == NULL) {
-        cout << "Unable to allocate a buffer of length " << (m_entries[i].size)
-             << " when loading " << filename << endl;
-        return (NULL);
-      }
+  std::weak_ptr<char>& uncompressedFile = m_uncompressedFiles[entry];
+  std::shared_ptr<char> data = uncompressedFile.lock();
+  if (data) return data;
 
-      // Opening the DAT file ot read the file datas needed
-      datfile.open(m_datfile, std::ios_base::in | std::ios_base::binary);
-      if (datfile.is_open()) {
-        // Going to the right position
-        datfile.seekg(m_entries[i].offset, std::ios::beg);
-        // Reading
-        datfile.read(m_buffer, m_entries[i].size);
-        // We can close the DAT file
-        datfile.close();
-        // Returning the buffer
-        cout << "Successfully loaded " << filename << endl;
-        return (m_buffer);
-      }
-      cout << "Unable to open file " << m_datfile << " when loading "
-           << filename << endl;
-    }
+  data.reset(new char[entry->size], std::default_delete<char[]>());
+  if (!Uncompress(m_mapping.get() + entry->offset,
+                  entry->stored_size,
+                  data.get(),
+                  entry->size)) {
+    cout << "Unable to uncompress " << filename << " from " << m_datfile
+         << endl;
+    return nullptr;
   }
-  // Finally, there is no such file in our DAT file
-  return (NULL);
+
+  uncompressedFile = data;
+  return data;
 }
 
 long int DatFile::GetFileSize(gd::String filename) {
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // Returning the size of the file found
-      return (m_entries[i].size);
-    }
-  }
-  return (0);
+  const sFileEntry* entry = FindEntry(filename);
+  return entry ? entry->size : 0;
 }
@@ -1,13 +1,14 @@
 /**
  * \file
- * Adapted from the article http://www.sfml-dev.org/wiki/en/tutorials/formatdat
- * which is itself inspired from
- * archive.gamedev.net/archive/reference/programming/features/pak/index.html
+ * Archive containing the resources of a game, read through a memory mapping.
  */
 
 #ifndef DATFILE_H
 #define DATFILE_H
 
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "GDCpp/Runtime/String.h"
@@ -15,49 +16,111 @@
 using namespace std;
 
 /**
- * \brief Internal class related to DatFile
+ * \brief Internal class related to DatFile: the header of the archive.
  *
  * \ingroup ResourcesManagement
  */
 struct sDATHeader {
-  char uniqueID[5];  /// Unique ID used to know if this file is a DAT File from
-                     /// this class
-  char version[3];   /// Version of the DAT file format
-  unsigned int nb_files;  /// Number of files in the DAT file
+  char uniqueID[8];  ///< Unique ID used to know if this file is a DAT File
+                     ///< from this class, including the version of the format.
+  std::uint32_t nb_files;     ///< Number of files in the DAT file
+  std::uint32_t nb_buckets;   ///< Size of the hash table, a power of two.
+  std::uint64_t data_offset;  ///< Offset of the first file data.
 };
 
 /**
- * \brief Internal class related to DatFile
+ * \brief Internal class related to DatFile: a file stored in the archive.
  *
  * \ingroup ResourcesManagement
  */
 struct sFileEntry {
-  char name[1024];  /// Name of the data file
-  long size;        /// Size of the data file
-  long offset;      /// Offset, in the DAT file where the file is
+  std::uint64_t name_hash;    ///< Hash of the name of the file.
+  std::uint64_t offset;       ///< Offset, in the DAT file, of the file data.
+  std::uint64_t size;         ///< Size of the file.
+  std::uint64_t stored_size;  ///< Size of the data in the DAT file.
+  std::uint32_t name_offset;  ///< Offset of the name in the names table.
+  std::uint32_t name_size;    ///< Size of the name, in bytes.
+  std::uint32_t compression;  ///< 0 if the data is stored as is, 1 if it is
+                              ///< compressed.
+  std::uint32_t reserved;
 };
 
 /**
  * \brief Internal class used to create and access "DAT files".
  *
+ * A DAT file starts with a header followed by the table of contents: a hash
+ * table (open addressing, an entry index + 1 per bucket, 0 for empty buckets),
+ * the entries and the names of the files. Then comes the data of each file,
+ * aligned on DatFile::dataAlignment bytes.
+ *
+ * The DAT file is memory mapped when read: GetFile returns a pointer directly
+ * in the mapping for files stored as is. Files stored compressed are
+ * uncompressed when they are requested, and freed once no longer used.
+ *
  * \ingroup ResourcesManagement
  */
 class GD_API DatFile {
- private:
-  gd::String m_datfile;               /// name of the DAT file
-  sDATHeader m_header;                /// file header
-  std::vector<sFileEntry> m_entries;  /// vector of files entries
-  char* m_buffer;                     /// Buffer pointing on a file in memory
  public:
   DatFile(void);
   ~DatFile(void);
+
+  /**
+   * \brief Create a DAT file containing the specified files.
+   * \param files The files, relative to \a directory. Their names in the DAT
+   * file are the same.
+   * \param compress If true, the files that are made smaller enough by the
+   * compression are stored compressed.
+   * \return true if the DAT file was successfully written.
+   */
   bool Create(std::vector<gd::String> files,
               gd::String directory,
-              gd::String destination);
+              gd::String destination,
+              bool compress = true);
+
+  /**
+   * \brief Return true if the file is in the DAT file.
+   */
   bool ContainsFile(const gd::String& filename);
+
+  /**
+   * \brief Open a DAT file, replacing the previously opened one.
+   * \return true on success.
+   */
   bool Read(gd::String source);
-  char* GetFile(gd::String filename);
+
+  /**
+   * \brief Return the data of the file, or nullptr if the file is not in the
+   * DAT file.
+   *
+   * The data stays valid as long as the returned pointer (or a copy of it) is
+   * kept, even if the DAT file is closed. Writing into it does not change the
+   * DAT file.
+   */
+  std::shared_ptr<char> GetFile(gd::String filename);
+
+  /**
+   * \brief Return the size of the file, or 0 if the file is not in the DAT
+   * file.
+   */
   long int GetFileSize(gd::String filename);
+
+  static const std::size_t dataAlignment = 16;
+
+ private:
+  const sFileEntry* FindEntry(const gd::String& filename) const;
+  void Close();
+
+  gd::String m_datfile;  ///< name of the DAT file
+  sDATHeader m_header;   ///< file header
+  std::shared_ptr<char> m_mapping;  ///< The DAT file, mapped in memory. It is
+                                   ///< unmapped once the DAT file and the
+                                   ///< data returned by GetFile are released.
+  std::size_t m_mappingSize;
+  const std::uint32_t* m_buckets;  ///< The hash table, in the mapping.
+  const sFileEntry* m_entries;     ///< The entries, in the mapping.
+  const char* m_names;             ///< The names table, in the mapping.
+  std::map<const sFileEntry*, std::weak_ptr<char>>
+      m_uncompressedFiles;  ///< The compressed files requested and still used.
 };
 
 #endif  // DATFILE_H
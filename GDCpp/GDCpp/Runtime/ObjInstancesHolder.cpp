@@ -7,56 +7,122 @@
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/profile.h"
 
+std::size_t ObjInstancesHolder::GetNameId(const gd::String& name) {
+  auto it = namesIds.find(name);
+  if (it != namesIds.end()) return it->second;
+
+  std::size_t nameId = objectsInstances.size();
+  namesIds[name] = nameId;
+  objectsInstances.emplace_back();
+  objectsInstancesRefs.emplace_back();
+  return nameId;
+}
+
+RuntimeObjSPtr ObjInstancesHolder::TakeFromList(
+    const ObjectLocation& location) {
+  RuntimeObjList& list = objectsInstances[location.nameId];
+  RuntimeObjNonOwningPtrList& refsList = objectsInstancesRefs[location.nameId];
+
+  // Move the last object of the list at the place of the removed one.
+  RuntimeObjSPtr object = std::move(list[location.index]);
+  if (location.index != list.size() - 1) {
+    list[location.index] = std::move(list.back());
+    refsList[location.index] = refsList.back();
+    objectsLocations[refsList[location.index]].index = location.index;
+  }
+  list.pop_back();
+  refsList.pop_back();
+
+  return object;
+}
+
+void ObjInstancesHolder::PutInList(RuntimeObjSPtr&& object,
+                                   ObjectLocation& location) {
+  location.nameId = GetNameId(object->GetName());
+  location.index = objectsInstances[location.nameId].size();
+
+  objectsInstancesRefs[location.nameId].push_back(object.get());
+  objectsInstances[location.nameId].push_back(std::move(object));
+}
+
 RuntimeObject* ObjInstancesHolder::AddObject(RuntimeObjSPtr&& object) {
-  auto it = objectsInstances[object->GetName()].insert(
-      objectsInstances[object->GetName()].end(), std::move(object));
-  objectsInstancesRefs[(*it)->GetName()].push_back(it->get());
+  RuntimeObject* objectPtr = object.get();
+
+  ObjectLocation& location = objectsLocations[objectPtr];
+  location.allObjectsIndex = allObjects.size();
+  allObjects.push_back(objectPtr);
+  PutInList(std::move(object), location);
 
-  return it->get();
+  return objectPtr;
+}
+
+void ObjInstancesHolder::AddObjects(std::vector<RuntimeObjSPtr>&& objects) {
+  allObjects.reserve(allObjects.size() + objects.size());
+  objectsLocations.reserve(objectsLocations.size() + objects.size());
+
+  for (RuntimeObjSPtr& object : objects) AddObject(std::move(object));
+  objects.clear();
 }
 
 RuntimeObjNonOwningPtrList ObjInstancesHolder::GetObjectsRawPointers(
     const gd::String& name) {
-  return objectsInstancesRefs[name];
+  return objectsInstancesRefs[GetNameId(name)];
 }
 
-void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject* object) {
-  std::unique_ptr<RuntimeObject> theObject;  // We need the object to keep
-                                             // alive.
-
-  // Find and erase the object from the object lists.
-  for (auto it = objectsInstances.begin(); it != objectsInstances.end(); ++it) {
-    RuntimeObjList& list = it->second;
-    for (std::size_t i = 0; i < list.size(); ++i) {
-      if (list[i].get() == object) {
-        theObject = std::move(list[i]);
-        list.erase(list.begin() + i);
-        break;
-      }
-    }
-  }
-  // Find and erase the object from the object raw pointers lists.
-  for (auto it = objectsInstancesRefs.begin(); it != objectsInstancesRefs.end();
-       ++it) {
-    RuntimeObjNonOwningPtrList& associatedList = it->second;
-    associatedList.erase(
-        std::remove(associatedList.begin(), associatedList.end(), object),
-        associatedList.end());
+void ObjInstancesHolder::RemoveObject(const RuntimeObject* object) {
+  auto it = objectsLocations.find(object);
+  if (it == objectsLocations.end()) return;
+
+  ObjectLocation location = it->second;
+  objectsLocations.erase(it);
+
+  // Move the last object at the place of the removed one.
+  if (location.allObjectsIndex != allObjects.size() - 1) {
+    allObjects[location.allObjectsIndex] = allObjects.back();
+    objectsLocations[allObjects[location.allObjectsIndex]].allObjectsIndex =
+        location.allObjectsIndex;
   }
+  allObjects.pop_back();
 
-  AddObject(std::move(theObject));
+  TakeFromList(location);  // The object is destroyed here.
 }
 
-void ObjInstancesHolder::Init(const ObjInstancesHolder& other) {
-  objectsInstances.clear();
+void ObjInstancesHolder::RemoveObjects(const gd::String& name) {
+  auto it = namesIds.find(name);
+  if (it == namesIds.end()) return;
+
+  const RuntimeObjNonOwningPtrList& refsList = objectsInstancesRefs[it->second];
+  while (!refsList.empty()) RemoveObject(refsList.back());
+}
+
+void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject* object) {
+  auto it = objectsLocations.find(object);
+  if (it == objectsLocations.end()) return;
+
+  ObjectLocation& location = it->second;
+  RuntimeObjSPtr theObject = TakeFromList(location);
+  PutInList(std::move(theObject), location);
+}
+
+void ObjInstancesHolder::Clear() {
+  // Forget the objects before destroying them, so that the container is in a
+  // valid state if an object destructor uses it.
+  std::vector<RuntimeObjList> objectsToDestroy;
+  objectsToDestroy.swap(objectsInstances);
+
+  namesIds.clear();
   objectsInstancesRefs.clear();
+  allObjects.clear();
+  objectsLocations.clear();
+}
+
+void ObjInstancesHolder::Init(const ObjInstancesHolder& other) {
+  Clear();
 
-  for (auto it = other.objectsInstances.cbegin();
-       it != other.objectsInstances.cend();
-       ++it) {
-    for (std::size_t i = 0; i < it->second.size();
+  for (const RuntimeObjList& list : other.objectsInstances) {
+    for (std::size_t i = 0; i < list.size();
          ++i)  // We need to really copy the objects
-      AddObject(std::unique_ptr<RuntimeObject>(it->second[i]->Clone()));
+      AddObject(std::unique_ptr<RuntimeObject>(list[i]->Clone()));
   }
 }
 
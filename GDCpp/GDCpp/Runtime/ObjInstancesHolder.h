@@ -1,148 +1,178 @@
-#ifndef OBJINSTANCESHOLDER_H
-#define OBJINSTANCESHOLDER_H
-
-#include <algorithm>
-#include <map>
-#include <memory>
-#include <string>
-#include <unordered_map>
-#include <vector>
-#include "GDCpp/Runtime/RuntimeObject.h"
-#include "GDCpp/Runtime/String.h"
-
-class RuntimeObject;
-
-using RuntimeObjList = std::vector<std::unique_ptr<RuntimeObject>>;
-using RuntimeObjNonOwningPtrList = std::vector<RuntimeObject*>;
-
-using RuntimeObjSPtr = std::unique_ptr<RuntimeObject>;
-
-/**
- * \brief Contains lists of objects classified by the name of the objects.
- *
- * \see RuntimeScene
- * \ingroup GameEngine
- */
-class GD_API ObjInstancesHolder {
- public:
-  /**
-   * \brief Default constructor
-   */
-  ObjInstancesHolder(){};
-
-  /**
-   * \brief Copy constructor
-   * \note All objects contained inside the container copied are also copied.
-   * The new container is fully independent from the original one.
-   */
-  ObjInstancesHolder(const ObjInstancesHolder& other);
-
-  ~ObjInstancesHolder();
-
-  /**
-   * \brief Assignment operator
-   * \note All objects contained inside the container copied are also copied.
-   * The new container is fully independent from the original one.
-   */
-  ObjInstancesHolder& operator=(const ObjInstancesHolder& other);
-
-  /**
-   * \brief Add a new object to the lists.
-   * \note The object is then hold in the container and you can
-   * forget the shared pointer to it.
-   */
-  RuntimeObject* AddObject(RuntimeObjSPtr&& object);
-
-  /**
-   * \brief Get all objects with the specified name
-   */
-  inline const RuntimeObjList& GetObjects(const gd::String& name) {
-    return objectsInstances[name];
-  }
-
-  /**
-   * \brief Get a "raw pointers" list to objects with the specified name
-   */
-  RuntimeObjNonOwningPtrList GetObjectsRawPointers(const gd::String& name);
-
-  /**
-   * \brief Get a list of all objects contained.
-   */
-  inline RuntimeObjNonOwningPtrList GetAllObjects() {
-    RuntimeObjNonOwningPtrList objList;
-
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
-        objList.push_back(it2->get());
-      }
-    }
-
-    return objList;
-  }
-
-  /**
-   * \brief Remove an object
-   *
-   * \warning During the game, do not directly remove an object using this
-   * function, but make its name empty instead. Example: \code
-   * myObject->SetName(""); //The scene will take care of deleting the object
-   * scene.objectsInstances.ObjectNameHasChanged(myObject);
-   * \endcode
-   */
-  inline void RemoveObject(RuntimeObject* object) {
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      RuntimeObjList& associatedList = it->second;
-      associatedList.erase(
-          std::remove_if(
-              associatedList.begin(),
-              associatedList.end(),
-              [&object](const std::unique_ptr<RuntimeObject>& objectPtr) {
-                return objectPtr.get() == object;
-              }),
-          associatedList.end());
-    }
-    for (auto it = objectsInstancesRefs.begin();
-         it != objectsInstancesRefs.end();
-         ++it) {
-      RuntimeObjNonOwningPtrList& associatedList = it->second;
-      associatedList.erase(
-          std::remove(associatedList.begin(), associatedList.end(), object),
-          associatedList.end());
-    }
-  }
-
-  /**
-   * \brief Remove an entire list of object with a given name
-   */
-  inline void RemoveObjects(const gd::String& name) {
-    objectsInstances[name].clear();
-    objectsInstancesRefs[name].clear();
-  }
-
-  /**
-   * \brief To be called when an object has changed its name.
-   */
-  void ObjectNameHasChanged(const RuntimeObject* object);
-
-  /**
-   * \brief Clear the container.
-   * \note All objects contained inside are destroyed.
-   */
-  inline void Clear() {
-    objectsInstances.clear();
-    objectsInstancesRefs.clear();
-  }
-
- private:
-  void Init(const ObjInstancesHolder& other);
-
-  std::unordered_map<gd::String, RuntimeObjList>
-      objectsInstances;  ///< The list of all objects, classified by name
-  std::unordered_map<gd::String, RuntimeObjNonOwningPtrList>
-      objectsInstancesRefs;  ///< Clones of the objectsInstances lists, but with
-                             ///< references instead.
-};
-
-#endif  // OBJINSTANCESHOLDER_H
+#ifndef OBJINSTANCESHOLDER_H
+#define OBJINSTANCESHOLDER_H
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/String.h"
+
+class RuntimeObject;
+
+using RuntimeObjList = std::vector<std::unique_ptr<RuntimeObject>>;
+using RuntimeObjNonOwningPtrList = std::vector<RuntimeObject*>;
+
+using RuntimeObjSPtr = std::unique_ptr<RuntimeObject>;
+
+/**
+ * \brief Contains lists of objects classified by the name of the objects.
+ *
+ * Names are associated to an integer id the first time they are seen, and the
+ * objects of each name are stored in a dense list indexed by this id. The
+ * position of each object is remembered so that removing an object or
+ * changing its name does not need to search for it.
+ *
+ * \warning Removing an object moves the last object of its lists at its
+ * place: the order of the objects is not kept.
+ *
+ * \see RuntimeScene
+ * \ingroup GameEngine
+ */
+class GD_API ObjInstancesHolder {
+ public:
+  /**
+   * \brief Default constructor
+   */
+  ObjInstancesHolder(){};
+
+  /**
+   * \brief Copy constructor
+   * \note All objects contained inside the container copied are also copied.
+   * The new container is fully independent from the original one.
+   */
+  ObjInstancesHolder(const ObjInstancesHolder& other);
+
+  ~ObjInstancesHolder();
+
+  /**
+   * \brief Assignment operator
+   * \note All objects contained inside the container copied are also copied.
+   * The new container is fully independent from the original one.
+   */
+  ObjInstancesHolder& operator=(const ObjInstancesHolder& other);
+
+  /**
+   * \brief Add a new object to the lists.
+   * \note The object is then hold in the container and you can
+   * forget the shared pointer to it.
+   */
+  RuntimeObject* AddObject(RuntimeObjSPtr&& object);
+
+  /**
+   * \brief Add new objects to the lists, allocating the memory for all of them
+   * at once.
+   *
+   * \note This is used for the instances created when a scene or an external
+   * layout is loaded. Objects created by the events ("Create an object"
+   * action) are added one by one with AddObject, as each of them must be on
+   * the scene before the next actions are run.
+   * \see AddObject
+   */
+  void AddObjects(std::vector<RuntimeObjSPtr>&& objects);
+
+  /**
+   * \brief Get all objects with the specified name
+   */
+  inline const RuntimeObjList& GetObjects(const gd::String& name) {
+    return objectsInstances[GetNameId(name)];
+  }
+
+  /**
+   * \brief Get a "raw pointers" list to objects with the specified name
+   */
+  RuntimeObjNonOwningPtrList GetObjectsRawPointers(const gd::String& name);
+
+  /**
+   * \brief Get a list of all objects contained.
+   *
+   * \note The list is kept up to date by the container, so that no copy is
+   * made. Objects added while iterating on it are added at the end of the list,
+   * but removing objects changes the order of the list.
+   */
+  inline const RuntimeObjNonOwningPtrList& GetAllObjects() const {
+    return allObjects;
+  }
+
+  /**
+   * \brief Get the objects that were marked for deletion with
+   * RuntimeObject::DeleteFromScene.
+   *
+   * \note Objects marked for deletion have an empty name, so that they are
+   * gathered in a list that is used as a queue by the scene to delete them
+   * all at once at the end of the frame.
+   */
+  inline const RuntimeObjNonOwningPtrList& GetObjectsToBeDeleted() {
+    return objectsInstancesRefs[GetNameId("")];
+  }
+
+  /**
+   * \brief Remove an object
+   *
+   * \warning During the game, do not directly remove an object using this
+   * function, but make its name empty instead. Example: \code
+   * myObject->SetName(""); //The scene will take care of deleting the object
+   * scene.objectsInstances.ObjectNameHasChanged(myObject);
+   * \endcode
+   */
+  void RemoveObject(const RuntimeObject* object);
+
+  /**
+   * \brief Remove an entire list of object with a given name
+   */
+  void RemoveObjects(const gd::String& name);
+
+  /**
+   * \brief To be called when an object has changed its name.
+   */
+  void ObjectNameHasChanged(const RuntimeObject* object);
+
+  /**
+   * \brief Clear the container.
+   * \note All objects contained inside are destroyed.
+   */
+  void Clear();
+
+ private:
+  /**
+   * \brief The position of an object in the lists of the container.
+   */
+  struct ObjectLocation {
+    std::size_t nameId;           ///< The id of the list of the object.
+    std::size_t index;            ///< The index of the object in its list.
+    std::size_t allObjectsIndex;  ///< The index of the object in allObjects.
+  };
+
+  void Init(const ObjInstancesHolder& other);
+
+  /**
+   * \brief Return the id associated to the name, creating the (empty) list of
+   * objects for this name if needed.
+   */
+  std::size_t GetNameId(const gd::String& name);
+
+  /**
+   * \brief Remove the object from the list it is stored in, and return it.
+   */
+  RuntimeObjSPtr TakeFromList(const ObjectLocation& location);
+
+  /**
+   * \brief Store the object at the end of the list of its name.
+   */
+  void PutInList(RuntimeObjSPtr&& object, ObjectLocation& location);
+
+  std::unordered_map<gd::String, std::size_t>
+      namesIds;  ///< The id of each name, which is the index of its lists.
+  std::vector<RuntimeObjList>
+      objectsInstances;  ///< The list of all objects, classified by name id
+  std::vector<RuntimeObjNonOwningPtrList>
+      objectsInstancesRefs;  ///< Clones of the objectsInstances lists, but with
+                             ///< references instead.
+  RuntimeObjNonOwningPtrList allObjects;  ///< All the objects, in no order.
+  std::unordered_map<const RuntimeObject*, ObjectLocation>
+      objectsLocations;  ///< The position of each object in the lists.
+};
+
+#endif  // OBJINSTANCESHOLDER_H
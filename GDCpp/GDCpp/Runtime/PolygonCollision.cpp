@@ -61,9 +61,19 @@ float distance(float minA, float maxA, float minB, float maxB) {
 
 }  // namespace
 
-CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
-                                            Polygon2d& p2,
+CollisionResult GD_API PolygonCollisionTest(const Polygon2d& p1,
+                                            const Polygon2d& p2,
                                             bool ignoreTouchingEdges) {
+  p1.ComputeEdges();
+  p2.ComputeEdges();
+
+  return PolygonCollisionTestWithComputedEdges(p1, p2, ignoreTouchingEdges);
+}
+
+CollisionResult GD_API
+PolygonCollisionTestWithComputedEdges(const Polygon2d& p1,
+                                      const Polygon2d& p2,
+                                      bool ignoreTouchingEdges) {
   if (p1.vertices.size() < 3 || p2.vertices.size() < 3) {
     CollisionResult result;
     result.collision = false;
@@ -72,9 +82,6 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
     return result;
   }
 
-  p1.ComputeEdges();
-  p2.ComputeEdges();
-
   sf::Vector2f edge;
   sf::Vector2f move_axis(0, 0);
   sf::Vector2f mtd(0, 0);
@@ -133,7 +140,7 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
 }
 
 RaycastResult GD_API PolygonRaycastTest(
-    Polygon2d& poly, float startX, float startY, float endX, float endY) {
+    const Polygon2d& poly, float startX, float startY, float endX, float endY) {
   RaycastResult result;
   result.collision = false;
 
@@ -216,7 +223,7 @@ RaycastResult GD_API PolygonRaycastTest(
   return result;
 }
 
-bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y) {
+bool GD_API IsPointInsidePolygon(const Polygon2d& poly, float x, float y) {
   bool inside = false;
   sf::Vector2f vi, vj;
 
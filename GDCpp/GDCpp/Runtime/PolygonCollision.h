@@ -44,10 +44,22 @@ struct RaycastResult {
  *
  * \ingroup GameEngine
  */
-CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
-                                            Polygon2d& p2,
+CollisionResult GD_API PolygonCollisionTest(const Polygon2d& p1,
+                                            const Polygon2d& p2,
                                             bool ignoreTouchingEdges = false);
 
+/**
+ * Same as PolygonCollisionTest, but the edges of the polygons are supposed to
+ * be already computed (see Polygon2d::ComputeEdges), which avoids computing
+ * them again when the same polygons are tested multiple times.
+ *
+ * \ingroup GameEngine
+ */
+CollisionResult GD_API
+PolygonCollisionTestWithComputedEdges(const Polygon2d& p1,
+                                      const Polygon2d& p2,
+                                      bool ignoreTouchingEdges = false);
+
 /**
  * Do a raycast test.
  * \warning Polygon must be convex.
@@ -59,7 +71,7 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
  * \ingroup GameEngine
  */
 RaycastResult GD_API PolygonRaycastTest(
-    Polygon2d& poly, float startX, float startY, float endX, float endY);
+    const Polygon2d& poly, float startX, float startY, float endX, float endY);
 
 /**
  * Check if a point is inside a polygon.
@@ -71,6 +83,6 @@ RaycastResult GD_API PolygonRaycastTest(
  *
  * \ingroup GameEngine
  */
-bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y);
+bool GD_API IsPointInsidePolygon(const Polygon2d& poly, float x, float y);
 
 #endif  // POLYGONCOLLISION_H
@@ -20,6 +20,66 @@
 
 using namespace std;
 
+namespace {
+
+/**
+ * \brief A read-only stream buffer over a buffer of the resource file, kept
+ * alive as long as the stream exists.
+ */
+class SharedBufferStreamBuf : public std::streambuf {
+ public:
+  SharedBufferStreamBuf(std::shared_ptr<char> buffer_, std::size_t size)
+      : buffer(std::move(buffer_)) {
+    setg(buffer.get(), buffer.get(), buffer.get() + size);
+  }
+
+ private:
+  std::shared_ptr<char> buffer;
+};
+
+#if defined(ANDROID)
+/**
+ * \brief A read-only stream buffer reading a SFML input stream (used to read
+ * the files of the application package) by chunks.
+ */
+class SFMLInputStreamBuf : public std::streambuf {
+ public:
+  SFMLInputStreamBuf(std::unique_ptr<sf::InputStream> stream_)
+      : stream(std::move(stream_)) {}
+
+ protected:
+  int_type underflow() override {
+    sf::Int64 count = stream->read(chunk, sizeof(chunk));
+    if (count <= 0) return traits_type::eof();
+
+    setg(chunk, chunk, chunk + count);
+    return traits_type::to_int_type(chunk[0]);
+  }
+
+ private:
+  std::unique_ptr<sf::InputStream> stream;
+  char chunk[4096];
+};
+#endif
+
+/**
+ * \brief An input stream owning its stream buffer.
+ */
+template <class StreamBuf>
+class OwningIStream : public std::istream {
+ public:
+  template <class... Args>
+  OwningIStream(Args&&... args)
+      : std::istream(nullptr), streamBuf(std::forward<Args>(args)...) {
+    rdbuf(&streamBuf);
+  }
+
+ private:
+  StreamBuf streamBuf;
+};
+
+}  // namespace
+
 namespace gd {
 
 ResourcesLoader* ResourcesLoader::_singleton = NULL;
@@ -36,12 +96,12 @@ bool ResourcesLoader::SetResourceFile(const gd::String& filename) {
 void ResourcesLoader::LoadSFMLImage(const gd::String& filename,
                                     sf::Image& image) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a SFML image from resource file: "
            << filename << endl;
 
-    if (!image.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+    if (!image.loadFromMemory(buffer.get(), resFile.GetFileSize(filename)))
       cout << "Failed to load a SFML image from resource file: " << filename
            << endl;
   } else {
@@ -62,12 +122,12 @@ sf::Texture ResourcesLoader::LoadSFMLTexture(const gd::String& filename) {
 void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
                                       sf::Texture& texture) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a SFML texture from resource file: "
            << filename << endl;
 
-    if (!texture.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+    if (!texture.loadFromMemory(buffer.get(), resFile.GetFileSize(filename)))
       cout << "Failed to load a SFML texture from resource file: " << filename
            << endl;
   } else {
@@ -80,7 +140,7 @@ void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
 std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
     const gd::String& filename) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
     size_t bufferSize = resFile.GetFileSize(filename);
     if (buffer == nullptr) {
       cout << "Failed to get the file of a font from resource file:" << filename
@@ -88,19 +148,17 @@ std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
+    // The font reads the buffer as long as it is used: keep the buffer alive
+    // alongside the font, without copying it.
     sf::Font* font = new sf::Font();
-    char* fontBuffer = new char[bufferSize];
-    memcpy(fontBuffer, buffer, bufferSize);
-
-    if (!font->loadFromMemory(fontBuffer, bufferSize)) {
+    if (!font->loadFromMemory(buffer.get(), bufferSize)) {
       cout << "Failed to load a font from resource file: " << filename << endl;
       delete font;
-      delete fontBuffer;
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
     StreamHolder* streamHolder = new StreamHolder();
-    streamHolder->buffer = fontBuffer;
+    streamHolder->buffer = buffer;
     return std::make_pair(font, streamHolder);
   } else {
     sf::Font* font = new sf::Font();
@@ -121,13 +179,20 @@ std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
 sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
   sf::SoundBuffer sbuffer;
 
+  LoadSoundBuffer(filename, sbuffer);
+
+  return sbuffer;
+}
+
+void ResourcesLoader::LoadSoundBuffer(const gd::String& filename,
+                                      sf::SoundBuffer& sbuffer) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a sound buffer from resource file: "
            << filename << endl;
 
-    if (!sbuffer.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+    if (!sbuffer.loadFromMemory(buffer.get(), resFile.GetFileSize(filename)))
       cout << "Failed to load a sound buffer from resource file: " << filename
            << endl;
   } else {
@@ -135,19 +200,18 @@ sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
     if (!stream.open(filename) || !sbuffer.loadFromStream(stream))
       cout << "Failed to load a sound buffer: " << filename << endl;
   }
-
-  return sbuffer;
 }
 
 gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
   gd::String text;
 
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
     if (!buffer) {
       cout << "Failed to read a file from resource file: " << filename << endl;
     } else {
-      text = gd::String::FromUTF8(std::string(buffer));
+      text = gd::String::FromUTF8(
+          std::string(buffer.get(), resFile.GetFileSize(filename)));
     }
   } else {
     char* buffer = LoadBinaryFile(filename);
@@ -167,12 +231,19 @@ gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
  */
 char* ResourcesLoader::LoadBinaryFile(const gd::String& filename) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
-    if (buffer == NULL)
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
+    if (buffer == NULL) {
       cout << "Failed to read a binary file from resource file: " << filename
            << endl;
+      return NULL;
+    }
 
-    return buffer;
+    // Return a copy owned by the caller, like for the files read from the
+    // disk, so that the uncompressed file can be freed.
+    std::size_t size = resFile.GetFileSize(filename);
+    char* memblock = new char[size];
+    memcpy(memblock, buffer.get(), size);
+    return memblock;
   } else {
 #if defined(ANDROID)
     sf::FileInputStream file;
@@ -220,6 +291,35 @@ long int ResourcesLoader::GetBinaryFileSize(const gd::String& filename) {
   return 0;
 }
 
+std::unique_ptr<std::istream> ResourcesLoader::OpenFileStream(
+    const gd::String& filename) {
+  if (resFile.ContainsFile(filename)) {
+    std::shared_ptr<char> buffer = resFile.GetFile(filename);
+    if (!buffer) {
+      cout << "Failed to read a file from resource file: " << filename << endl;
+      return nullptr;
+    }
+
+    return std::unique_ptr<std::istream>(
+        new OwningIStream<SharedBufferStreamBuf>(
+            std::move(buffer), resFile.GetFileSize(filename)));
+  }
+
+#if defined(ANDROID)
+  std::unique_ptr<sf::FileInputStream> file(new sf::FileInputStream);
+  if (file->open(filename.ToLocale()))
+    return std::unique_ptr<std::istream>(
+        new OwningIStream<SFMLInputStreamBuf>(std::move(file)));
+#else
+  std::unique_ptr<gd::FileStream> file(
+      new gd::FileStream(filename, ios::in | ios::binary));
+  if (file->is_open()) return std::move(file);
+#endif
+
+  cout << "File " << filename << " can't be opened." << endl;
+  return nullptr;
+}
+
 bool ResourcesLoader::HasFile(const gd::String& filename) {
   return resFile.ContainsFile(filename);
 }
@@ -16,6 +16,8 @@
 class Music;
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
+#include <istream>
+#include <memory>
 #include <string>
 #include "GDCpp/Runtime/String.h"
 #include "GDCpp/Runtime/Tools/FileStream.h"
@@ -28,12 +30,9 @@ namespace gd {
  * that needs their buffer/stream continuously opened)
  */
 struct StreamHolder {
-  StreamHolder() : buffer(nullptr), stream() {}
-  ~StreamHolder() {
-    if (buffer) delete buffer;
-  }
+  StreamHolder() : stream() {}
 
-  char *buffer;
+  std::shared_ptr<char> buffer;  ///< A buffer of the resource file.
   gd::SFMLFileStream stream;
 };
 
@@ -59,6 +58,8 @@ class GD_API ResourcesLoader {
   std::pair<sf::Font *, StreamHolder *> LoadFont(const gd::String &filename);
 
   sf::SoundBuffer LoadSoundBuffer(const gd::String &filename);
+  void LoadSoundBuffer(const gd::String &filename,
+                       sf::SoundBuffer &soundBuffer);
 
   gd::String LoadPlainText(const gd::String &filename);
 
@@ -66,6 +67,13 @@ class GD_API ResourcesLoader {
 
   long int GetBinaryFileSize(const gd::String &filename);
 
+  /**
+   * \brief Open a stream reading a file. When the file is in the resource
+   * file, the stream reads its buffer in place instead of copying it.
+   * \return The stream, or nullptr if the file can't be opened.
+   */
+  std::unique_ptr<std::istream> OpenFileStream(const gd::String &filename);
+
   bool HasFile(const gd::String &filename);
 
   static ResourcesLoader *Get() {
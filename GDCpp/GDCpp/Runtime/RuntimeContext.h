@@ -1,68 +1,145 @@
-#ifndef RUNTIMECONTEXT_H
-#define RUNTIMECONTEXT_H
-
-#include <map>
-#include <string>
-#include <vector>
-#include "GDCpp/Runtime/String.h"
-class RuntimeObject;
-class RuntimeScene;
-class RuntimeVariablesContainer;
-
-/**
- * \brief Helper class used by events generated code to get access to
- * various things without including "heavy" classes such as RuntimeScene.
- */
-class GD_API RuntimeContext {
- public:
-  /**
-   * \brief Construct the context for a scene.
-   * \param scene The scene associated to the context.
-   */
-  RuntimeContext(RuntimeScene *scene_) : scene(scene_){};
-  virtual ~RuntimeContext(){};
-
-  /**
-   * \brief Shortcut to get a "raw pointers" list to objects with a specific
-   * name. Equivalent to : \code
-   * scene->objectsInstances.GetObjectsRawPointers(name)
-   * \endcode
-   */
-  std::vector<RuntimeObject *> GetObjectsRawPointers(const gd::String &name);
-
-  /**
-   * \brief Shortcut for scene->GetVariables();
-   */
-  RuntimeVariablesContainer &GetSceneVariables();
-
-  /**
-   * \brief Shortcut for scene.game->GetVariables();
-   */
-  RuntimeVariablesContainer &GetGameVariables();
-
-  /**
-   * \brief Used by "Trigger once" conditions: Return true only if
-   * this method was not called with the same identifier during the last frame.
-   */
-  bool TriggerOnce(std::size_t conditionId);
-
-  /**
-   * \brief To be called when events begin so that "Trigger once" conditions
-   * are properly handled.
-   */
-  void StartNewFrame();
-
-  RuntimeContext &ClearObjectListsMap();
-  RuntimeContext &AddObjectListToMap(const gd::String &objectName,
-                                     std::vector<RuntimeObject *> &list);
-  std::map<gd::String, std::vector<RuntimeObject *> *> ReturnObjectListsMap();
-
-  RuntimeScene *scene;  ///< The associated scene.
-
- private:
-  std::map<gd::String, std::vector<RuntimeObject *> *> temporaryMap;
-  std::map<std::size_t, bool> onceConditionsTriggered;
-  std::map<std::size_t, bool> onceConditionsTriggeredLastFrame;
-};
-
-#endif  // RUNTIMECONTEXT_H
+#ifndef RUNTIMECONTEXT_H
+#define RUNTIMECONTEXT_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
+#include "GDCpp/Runtime/String.h"
+class RuntimeObject;
+class RuntimeScene;
+class RuntimeVariablesContainer;
+
+/**
+ * \brief Helper class used by events generated code to get access to
+ * various things without including "heavy" classes such as RuntimeScene.
+ */
+class GD_API RuntimeContext {
+ public:
+  /**
+   * \brief Construct the context for a scene.
+   * \param scene The scene associated to the context.
+   */
+  RuntimeContext(RuntimeScene *scene_)
+      : scene(scene_), currentObjectListsMap(nullptr){};
+
+  /**
+   * \brief Copy the context. The objects lists of \a other are not copied, as
+   * they are only used while calling a function.
+   */
+  RuntimeContext(const RuntimeContext &other)
+      : scene(other.scene),
+        currentObjectListsMap(nullptr),
+        onceConditionsTriggered(other.onceConditionsTriggered),
+        onceConditionsTriggeredLastFrame(
+            other.onceConditionsTriggeredLastFrame){};
+  RuntimeContext &operator=(const RuntimeContext &other) {
+    scene = other.scene;
+    onceConditionsTriggered = other.onceConditionsTriggered;
+    onceConditionsTriggeredLastFrame = other.onceConditionsTriggeredLastFrame;
+    return *this;
+  }
+  virtual ~RuntimeContext(){};
+
+  /**
+   * \brief Shortcut to get a "raw pointers" list to objects with a specific
+   * name. Equivalent to : \code
+   * scene->objectsInstances.GetObjectsRawPointers(name)
+   * \endcode
+   */
+  std::vector<RuntimeObject *> GetObjectsRawPointers(const gd::String &name);
+
+  /**
+   * \brief Shortcut for scene->GetVariables();
+   */
+  RuntimeVariablesContainer &GetSceneVariables();
+
+  /**
+   * \brief Shortcut for scene.game->GetVariables();
+   */
+  RuntimeVariablesContainer &GetGameVariables();
+
+  /**
+   * \brief Used by "Trigger once" conditions: Return true only if
+   * this method was not called with the same identifier during the last frame.
+   */
+  bool TriggerOnce(std::size_t conditionId);
+
+  /**
+   * \brief To be called when events begin so that "Trigger once" conditions
+   * are properly handled.
+   */
+  void StartNewFrame();
+
+  /**
+   * \brief Give access to lists taken from the pool of a RuntimeContext, and
+   * give them back to the pool when destroyed.
+   *
+   * Events generated code passes the handle, a temporary, to a function taking
+   * a RuntimeObjectsLists: the lists are released once the function returns.
+   */
+  class ObjectListsHandle {
+   public:
+    ObjectListsHandle(RuntimeContext &context_, RuntimeObjectsLists &lists_)
+        : context(&context_), lists(&lists_){};
+    ObjectListsHandle(ObjectListsHandle &&other)
+        : context(other.context), lists(other.lists) {
+      other.context = nullptr;
+    };
+    ObjectListsHandle(const ObjectListsHandle &) = delete;
+    ObjectListsHandle &operator=(const ObjectListsHandle &) = delete;
+    ~ObjectListsHandle() {
+      if (context) context->ReleaseObjectListsMap(*lists);
+    };
+
+    operator RuntimeObjectsLists &() const { return *lists; }
+
+    /**
+     * \brief Convert the lists to a map, for functions still taking a
+     * std::map.
+     */
+    operator std::map<gd::String, std::vector<RuntimeObject *> *>() const {
+      return *lists;
+    }
+
+   private:
+    RuntimeContext *context;  ///< The context owning the lists, or nullptr if
+                              ///< the lists were moved to another handle.
+    RuntimeObjectsLists *lists;
+  };
+
+  /** \name Objects lists passed to functions
+   * Used by events generated code to create the lists of objects passed to
+   * the functions of conditions and actions.
+   *
+   * Lists are taken from a pool of reused RuntimeObjectsLists, so that
+   * creating them does not allocate memory once the pool is warmed up. They
+   * are given back to the pool when the handle returned by
+   * ReturnObjectListsMap is destroyed, so any number of lists can be used at
+   * once.
+   */
+  ///@{
+  RuntimeContext &ClearObjectListsMap();
+  RuntimeContext &AddObjectListToMap(const gd::String &objectName,
+                                     std::vector<RuntimeObject *> &list);
+  RuntimeContext &AddObjectListToMap(const char *objectName,
+                                     std::vector<RuntimeObject *> &list);
+  ObjectListsHandle ReturnObjectListsMap();
+  ///@}
+
+  RuntimeScene *scene;  ///< The associated scene.
+
+ private:
+  void ReleaseObjectListsMap(RuntimeObjectsLists &lists);
+
+  std::vector<std::unique_ptr<RuntimeObjectsLists> >
+      objectListsMaps;  ///< All the lists of the pool.
+  std::vector<RuntimeObjectsLists *>
+      freeObjectListsMaps;  ///< The lists of the pool not in use.
+  RuntimeObjectsLists *currentObjectListsMap;  ///< The lists being filled.
+  std::map<std::size_t, bool> onceConditionsTriggered;
+  std::map<std::size_t, bool> onceConditionsTriggeredLastFrame;
+};
+
+#endif  // RUNTIMECONTEXT_H
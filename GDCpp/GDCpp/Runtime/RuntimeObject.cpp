@@ -8,6 +8,8 @@
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCpp/Extensions/Builtin/MathematicalTools.h"
@@ -20,6 +22,19 @@
 
 using namespace std;
 
+std::size_t RuntimeObject::GetBehaviorSlot(const gd::String &name) {
+  static std::mutex slotsMutex;
+  static std::unordered_map<gd::String, std::size_t> slots;
+
+  std::lock_guard<std::mutex> lock(slotsMutex);
+  auto it = slots.find(name);
+  if (it != slots.end()) return it->second;
+
+  std::size_t slot = slots.size();
+  slots[name] = slot;
+  return slot;
+}
+
 RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
     : name(object.GetName()),
       type(object.GetType()),
@@ -37,6 +52,10 @@ RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
        ++it) {
     behaviors[it->first] = std::unique_ptr<gd::Behavior>(it->second->Clone());
     behaviors[it->first]->SetOwner(this);
+
+    std::size_t slot = GetBehaviorSlot(it->first);
+    if (slot >= behaviorsSlots.size()) behaviorsSlots.resize(slot + 1, NULL);
+    behaviorsSlots[slot] = behaviors[it->first].get();
   }
 }
 
@@ -54,12 +73,15 @@ void RuntimeObject::Init(const RuntimeObject &object) {
   layer = object.layer;
   force5 = object.force5;
   forces = object.forces;
+  transformedHitBoxes = object.transformedHitBoxes;
 
   behaviors.clear();
+  behaviorsSlots.assign(object.behaviorsSlots.size(), NULL);
   for (auto it = object.behaviors.cbegin(); it != object.behaviors.cend();
        ++it) {
     behaviors[it->first] = std::unique_ptr<gd::Behavior>(it->second->Clone());
     behaviors[it->first]->SetOwner(this);
+    behaviorsSlots[GetBehaviorSlot(it->first)] = behaviors[it->first].get();
   }
 }
 
@@ -223,15 +245,18 @@ void RuntimeObject::AddForceToMoveAround(float positionX,
 
 void RuntimeObject::Duplicate(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   RuntimeObject *newObject =
       scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(Clone()));
 
-  if (pickedObjectLists[name] != NULL &&
-      find(pickedObjectLists[name]->begin(),
-           pickedObjectLists[name]->end(),
-           newObject) == pickedObjectLists[name]->end())
-    pickedObjectLists[name]->push_back(newObject);
+  RuntimeObjectsLists::const_iterator pickedObjects =
+      pickedObjectLists.find(name);
+  if (pickedObjects != pickedObjectLists.end() &&
+      pickedObjects->second != NULL &&
+      find(pickedObjects->second->begin(),
+           pickedObjects->second->end(),
+           newObject) == pickedObjects->second->end())
+    pickedObjects->second->push_back(newObject);
 }
 
 bool RuntimeObject::IsStopped() { return TotalForceLength() == 0; }
@@ -283,11 +308,10 @@ double RuntimeObject::GetDistanceWithObject(RuntimeObject *object) {
 }
 
 bool RuntimeObject::SeparateFromObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     bool ignoreTouchingEdges) {
   vector<RuntimeObject *> objects;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
-           pickedObjectLists.begin();
+  for (RuntimeObjectsLists::const_iterator it = pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
     if (it->second != NULL) {
@@ -306,12 +330,20 @@ bool RuntimeObject::SeparateFromObjects(
   sf::Vector2f moveVector;
   for (std::size_t j = 0; j < objects.size(); ++j) {
     if (objects[j] != this) {
-      std::vector<Polygon2d> hitBoxes = GetHitBoxes(objects[j]->GetAABB());
-      vector<Polygon2d> otherHitBoxes = objects[j]->GetHitBoxes(GetAABB());
-      for (std::size_t k = 0; k < hitBoxes.size(); ++k) {
-        for (std::size_t l = 0; l < otherHitBoxes.size(); ++l) {
-          CollisionResult result = PolygonCollisionTest(
-              hitBoxes[k], otherHitBoxes[l], ignoreTouchingEdges);
+      const TransformedHitBoxes &hitBoxes =
+          GetTransformedHitBoxes(objects[j]->GetAABB());
+      const TransformedHitBoxes &otherHitBoxes =
+          objects[j]->GetTransformedHitBoxes(GetAABB());
+      for (std::size_t k = 0; k < hitBoxes.GetPolygons().size(); ++k) {
+        for (std::size_t l = 0; l < otherHitBoxes.GetPolygons().size(); ++l) {
+          if (TransformedHitBoxes::AreSeparated(
+                  hitBoxes.GetPolygonAABB(k), otherHitBoxes.GetPolygonAABB(l)))
+            continue;
+
+          CollisionResult result = PolygonCollisionTestWithComputedEdges(
+              hitBoxes.GetPolygons()[k],
+              otherHitBoxes.GetPolygons()[l],
+              ignoreTouchingEdges);
           if (result.collision) {
             moveVector += result.move_axis;
             moved = true;
@@ -395,12 +427,19 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
   sf::FloatRect objRect = obj1->GetAABB();
   sf::FloatRect obj2Rect = obj2->GetAABB();
 
-  vector<Polygon2d> objHitboxes = obj1->GetHitBoxes(obj2Rect);
-  vector<Polygon2d> obj2Hitboxes = obj2->GetHitBoxes(objRect);
-  for (std::size_t k = 0; k < objHitboxes.size(); ++k) {
-    for (std::size_t l = 0; l < obj2Hitboxes.size(); ++l) {
-      if (PolygonCollisionTest(
-              objHitboxes[k], obj2Hitboxes[l], ignoreTouchingEdges)
+  const TransformedHitBoxes &objHitboxes =
+      obj1->GetTransformedHitBoxes(obj2Rect);
+  const TransformedHitBoxes &obj2Hitboxes =
+      obj2->GetTransformedHitBoxes(objRect);
+  for (std::size_t k = 0; k < objHitboxes.GetPolygons().size(); ++k) {
+    for (std::size_t l = 0; l < obj2Hitboxes.GetPolygons().size(); ++l) {
+      if (TransformedHitBoxes::AreSeparated(objHitboxes.GetPolygonAABB(k),
+                                            obj2Hitboxes.GetPolygonAABB(l)))
+        continue;
+
+      if (PolygonCollisionTestWithComputedEdges(objHitboxes.GetPolygons()[k],
+                                                obj2Hitboxes.GetPolygons()[l],
+                                                ignoreTouchingEdges)
               .collision)
         return true;
     }
@@ -410,7 +449,8 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
 }
 
 bool RuntimeObject::IsCollidingWithPoint(float pointX, float pointY) {
-  vector<Polygon2d> hitBoxes = GetHitBoxes();
+  const std::vector<Polygon2d> &hitBoxes =
+      GetTransformedHitBoxes(GetAABB()).GetPolygons();
   for (std::size_t i = 0; i < hitBoxes.size(); ++i) {
     if (IsPointInsidePolygon(hitBoxes[i], pointX, pointY)) return true;
   }
@@ -436,7 +476,8 @@ RaycastResult RuntimeObject::RaycastTest(
 
   float testSqDist = closest ? sqDist : 0.0f;
 
-  vector<Polygon2d> hitboxes = GetHitBoxes();
+  const std::vector<Polygon2d> &hitboxes =
+      GetTransformedHitBoxes(GetAABB()).GetPolygons();
   for (std::size_t i = 0; i < hitboxes.size(); ++i) {
     RaycastResult res = PolygonRaycastTest(hitboxes[i], x, y, endX, endY);
 
@@ -456,10 +497,9 @@ RaycastResult RuntimeObject::RaycastTest(
 }
 
 void RuntimeObject::SeparateObjectsWithoutForces(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   vector<RuntimeObject *> objects2;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
-           pickedObjectLists.begin();
+  for (RuntimeObjectsLists::const_iterator it = pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
     if (it->second != NULL) {
@@ -496,10 +536,9 @@ void RuntimeObject::SeparateObjectsWithoutForces(
 }
 
 void RuntimeObject::SeparateObjectsWithForces(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   vector<RuntimeObject *> objects2;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
-           pickedObjectLists.begin();
+  for (RuntimeObjectsLists::const_iterator it = pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
     if (it->second != NULL) {
@@ -625,6 +664,14 @@ std::vector<Polygon2d> RuntimeObject::GetHitBoxes(sf::FloatRect hint) const {
   return GetHitBoxes();
 }
 
+const TransformedHitBoxes &RuntimeObject::GetTransformedHitBoxes(
+    sf::FloatRect hint) const {
+  transformedHitBoxes.GetPolygons() = GetHitBoxes(hint);
+  transformedHitBoxes.Update();
+
+  return transformedHitBoxes;
+}
+
 bool RuntimeObject::CursorOnObject(RuntimeScene &scene, bool) {
   RuntimeLayer &theLayer = scene.GetRuntimeLayer(layer);
   auto insideObject = [this](const sf::Vector2f &pos) {
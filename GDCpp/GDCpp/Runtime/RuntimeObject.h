@@ -14,8 +14,10 @@
 #include "GDCore/Tools/MakeUnique.h"
 #include "GDCpp/Runtime/Force.h"
 #include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
 #include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/TransformedHitBoxes.h"
 namespace gd {
 class InitialInstance;
 }
@@ -182,6 +184,28 @@ class GD_API RuntimeObject {
    */
   gd::Behavior* GetBehaviorRawPointer(const gd::String& name) const;
 
+  /**
+   * \brief Return the behavior stored in the specified slot, or NULL if the
+   * object has no behavior with the name associated to this slot.
+   *
+   * Used by GD events generated code, which resolves the slots of the
+   * behaviors once instead of looking up behaviors by their names.
+   *
+   * \see RuntimeObject::GetBehaviorSlot
+   */
+  gd::Behavior* GetBehaviorInSlot(std::size_t slot) const {
+    return slot < behaviorsSlots.size() ? behaviorsSlots[slot] : NULL;
+  };
+
+  /**
+   * \brief Return the slot associated to the behaviors having the specified
+   * name.
+   *
+   * Slots are shared by all objects: behaviors with the same name are stored in
+   * the same slot, whatever the type of the object.
+   */
+  static std::size_t GetBehaviorSlot(const gd::String& name);
+
   /**
    * \brief Return true if the object has the behavior with the specified name.
    */
@@ -261,6 +285,21 @@ class GD_API RuntimeObject {
    */
   virtual std::vector<Polygon2d> GetHitBoxes(sf::FloatRect hint) const;
 
+  /**
+   * \brief Get the object hitbox(es) preferably intersecting with hint, with
+   * their edges and bounding boxes computed.
+   *
+   * Used by collision tests to avoid copying the hitboxes. Objects able to
+   * cache their hitboxes should redefine this method.
+   *
+   * \note The default implementation stores the result of GetHitBoxes(hint)
+   * in a buffer owned by the object.
+   * \warning The returned reference is invalidated by the next call to this
+   * method or by any change made to the object.
+   */
+  virtual const TransformedHitBoxes& GetTransformedHitBoxes(
+      sf::FloatRect hint) const;
+
   /**
    * \brief Check collision between two objects using their hitboxes.
    *
@@ -575,7 +614,7 @@ class GD_API RuntimeObject {
 
   void Duplicate(
       RuntimeScene& scene,
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      const RuntimeObjectsLists& pickedObjectLists);
   void ActivateBehavior(const gd::String& behaviorName, bool activate = true);
   bool BehaviorActivated(const gd::String& behaviorName);
 
@@ -586,18 +625,17 @@ class GD_API RuntimeObject {
   double GetDistanceWithObject(RuntimeObject* other);
 
   bool SeparateFromObjects(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists,
+      const RuntimeObjectsLists& pickedObjectLists,
       bool ignoreTouchingEdges = false);
 
   /** \deprecated
    */
   void SeparateObjectsWithoutForces(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      const RuntimeObjectsLists& pickedObjectLists);
 
   /** \deprecated
    */
-  void SeparateObjectsWithForces(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+  void SeparateObjectsWithForces(const RuntimeObjectsLists& pickedObjectLists);
   ///@}
 
  protected:
@@ -613,9 +651,14 @@ class GD_API RuntimeObject {
   std::map<gd::String, std::unique_ptr<gd::Behavior>>
       behaviors;  ///< Contains all behaviors of the object. Behaviors are the
                   ///< ownership of the object
+  std::vector<gd::Behavior*>
+      behaviorsSlots;  ///< The behaviors, indexed by their slot (NULL for the
+                       ///< slots not used by the object).
   RuntimeVariablesContainer
       objectVariables;        ///< List of the variables of the object
   std::vector<Force> forces;  ///< Forces applied to the object
+  mutable TransformedHitBoxes
+      transformedHitBoxes;  ///< Buffer returned by GetTransformedHitBoxes.
 
   /**
    * \brief Initialize object using another object. Used by copy-ctor and
@@ -0,0 +1,153 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef RUNTIMEOBJECTSLISTS_H
+#define RUNTIMEOBJECTSLISTS_H
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+class RuntimeObject;
+
+/**
+ * \brief The lists of picked objects passed by events generated code to the
+ * functions of conditions and actions, associated to the name of the objects.
+ *
+ * This is a flat, index-addressed replacement for a
+ * std::map<gd::String, std::vector<RuntimeObject*>*>: it can be used and
+ * iterated the same way (lists are sorted by object name), but its memory is
+ * kept when it is cleared so that it can be filled again without allocating.
+ *
+ * It also stores a boolean for each object of the lists (see GetPickedFlags),
+ * used as scratch memory by the picking functions.
+ *
+ * \see RuntimeContext::ReturnObjectListsMap
+ * \ingroup GameEngine
+ */
+class GD_API RuntimeObjectsLists {
+ public:
+  typedef std::pair<gd::String, std::vector<RuntimeObject *> *> value_type;
+  typedef std::vector<value_type>::iterator iterator;
+  typedef std::vector<value_type>::const_iterator const_iterator;
+
+  RuntimeObjectsLists() : listsCount(0){};
+  RuntimeObjectsLists(
+      const std::map<gd::String, std::vector<RuntimeObject *> *> &map)
+      : lists(map.begin(), map.end()), listsCount(map.size()){};
+  RuntimeObjectsLists(const RuntimeObjectsLists &other)
+      : lists(other.begin(), other.end()), listsCount(other.size()){};
+  virtual ~RuntimeObjectsLists(){};
+
+  RuntimeObjectsLists &operator=(const RuntimeObjectsLists &other) {
+    if (this != &other) {
+      lists.assign(other.begin(), other.end());
+      listsCount = other.size();
+    }
+    return *this;
+  }
+
+  /**
+   * \brief Convert the lists to a map, for functions still taking a std::map.
+   */
+  operator std::map<gd::String, std::vector<RuntimeObject *> *>() const {
+    return std::map<gd::String, std::vector<RuntimeObject *> *>(begin(),
+                                                                end());
+  }
+
+  iterator begin() { return lists.begin(); }
+  iterator end() { return lists.begin() + listsCount; }
+  const_iterator begin() const { return lists.begin(); }
+  const_iterator end() const { return lists.begin() + listsCount; }
+
+  std::size_t size() const { return listsCount; }
+  bool empty() const { return listsCount == 0; }
+
+  /**
+   * \brief Remove all the lists. The memory is kept to be reused.
+   */
+  void clear() { listsCount = 0; }
+
+  /**
+   * \brief Return the list associated to the object name, inserting a null
+   * list if there is no list for this name.
+   */
+  std::vector<RuntimeObject *> *&operator[](const gd::String &name) {
+    return GetOrInsert(name);
+  }
+
+  /**
+   * \brief Same as operator[], without creating a gd::String from the name.
+   */
+  std::vector<RuntimeObject *> *&operator[](const char *name) {
+    return GetOrInsert(name);
+  }
+
+  /**
+   * \brief Return an iterator to the list associated to the object name, or
+   * end() if there is none.
+   */
+  const_iterator find(const gd::String &name) const {
+    const_iterator it = std::lower_bound(begin(), end(), name, CompareName());
+    return (it != end() && it->first == name) ? it : end();
+  }
+
+  /**
+   * \brief Resize the flags of each list to the size of the list, and set them
+   * to false.
+   *
+   * \note Flags are scratch memory for the picking functions: their content
+   * must not be relied on by anything else.
+   */
+  void ResetPickedFlags() const {
+    if (pickedFlags.size() < listsCount) pickedFlags.resize(listsCount);
+    for (std::size_t i = 0; i < listsCount; ++i)
+      pickedFlags[i].assign(lists[i].second ? lists[i].second->size() : 0,
+                            false);
+  }
+
+  /**
+   * \brief Get the flags of the list at the specified index, as set up by the
+   * last call to ResetPickedFlags.
+   */
+  std::vector<bool> &GetPickedFlags(std::size_t index) const {
+    return pickedFlags[index];
+  }
+
+ private:
+  struct CompareName {
+    template <typename Name>
+    bool operator()(const value_type &list, const Name &name) const {
+      return list.first < name;
+    }
+  };
+
+  template <typename Name>
+  std::vector<RuntimeObject *> *&GetOrInsert(const Name &name) {
+    iterator it = std::lower_bound(begin(), end(), name, CompareName());
+    if (it != end() && it->first == name) return it->second;
+
+    // Reuse the first unused list, and move it to keep the lists sorted.
+    std::size_t position = it - begin();
+    if (listsCount == lists.size()) lists.push_back(value_type());
+    std::rotate(lists.begin() + position,
+                lists.begin() + listsCount,
+                lists.begin() + listsCount + 1);
+    listsCount++;
+
+    lists[position].first = name;
+    lists[position].second = nullptr;
+    return lists[position].second;
+  }
+
+  std::vector<value_type> lists;  ///< The lists, sorted by object name. Only
+                                  ///< the first listsCount ones are used.
+  std::size_t listsCount;
+  mutable std::vector<std::vector<bool> >
+      pickedFlags;  ///< Scratch flags for each object of each list.
+};
+
+#endif  // RUNTIMEOBJECTSLISTS_H
@@ -10,13 +10,14 @@
 #include "RuntimeObject.h"
 #include "RuntimeScene.h"
 
-void GD_API PickOnly(RuntimeObjectsLists& pickedObjectsLists,
+void GD_API PickOnly(const RuntimeObjectsLists& pickedObjectsLists,
                      RuntimeObject* thisOne) {
   for (auto it = pickedObjectsLists.begin(); it != pickedObjectsLists.end();
        ++it) {
     if (it->second != NULL) it->second->clear();
   }
 
-  if (pickedObjectsLists[thisOne->GetName()] != NULL)
-    pickedObjectsLists[thisOne->GetName()]->push_back(thisOne);
+  auto it = pickedObjectsLists.find(thisOne->GetName());
+  if (it != pickedObjectsLists.end() && it->second != NULL)
+    it->second->push_back(thisOne);
 }
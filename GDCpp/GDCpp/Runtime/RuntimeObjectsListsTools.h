@@ -10,18 +10,17 @@
 #include <string>
 #include <vector>
 #include "RuntimeObject.h"
+#include "RuntimeObjectsLists.h"
+#include "RuntimeObjectsSpatialHash.h"
 #include "RuntimeScene.h"
 
-typedef std::map<gd::String, std::vector<RuntimeObject *> *>
-    RuntimeObjectsLists;
-
 /**
  * \brief Keep only the specified object in the lists of picked objects.
  * \param objectsLists The lists of objects to trim
  * \param thisOne The object to keep in the lists
  * \ingroup GameEngine
  */
-void GD_API PickOnly(RuntimeObjectsLists &pickedObjectsLists,
+void GD_API PickOnly(const RuntimeObjectsLists &pickedObjectsLists,
                      RuntimeObject *thisOne);
 
 /**
@@ -43,46 +42,21 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
                    Pred predicate) {
   bool isTrue = false;
 
-  // Create a boolean for each object
-  std::vector<std::vector<bool> > pickedList;
+  // Pick objects which are fulfilling the predicate, trimming the lists in
+  // place.
   for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
        it != pickedObjectsLists.end();
        ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList.push_back(arr);
-  }
-
-  // Pick objects which are fulfulling the predicate.
-  std::size_t i = 0;
-  for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
-       it != pickedObjectsLists.end();
-       ++it, ++i) {
-    if (!it->second) continue;
-    const std::vector<RuntimeObject *> &arr1 = *it->second;
-
-    for (std::size_t k = 0; k < arr1.size(); ++k) {
-      if (negatePredicate ^ predicate(arr1[k])) {
-        pickedList[i][k] = true;
-        isTrue = true;
-      }
-    }
-  }
-
-  // Trim not picked objects from lists.
-  i = 0;
-  for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
-       it != pickedObjectsLists.end();
-       ++it, ++i) {
-    size_t finalSize = 0;
     if (!it->second) continue;
     std::vector<RuntimeObject *> &arr = *it->second;
 
+    size_t finalSize = 0;
     for (std::size_t k = 0; k < arr.size(); ++k) {
       RuntimeObject *obj = arr[k];
-      if (pickedList[i][k]) {
+      if (negatePredicate ^ predicate(obj)) {
         arr[finalSize] = obj;
         finalSize++;
+        isTrue = true;
       }
     }
     arr.resize(finalSize);
@@ -106,44 +80,40 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
  * to some lists (See *This is important* comment at the end of the algorithm,
  * when trimming the list).
  *
+ * The booleans marking the picked objects are the scratch flags of the lists
+ * (see RuntimeObjectsLists::GetPickedFlags), so that no memory is allocated
+ * when the lists are reused.
+ *
  * Cost (Worst case, predicate being always false):
- *    Cost(Creating tables with a total of NbObjList1+NbObjList2 booleans)
+ *    Cost(Resetting NbObjList1+NbObjList2 booleans)
  *  + Cost(predicate)*NbObjList1*NbObjList2
  *  + Cost(Testing NbObjList1+NbObjList2 booleans)
  *  + Cost(Removing NbObjList1+NbObjList2 objects from all the lists)
  *
  * Cost (Best case, predicate being always true):
- *    Cost(Creating tables with a total of NbObjList1+NbObjList2 booleans)
+ *    Cost(Resetting NbObjList1+NbObjList2 booleans)
  *  + Cost(predicate)*(NbObjList1+NbObjList2)
  *  + Cost(Testing NbObjList1+NbObjList2 booleans)
  *
  * \ingroup GameEngine
  */
 template <typename Pred>
-bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
-                        RuntimeObjectsLists objectsLists2,
+bool TwoObjectListsTest(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
                         bool negatePredicate,
                         Pred predicate) {
-  bool isTrue = false;
+  if (&objectsLists1 == &objectsLists2) {
+    // The flags of the lists can't be used twice.
+    RuntimeObjectsLists objectsLists2Copy(objectsLists2);
+    return TwoObjectListsTest(
+        objectsLists1, objectsLists2Copy, negatePredicate, predicate);
+  }
 
-  // Create a boolean for each object
-  std::vector<std::vector<bool> > pickedList1;
-  std::vector<std::vector<bool> > pickedList2;
+  bool isTrue = false;
 
-  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
-       it != objectsLists1.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList1.push_back(arr);
-  }
-  for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
-       it != objectsLists2.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList2.push_back(arr);
-  }
+  // Reset the boolean of each object
+  objectsLists1.ResetPickedFlags();
+  objectsLists2.ResetPickedFlags();
 
   // Launch the function each object of the first list with each object
   // of the second list.
@@ -153,6 +123,7 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
        ++it, ++i) {
     if (!it->second) continue;
     const std::vector<RuntimeObject *> &arr1 = *it->second;
+    std::vector<bool> &picked1 = objectsLists1.GetPickedFlags(i);
 
     for (std::size_t k = 0; k < arr1.size(); ++k) {
       bool atLeastOneObject = false;
@@ -163,9 +134,10 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
            ++it2, ++j) {
         if (!it2->second) continue;
         const std::vector<RuntimeObject *> &arr2 = *it2->second;
+        std::vector<bool> &picked2 = objectsLists2.GetPickedFlags(j);
 
         for (std::size_t l = 0; l < arr2.size(); ++l) {
-          if (pickedList1[i][k] && pickedList2[j][l])
+          if (picked1[k] && picked2[l])
             continue;  // Avoid unnecessary costly call to functor.
 
           if (std::addressof(arr1[k]) != std::addressof(arr2[l]) &&
@@ -174,8 +146,8 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
               isTrue = true;
 
               // Pick the objects
-              pickedList1[i][k] = true;
-              pickedList2[j][l] = true;
+              picked1[k] = true;
+              picked2[l] = true;
             }
 
             atLeastOneObject = true;
@@ -186,7 +158,7 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
       if (!atLeastOneObject &&
           negatePredicate) {  // The object is not overlapping any other object.
         isTrue = true;
-        pickedList1[i][k] = true;
+        picked1[k] = true;
       }
     }
   }
@@ -199,10 +171,11 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
     size_t finalSize = 0;
     if (!it->second) continue;
     std::vector<RuntimeObject *> &arr = *it->second;
+    const std::vector<bool> &picked1 = objectsLists1.GetPickedFlags(i);
 
     for (std::size_t k = 0; k < arr.size(); ++k) {
       RuntimeObject *obj = arr[k];
-      if (pickedList1[i][k]) {
+      if (picked1[k]) {
         arr[finalSize] = obj;
         finalSize++;
       }
@@ -221,14 +194,183 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
 
       //*This is important*! We can have a list that has already been trimmed
       // just before
+      const std::vector<bool> &picked2 = objectsLists2.GetPickedFlags(i);
       if (arr.size() !=
-          pickedList2[i].size())  // If the size of the objects list != size of
-                                  // the boolean "picked" list...
+          picked2.size())  // If the size of the objects list != size of
+                           // the boolean "picked" list...
         continue;  //... then the object list was already trimmed, skip it.
 
       for (std::size_t k = 0; k < arr.size(); ++k) {
         RuntimeObject *obj = arr[k];
-        if (pickedList2[i][k]) {
+        if (picked2[k]) {
+          arr[finalSize] = obj;
+          finalSize++;
+        }
+      }
+      arr.resize(finalSize);
+    }
+  }
+
+  return isTrue;
+}
+
+/**
+ * \brief Picks objects that fullfil the predicate with at least another object,
+ * using a spatial index to only test pairs of objects that are near each
+ * other.
+ *
+ * The picking is exactly the same as TwoObjectListsTest without the spatial
+ * index, provided that the predicate is always false for objects whose
+ * bounding boxes (see RuntimeObjectsSpatialHash::GetBoundingBox) are not
+ * overlapping. This is the case for collision tests.
+ *
+ * Objects of objectsLists2 are updated in the index if they were moved since
+ * it was built.
+ *
+ * Cost (Worst case, predicate being always false):
+ *    Cost(Updating NbObjList2 objects in the index)
+ *  + Cost(Querying the index NbObjList1 times)
+ *  + Cost(predicate)*NbOfPairsOfNearObjects
+ *  + Cost(Testing and removing NbObjList1+NbObjList2 objects from all the lists)
+ *
+ * \see TwoObjectListsTest
+ * \ingroup GameEngine
+ */
+template <typename Pred>
+bool TwoObjectListsTest(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
+                        bool negatePredicate,
+                        RuntimeObjectsSpatialHash &spatialHash,
+                        Pred predicate) {
+  if (&objectsLists1 == &objectsLists2) {
+    // The flags of the lists can't be used twice.
+    RuntimeObjectsLists objectsLists2Copy(objectsLists2);
+    return TwoObjectListsTest(objectsLists1,
+                              objectsLists2Copy,
+                              negatePredicate,
+                              spatialHash,
+                              predicate);
+  }
+
+  // Tag the objects of the second lists in the index, so that the candidates
+  // returned by the index can be mapped back to their position in the lists.
+  std::size_t listsStamp = spatialHash.NewStamp();
+  std::size_t j = 0;
+  for (RuntimeObjectsLists::const_iterator it2 = objectsLists2.begin();
+       it2 != objectsLists2.end();
+       ++it2, ++j) {
+    if (!it2->second) continue;
+    std::vector<RuntimeObject *> &arr2 = *it2->second;
+
+    for (std::size_t l = 0; l < arr2.size(); ++l) {
+      RuntimeObjectsSpatialHash::Entry &entry =
+          spatialHash.GetUpToDateEntry(arr2[l]);
+      if (entry.listStamp == listsStamp) {
+        // The same object is in the lists more than once: a single tag
+        // can't be used, fallback to testing all the pairs.
+        return TwoObjectListsTest(
+            objectsLists1, objectsLists2, negatePredicate, predicate);
+      }
+
+      entry.listStamp = listsStamp;
+      entry.listIndex = j;
+      entry.list = &arr2;
+      entry.positionInList = l;
+    }
+  }
+
+  bool isTrue = false;
+
+  // Reset the boolean of each object
+  objectsLists1.ResetPickedFlags();
+  objectsLists2.ResetPickedFlags();
+
+  // Launch the function for each object of the first list with each object
+  // of the second list that is near it.
+  std::size_t i = 0;
+  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
+       it != objectsLists1.end();
+       ++it, ++i) {
+    if (!it->second) continue;
+    const std::vector<RuntimeObject *> &arr1 = *it->second;
+    std::vector<bool> &picked1 = objectsLists1.GetPickedFlags(i);
+
+    for (std::size_t k = 0; k < arr1.size(); ++k) {
+      bool atLeastOneObject = false;
+
+      spatialHash.ForEachCandidate(
+          RuntimeObjectsSpatialHash::GetBoundingBox(*arr1[k]),
+          [&](const RuntimeObjectsSpatialHash::Entry &candidate) {
+            if (candidate.listStamp != listsStamp)
+              return;  // Not an object of the second lists.
+
+            std::vector<bool>::reference picked2 =
+                objectsLists2.GetPickedFlags(
+                    candidate.listIndex)[candidate.positionInList];
+            if (picked1[k] && picked2)
+              return;  // Avoid unnecessary costly call to functor.
+
+            if (std::addressof(arr1[k]) !=
+                    std::addressof(
+                        (*candidate.list)[candidate.positionInList]) &&
+                predicate(arr1[k], candidate.object)) {
+              if (!negatePredicate) {
+                isTrue = true;
+
+                // Pick the objects
+                picked1[k] = true;
+                picked2 = true;
+              }
+
+              atLeastOneObject = true;
+            }
+          });
+
+      if (!atLeastOneObject &&
+          negatePredicate) {  // The object is not overlapping any other object.
+        isTrue = true;
+        picked1[k] = true;
+      }
+    }
+  }
+
+  // Trim not picked objects from lists.
+  i = 0;
+  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
+       it != objectsLists1.end();
+       ++it, ++i) {
+    size_t finalSize = 0;
+    if (!it->second) continue;
+    std::vector<RuntimeObject *> &arr = *it->second;
+    const std::vector<bool> &picked1 = objectsLists1.GetPickedFlags(i);
+
+    for (std::size_t k = 0; k < arr.size(); ++k) {
+      RuntimeObject *obj = arr[k];
+      if (picked1[k]) {
+        arr[finalSize] = obj;
+        finalSize++;
+      }
+    }
+    arr.resize(finalSize);
+  }
+
+  if (!negatePredicate) {
+    std::size_t i = 0;
+    for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
+         it != objectsLists2.end();
+         ++it, ++i) {
+      size_t finalSize = 0;
+      if (!it->second) continue;
+      std::vector<RuntimeObject *> &arr = *it->second;
+
+      // A list can have already been trimmed just before (see
+      // TwoObjectListsTest).
+      const std::vector<bool> &picked2 = objectsLists2.GetPickedFlags(i);
+      if (arr.size() != picked2.size()) continue;
+
+      for (std::size_t k = 0; k < arr.size(); ++k) {
+        RuntimeObject *obj = arr[k];
+        if (picked2[k]) {
           arr[finalSize] = obj;
           finalSize++;
         }
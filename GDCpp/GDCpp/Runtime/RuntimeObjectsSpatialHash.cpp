@@ -0,0 +1,174 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/RuntimeObjectsSpatialHash.h"
+#include <algorithm>
+#include <cmath>
+#include "GDCpp/Runtime/RuntimeObject.h"
+
+const int RuntimeObjectsSpatialHash::maxCellsPerEntry = 64;
+
+RuntimeObjectsSpatialHash::RuntimeObjectsSpatialHash()
+    : cellSize(128), lastStamp(0) {}
+
+sf::FloatRect RuntimeObjectsSpatialHash::GetBoundingBox(
+    const RuntimeObject& object) {
+  float width = object.GetWidth();
+  float height = object.GetHeight();
+
+  // Same bounding circle as in RuntimeObject::IsCollidingWith, with a small
+  // margin to be sure that rounding errors can't make a pair be missed.
+  float radius = sqrt(width * width + height * height) / 2.0 + 1.0;
+  float centerX = object.GetDrawableX() + object.GetCenterX();
+  float centerY = object.GetDrawableY() + object.GetCenterY();
+
+  return sf::FloatRect(
+      centerX - radius, centerY - radius, radius * 2, radius * 2);
+}
+
+bool RuntimeObjectsSpatialHash::GetCellsRange(const sf::FloatRect& box,
+                                              int& minCellX,
+                                              int& minCellY,
+                                              int& maxCellX,
+                                              int& maxCellY) const {
+  float minX = std::floor(box.left / cellSize);
+  float minY = std::floor(box.top / cellSize);
+  float maxX = std::floor((box.left + box.width) / cellSize);
+  float maxY = std::floor((box.top + box.height) / cellSize);
+
+  // Also reject NaN and infinite coordinates.
+  if (!((maxX - minX + 1) * (maxY - minY + 1) <= maxCellsPerEntry))
+    return false;
+
+  minCellX = static_cast<int>(minX);
+  minCellY = static_cast<int>(minY);
+  maxCellX = static_cast<int>(maxX);
+  maxCellY = static_cast<int>(maxY);
+  return true;
+}
+
+void RuntimeObjectsSpatialHash::InsertInCells(std::size_t index) {
+  Entry& entry = entries[index];
+  entry.large = !GetCellsRange(entry.box,
+                               entry.minCellX,
+                               entry.minCellY,
+                               entry.maxCellX,
+                               entry.maxCellY);
+  if (entry.large) {
+    largeEntries.push_back(index);
+    return;
+  }
+
+  for (int x = entry.minCellX; x <= entry.maxCellX; ++x) {
+    for (int y = entry.minCellY; y <= entry.maxCellY; ++y)
+      cells[GetCellKey(x, y)].push_back(index);
+  }
+}
+
+void RuntimeObjectsSpatialHash::RemoveFromCells(std::size_t index) {
+  const Entry& entry = entries[index];
+  if (entry.large) {
+    largeEntries.erase(
+        std::remove(largeEntries.begin(), largeEntries.end(), index),
+        largeEntries.end());
+    return;
+  }
+
+  for (int x = entry.minCellX; x <= entry.maxCellX; ++x) {
+    for (int y = entry.minCellY; y <= entry.maxCellY; ++y) {
+      std::vector<std::size_t>& cell = cells[GetCellKey(x, y)];
+      auto it = std::find(cell.begin(), cell.end(), index);
+      if (it != cell.end()) {
+        *it = cell.back();
+        cell.pop_back();
+      }
+    }
+  }
+}
+
+void RuntimeObjectsSpatialHash::Clear() {
+  entries.clear();
+  entriesIndices.clear();
+  largeEntries.clear();
+
+  // Keep the cells (and their allocated memory) to be reused, unless too many
+  // of them are unused.
+  if (cells.size() > entries.capacity() * 4 + 64)
+    cells.clear();
+  else {
+    for (auto& cell : cells) cell.second.clear();
+  }
+}
+
+void RuntimeObjectsSpatialHash::Rebuild(
+    const std::vector<RuntimeObject*>& objects) {
+  Clear();
+  entries.reserve(objects.size());
+
+  // Compute all the bounding boxes first to choose the cells size.
+  float totalSize = 0;
+  std::size_t sizedObjectsCount = 0;
+  for (RuntimeObject* object : objects) {
+    Entry entry;
+    entry.object = object;
+    entry.box = GetBoundingBox(*object);
+    entry.large = false;
+    entry.queryStamp = 0;
+    entry.listStamp = 0;
+    entry.listIndex = 0;
+    entry.list = nullptr;
+    entry.positionInList = 0;
+    entries.push_back(entry);
+
+    if (std::isfinite(entry.box.width)) {
+      totalSize += entry.box.width;
+      sizedObjectsCount++;
+    }
+  }
+  if (sizedObjectsCount != 0)
+    cellSize = std::max(16.0f, totalSize / sizedObjectsCount);
+
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    entriesIndices[entries[i].object] = i;
+    InsertInCells(i);
+  }
+}
+
+RuntimeObjectsSpatialHash::Entry& RuntimeObjectsSpatialHash::GetUpToDateEntry(
+    RuntimeObject* object) {
+  sf::FloatRect box = GetBoundingBox(*object);
+
+  auto it = entriesIndices.find(object);
+  if (it == entriesIndices.end()) {
+    // The object was created since the last rebuild.
+    Entry entry;
+    entry.object = object;
+    entry.box = box;
+    entry.large = false;
+    entry.queryStamp = 0;
+    entry.listStamp = 0;
+    entry.listIndex = 0;
+    entry.list = nullptr;
+    entry.positionInList = 0;
+    entries.push_back(entry);
+
+    std::size_t index = entries.size() - 1;
+    entriesIndices[object] = index;
+    InsertInCells(index);
+    return entries[index];
+  }
+
+  std::size_t index = it->second;
+  Entry& entry = entries[index];
+  if (entry.box.left != box.left || entry.box.top != box.top ||
+      entry.box.width != box.width || entry.box.height != box.height) {
+    // The object was moved or resized since the last rebuild.
+    RemoveFromCells(index);
+    entry.box = box;
+    InsertInCells(index);
+  }
+
+  return entry;
+}
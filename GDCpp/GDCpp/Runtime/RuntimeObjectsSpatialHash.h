@@ -0,0 +1,178 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef RUNTIMEOBJECTSSPATIALHASH_H
+#define RUNTIMEOBJECTSSPATIALHASH_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+
+class RuntimeObject;
+
+/**
+ * \brief Uniform grid indexing the objects of a scene by their bounding box,
+ * used as a broad-phase by the functions testing pairs of objects.
+ *
+ * The bounding box of an object is the square containing the bounding circle
+ * used by RuntimeObject::IsCollidingWith: two objects can only collide if
+ * their bounding boxes overlap.
+ *
+ * The index is rebuilt once per frame by the scene. Objects moved, resized
+ * or created since then are updated lazily when they are looked up with
+ * GetUpToDateEntry, so that queries never miss a pair.
+ *
+ * \see TwoObjectListsTest
+ * \ingroup GameEngine
+ */
+class GD_API RuntimeObjectsSpatialHash {
+ public:
+  /**
+   * \brief An object stored in the index.
+   *
+   * listStamp, listIndex, list and positionInList are scratch fields
+   * that can be used by algorithms to tag the objects they are working on
+   * (see TwoObjectListsTest).
+   */
+  struct Entry {
+    RuntimeObject* object;
+    sf::FloatRect box;
+    bool large;  ///< true if the entry is not stored in the cells.
+    int minCellX, minCellY, maxCellX, maxCellY;
+    std::size_t queryStamp;
+    std::size_t listStamp;
+    std::size_t listIndex;
+    std::vector<RuntimeObject*>* list;
+    std::size_t positionInList;
+  };
+
+  RuntimeObjectsSpatialHash();
+  virtual ~RuntimeObjectsSpatialHash(){};
+
+  /**
+   * \brief Clear the index and insert all the specified objects.
+   *
+   * The cell size is adapted to the average size of the objects.
+   */
+  void Rebuild(const std::vector<RuntimeObject*>& objects);
+
+  /**
+   * \brief Remove all objects from the index.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the entry of the object, after inserting it or updating it
+   * if its bounding box has changed since it was indexed.
+   *
+   * \warning The reference is invalidated by the next call to
+   * GetUpToDateEntry, Rebuild or Clear.
+   */
+  Entry& GetUpToDateEntry(RuntimeObject* object);
+
+  /**
+   * \brief Call \a callback for each entry whose bounding box, as it was
+   * when the entry was last updated, may overlap \a area.
+   *
+   * Each entry is passed at most once. Entries can refer to objects that were
+   * deleted since the last rebuild: only dereference the objects of entries
+   * that were returned by GetUpToDateEntry beforehand.
+   */
+  template <typename Callback>
+  void ForEachCandidate(const sf::FloatRect& area, Callback callback) {
+    std::size_t stamp = NewStamp();
+
+    for (std::size_t index : largeEntries) {
+      Entry& entry = entries[index];
+      if (entry.queryStamp == stamp) continue;
+      entry.queryStamp = stamp;
+
+      callback(entry);
+    }
+
+    int minCellX, minCellY, maxCellX, maxCellY;
+    if (!GetCellsRange(area, minCellX, minCellY, maxCellX, maxCellY)) {
+      // The area is too large: every entry is a candidate.
+      for (Entry& entry : entries) {
+        if (entry.queryStamp == stamp) continue;
+        entry.queryStamp = stamp;
+
+        callback(entry);
+      }
+      return;
+    }
+
+    for (int x = minCellX; x <= maxCellX; ++x) {
+      for (int y = minCellY; y <= maxCellY; ++y) {
+        auto cell = cells.find(GetCellKey(x, y));
+        if (cell == cells.end()) continue;
+
+        for (std::size_t index : cell->second) {
+          Entry& entry = entries[index];
+          if (entry.queryStamp == stamp) continue;
+          entry.queryStamp = stamp;
+
+          if (Overlaps(entry.box, area)) callback(entry);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Return a new stamp, different from all the previous ones. Used to
+   * tag entries without having to reset them.
+   */
+  std::size_t NewStamp() { return ++lastStamp; }
+
+  /**
+   * \brief Return the bounding box used to index an object.
+   */
+  static sf::FloatRect GetBoundingBox(const RuntimeObject& object);
+
+  /**
+   * \brief Return true if the two rectangles overlap, including if their edges
+   * are only touching.
+   */
+  static bool Overlaps(const sf::FloatRect& a, const sf::FloatRect& b) {
+    return a.left <= b.left + b.width && b.left <= a.left + a.width &&
+           a.top <= b.top + b.height && b.top <= a.top + a.height;
+  }
+
+ private:
+  static std::int64_t GetCellKey(int x, int y) {
+    return (static_cast<std::int64_t>(x) << 32) ^
+           static_cast<std::int64_t>(static_cast<std::uint32_t>(y));
+  }
+
+  /**
+   * \brief Compute the range of cells covered by a box.
+   * \return false if the box covers too many cells (or is invalid) to be
+   * stored in the cells.
+   */
+  bool GetCellsRange(const sf::FloatRect& box,
+                     int& minCellX,
+                     int& minCellY,
+                     int& maxCellX,
+                     int& maxCellY) const;
+
+  void InsertInCells(std::size_t index);
+  void RemoveFromCells(std::size_t index);
+
+  std::vector<Entry> entries;
+  std::unordered_map<const RuntimeObject*, std::size_t>
+      entriesIndices;  ///< Index of the entry of each object in entries.
+  std::unordered_map<std::int64_t, std::vector<std::size_t>>
+      cells;  ///< Indices of the entries overlapping each cell.
+  std::vector<std::size_t> largeEntries;  ///< Indices of the entries covering
+                                          ///< too many cells.
+  float cellSize;
+  std::size_t lastStamp;
+
+  static const int maxCellsPerEntry;
+};
+
+#endif  // RUNTIMEOBJECTSSPATIALHASH_H
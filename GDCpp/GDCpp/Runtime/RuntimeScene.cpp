@@ -8,6 +8,7 @@
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCpp/Extensions/CppPlatform.h"
@@ -201,7 +202,7 @@ void RuntimeScene::Render() {
                                 GetBackgroundColorGreen(),
                                 GetBackgroundColorBlue()));
 
-  // Sort object by order to render them
+  // Sort object by order to render them (on a copy of the list of objects)
   RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
   OrderObjectsByZOrder(allObjects);
 
@@ -300,24 +301,27 @@ const RuntimeLayer& RuntimeScene::GetRuntimeLayer(
 }
 
 void RuntimeScene::ManageObjectsAfterEvents() {
-  // Delete objects that were removed.
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id) {
-    if (allObjects[id]->GetName().empty()) {
-      for (std::size_t i = 0; i < extensionsToBeNotifiedOnObjectDeletion.size();
-           ++i)
-        extensionsToBeNotifiedOnObjectDeletion[i]->ObjectDeletedFromScene(
-            *this, allObjects[id]);
-
-      objectsInstances.RemoveObject(
-          allObjects[id]);  // Remove from objects instances, not from the
-                            // temporary list!
-    }
+  // Delete objects that were removed, all at once. Extensions being notified
+  // can remove other objects: these are deleted in the next iteration.
+  while (!objectsInstances.GetObjectsToBeDeleted().empty()) {
+    objectsBeingDeleted = objectsInstances.GetObjectsToBeDeleted();
+    for (std::size_t i = 0; i < extensionsToBeNotifiedOnObjectDeletion.size();
+         ++i)
+      extensionsToBeNotifiedOnObjectDeletion[i]->ObjectsDeletedFromScene(
+          *this, objectsBeingDeleted);
+
+    for (RuntimeObject* object : objectsBeingDeleted)
+      objectsInstances.RemoveObject(object);
   }
-
-  // Update objects positions, forces and behaviors
-  allObjects = objectsInstances.GetAllObjects();
-  for (RuntimeObject* object : allObjects) {
+  objectsBeingDeleted.clear();
+
+  // Update objects positions, forces and behaviors (objects created meanwhile
+  // are added at the end of the list and are not updated).
+  const RuntimeObjNonOwningPtrList& allObjects =
+      objectsInstances.GetAllObjects();
+  std::size_t objectsCount = allObjects.size();
+  for (std::size_t id = 0; id < objectsCount; ++id) {
+    RuntimeObject* object = allObjects[id];
     double elapsedTimeInSeconds =
         static_cast<double>(object->GetElapsedTime(*this)) / 1000000.0;
     object->SetX(object->GetX() +
@@ -328,44 +332,51 @@ void RuntimeScene::ManageObjectsAfterEvents() {
     object->UpdateForce(elapsedTimeInSeconds);
     object->DoBehaviorsPostEvents(*this);
   }
+
+  // Index the objects at their new positions for the next frame.
+  objectsSpatialHash.Rebuild(allObjects);
 }
 
 void RuntimeScene::ManageObjectsBeforeEvents() {
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id)
+  behaviorsSharedDatas.DoStepPreEvents(*this);
+
+  const RuntimeObjNonOwningPtrList& allObjects =
+      objectsInstances.GetAllObjects();
+  std::size_t objectsCount = allObjects.size();
+  for (std::size_t id = 0; id < objectsCount; ++id)
     allObjects[id]->DoBehaviorsPreEvents(*this);
 }
 
 /**
  * \brief Internal Tool class used by RuntimeScene::CreateObjectsFrom
+ *
+ * A runtime object is created once for each object name (the "prototype"), and
+ * instances are then created by cloning it, which avoids searching the object
+ * and converting it (behaviors, variables, resources...) for each instance.
  */
 class ObjectsFromInitialInstanceCreator : public gd::InitialInstanceFunctor {
  public:
   ObjectsFromInitialInstanceCreator(gd::Project& game_,
                                     RuntimeScene& scene_,
                                     float xOffset_,
-                                    float yOffset_)
-      : game(game_), scene(scene_), xOffset(xOffset_), yOffset(yOffset_){};
+                                    float yOffset_,
+                                    std::size_t instancesCount)
+      : game(game_), scene(scene_), xOffset(xOffset_), yOffset(yOffset_) {
+    createdObjects.reserve(instancesCount);
+  };
   virtual ~ObjectsFromInitialInstanceCreator(){};
 
-  virtual void operator()(gd::InitialInstance& instance) {
-    std::vector<ObjSPtr>::const_iterator sceneObject =
-        std::find_if(scene.GetObjects().begin(),
-                     scene.GetObjects().end(),
-                     std::bind2nd(ObjectHasName(), instance.GetObjectName()));
-    std::vector<ObjSPtr>::const_iterator globalObject =
-        std::find_if(game.GetObjects().begin(),
-                     game.GetObjects().end(),
-                     std::bind2nd(ObjectHasName(), instance.GetObjectName()));
+  /**
+   * \brief Add the objects created so far to the scene.
+   */
+  void AddCreatedObjectsToScene() {
+    scene.objectsInstances.AddObjects(std::move(createdObjects));
+  }
 
+  virtual void operator()(gd::InitialInstance& instance) {
+    const RuntimeObject* prototype = GetPrototype(instance.GetObjectName());
     RuntimeObjSPtr newObject;
-
-    if (sceneObject !=
-        scene.GetObjects().end())  // We check first scene's objects' list.
-      newObject = CppPlatform::Get().CreateRuntimeObject(scene, **sceneObject);
-    else if (globalObject !=
-             scene.game->GetObjects().end())  // Then the global object list
-      newObject = CppPlatform::Get().CreateRuntimeObject(scene, **globalObject);
+    if (prototype) newObject = prototype->Clone();
 
     if (newObject != std::unique_ptr<RuntimeObject>()) {
       newObject->SetX(instance.GetX() + xOffset);
@@ -383,26 +394,53 @@ class ObjectsFromInitialInstanceCreator : public gd::InitialInstanceFunctor {
       // Substitute initial variables specific to that object instance.
       newObject->GetVariables().Merge(instance.GetVariables());
 
-      scene.objectsInstances.AddObject(std::move(newObject));
+      createdObjects.push_back(std::move(newObject));
     } else
       std::cout << "Could not find and put object " << instance.GetObjectName()
                 << std::endl;
   }
 
  private:
+  /**
+   * \brief Return the object to be cloned to create the instances of the
+   * object called \a objectName, creating it the first time.
+   * \return nullptr if the object does not exist.
+   */
+  const RuntimeObject* GetPrototype(const gd::String& objectName) {
+    auto it = prototypes.find(objectName);
+    if (it != prototypes.end()) return it->second.get();
+
+    RuntimeObjSPtr& prototype = prototypes[objectName];
+
+    // We check first scene's objects' list, then the global object list.
+    if (scene.HasObjectNamed(objectName))
+      prototype = CppPlatform::Get().CreateRuntimeObject(
+          scene, scene.GetObject(objectName));
+    else if (game.HasObjectNamed(objectName))
+      prototype = CppPlatform::Get().CreateRuntimeObject(
+          scene, game.GetObject(objectName));
+
+    return prototype.get();
+  }
+
   gd::Project& game;
   RuntimeScene& scene;
   float xOffset;
   float yOffset;
+  std::vector<RuntimeObjSPtr> createdObjects;
+  std::unordered_map<gd::String, RuntimeObjSPtr>
+      prototypes;  ///< The object cloned for each name (nullptr if unknown).
 };
 
 void RuntimeScene::CreateObjectsFrom(
     const gd::InitialInstancesContainer& container,
     float xOffset,
     float yOffset) {
-  ObjectsFromInitialInstanceCreator func(*game, *this, xOffset, yOffset);
+  ObjectsFromInitialInstanceCreator func(
+      *game, *this, xOffset, yOffset, container.GetInstancesCount());
   const_cast<gd::InitialInstancesContainer&>(container).IterateOverInstances(
       func);
+  func.AddCreatedObjectsToScene();
 }
 
 bool RuntimeScene::LoadFromScene(const gd::Layout& scene) {
@@ -424,6 +462,7 @@ bool RuntimeScene::LoadFromSceneAndCustomInstances(
 
   // Clear RuntimeScene datas
   objectsInstances.Clear();
+  objectsSpatialHash.Clear();
   timeManager.Reset();
 
   std::cout << ".";
@@ -16,6 +16,7 @@
 #include "GDCpp/Runtime/ObjInstancesHolder.h"
 #include "GDCpp/Runtime/Project/Layout.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
+#include "GDCpp/Runtime/RuntimeObjectsSpatialHash.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
 #include "GDCpp/Runtime/TimeManager.h"
 namespace sf {
@@ -102,6 +103,16 @@ class GD_API RuntimeScene : public Scene {
    */
   TimeManager& GetTimeManager() { return timeManager; }
 
+  /**
+   * \brief Get the spatial index of the objects, used as a broad-phase by
+   * collision tests.
+   * \note The index is rebuilt at the end of each frame, and objects moved
+   * during the frame are updated when they are looked up.
+   */
+  RuntimeObjectsSpatialHash& GetObjectsSpatialHash() {
+    return objectsSpatialHash;
+  }
+
   /**
    * Get the layer with specified name.
    */
@@ -254,6 +265,8 @@ class GD_API RuntimeScene : public Scene {
                       ///< not
   InputManager inputManager;
   TimeManager timeManager;
+  RuntimeObjectsSpatialHash
+      objectsSpatialHash;  ///< Broad-phase index of the objects.
   RuntimeVariablesContainer variables;  ///< List of the scene variables
   std::vector<ExtensionBase*>
       extensionsToBeNotifiedOnObjectDeletion;  ///< List, built during
@@ -261,6 +274,9 @@ class GD_API RuntimeScene : public Scene {
                                                ///< list of extensions which
                                                ///< must be notified when an
                                                ///< object is deleted.
+  RuntimeObjNonOwningPtrList
+      objectsBeingDeleted;  ///< The objects deleted at the end of the frame,
+                            ///< kept as a member to reuse its memory.
   BehaviorsRuntimeSharedDataHolder
       behaviorsSharedDatas;  ///< Contains all behaviors shared datas.
   std::vector<RuntimeLayer>
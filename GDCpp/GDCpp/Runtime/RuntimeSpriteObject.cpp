@@ -44,6 +44,7 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
       animationSpeedScale(1.f),
       ptrToCurrentSprite(NULL),
       needUpdateCurrentSprite(true),
+      transformedHitBoxesUpToDate(false),
       opacity(255),
       blendMode(0),
       isFlippedX(false),
@@ -367,29 +368,64 @@ const gd::Sprite& RuntimeSpriteObject::GetCurrentSprite() const {
 }
 
 std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const {
+  return GetTransformedHitBoxes(sf::FloatRect()).GetPolygons();
+}
+
+const TransformedHitBoxes& RuntimeSpriteObject::GetTransformedHitBoxes(
+    sf::FloatRect) const {
+  std::vector<Polygon2d>& polygons = transformedHitBoxes.GetPolygons();
   if (currentAnimation >= animations.size()) {
-    std::vector<Polygon2d> hitboxes;  // Invalid animation, bail out.
-    return hitboxes;
+    polygons.clear();  // Invalid animation, bail out.
+    transformedHitBoxes.Update();
+    transformedHitBoxesUpToDate = false;
+    return transformedHitBoxes;
+  }
+
+  const gd::Sprite& sprite = GetCurrentSprite();
+  HitBoxesState state;
+  state.sprite = &sprite;
+  state.x = X;
+  state.y = Y;
+  state.angle = currentAngle;
+  state.scaleX = scaleX;
+  state.scaleY = scaleY;
+  state.flippedX = isFlippedX;
+  state.flippedY = isFlippedY;
+  if (transformedHitBoxesUpToDate && state == transformedHitBoxesState)
+    return transformedHitBoxes;
+
+  // Copy the mask in the existing polygons to reuse their memory.
+  const sf::FloatRect localBounds = sprite.GetSFMLSprite().getLocalBounds();
+  if (sprite.IsCollisionMaskAutomatic()) {
+    polygons.resize(1);
+    std::vector<sf::Vector2f>& vertices = polygons[0].vertices;
+    vertices.resize(4);
+    vertices[0] = sf::Vector2f(0, 0);
+    vertices[1] = sf::Vector2f(localBounds.width, 0);
+    vertices[2] = sf::Vector2f(localBounds.width, localBounds.height);
+    vertices[3] = sf::Vector2f(0, localBounds.height);
+  } else {
+    const std::vector<Polygon2d>& mask = sprite.GetCustomCollisionMask();
+    polygons.resize(mask.size());
+    for (std::size_t i = 0; i < mask.size(); ++i)
+      polygons[i].vertices.assign(mask[i].vertices.begin(),
+                                  mask[i].vertices.end());
   }
-  const sf::Sprite& currentSFMLSprite = GetCurrentSFMLSprite();
 
-  std::vector<Polygon2d> polygons = GetCurrentSprite().GetCollisionMask();
+  const sf::Transform& transform = sprite.GetSFMLSprite().getTransform();
   for (std::size_t i = 0; i < polygons.size(); ++i) {
     for (std::size_t j = 0; j < polygons[i].vertices.size(); ++j) {
-      sf::Vector2f newVertice = currentSFMLSprite.getTransform().transformPoint(
-          !isFlippedX
-              ? polygons[i].vertices[j].x
-              : GetCurrentSprite().GetSFMLSprite().getLocalBounds().width -
-                    polygons[i].vertices[j].x,
-          !isFlippedY
-              ? polygons[i].vertices[j].y
-              : GetCurrentSprite().GetSFMLSprite().getLocalBounds().height -
-                    polygons[i].vertices[j].y);
-      polygons[i].vertices[j] = newVertice;
+      sf::Vector2f& vertex = polygons[i].vertices[j];
+      vertex = transform.transformPoint(
+          !isFlippedX ? vertex.x : localBounds.width - vertex.x,
+          !isFlippedY ? vertex.y : localBounds.height - vertex.y);
     }
   }
 
-  return polygons;
+  transformedHitBoxes.Update();
+  transformedHitBoxesState = state;
+  transformedHitBoxesUpToDate = true;
+  return transformedHitBoxes;
 }
 
 bool RuntimeSpriteObject::SetSprite(std::size_t nb) {
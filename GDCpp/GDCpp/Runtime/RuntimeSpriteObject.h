@@ -87,6 +87,8 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
   virtual float GetAngle() const;
 
   virtual std::vector<Polygon2d> GetHitBoxes() const;
+  virtual const TransformedHitBoxes& GetTransformedHitBoxes(
+      sf::FloatRect hint) const;
   virtual bool CursorOnObject(RuntimeScene& scene, bool accurate);
 
   /**
@@ -330,6 +332,30 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
   mutable gd::Sprite* ptrToCurrentSprite;  // Pointer to the current sprite
   mutable bool needUpdateCurrentSprite;
 
+  /**
+   * \brief The state of the object when its hitboxes were last transformed.
+   * Hitboxes are only transformed again when this state changes.
+   */
+  struct HitBoxesState {
+    const gd::Sprite* sprite;
+    float x;
+    float y;
+    float angle;
+    float scaleX;
+    float scaleY;
+    bool flippedX;
+    bool flippedY;
+
+    bool operator==(const HitBoxesState& other) const {
+      return sprite == other.sprite && x == other.x && y == other.y &&
+             angle == other.angle && scaleX == other.scaleX &&
+             scaleY == other.scaleY && flippedX == other.flippedX &&
+             flippedY == other.flippedY;
+    }
+  };
+  mutable HitBoxesState transformedHitBoxesState;
+  mutable bool transformedHitBoxesUpToDate;
+
   std::vector<AnimationProxy> animations;
 
   float opacity;
@@ -18,6 +18,21 @@ RuntimeVariablesContainer::RuntimeVariablesContainer(
   Merge(container);
 }
 
+RuntimeVariablesContainer::RuntimeVariablesContainer(
+    const RuntimeVariablesContainer& other) {
+  Init(other);
+}
+
+RuntimeVariablesContainer& RuntimeVariablesContainer::operator=(
+    const RuntimeVariablesContainer& other) {
+  if (this != &other) {
+    Clear();
+    Init(other);
+  }
+
+  return *this;
+}
+
 RuntimeVariablesContainer& RuntimeVariablesContainer::operator=(
     const gd::VariablesContainer& container) {
   Clear();
@@ -28,13 +43,26 @@ RuntimeVariablesContainer& RuntimeVariablesContainer::operator=(
 
 void RuntimeVariablesContainer::Clear() {
   variablesArray.clear();
-  for (std::map<gd::String, gd::Variable*>::iterator it = variables.begin();
-       it != variables.end();
-       ++it)
+  for (auto it = variables.begin(); it != variables.end(); ++it)
     delete it->second;
   variables.clear();
 }
 
+void RuntimeVariablesContainer::Init(const RuntimeVariablesContainer& other) {
+  std::unordered_map<const gd::Variable*, gd::Variable*> copies;
+  copies.reserve(other.variables.size());
+  variables.reserve(other.variables.size());
+  for (auto it = other.variables.begin(); it != other.variables.end(); ++it) {
+    gd::Variable* newVariable = new gd::Variable(*it->second);
+    variables[it->first] = newVariable;
+    copies[it->second] = newVariable;
+  }
+
+  variablesArray.reserve(other.variablesArray.size());
+  for (const gd::Variable* variable : other.variablesArray)
+    variablesArray.push_back(copies[variable]);
+}
+
 void RuntimeVariablesContainer::Merge(const gd::VariablesContainer& container) {
   for (std::size_t i = 0; i < container.Count(); ++i) {
     const gd::String& name = container.GetNameAt(i);
@@ -51,8 +79,7 @@ void RuntimeVariablesContainer::Merge(const gd::VariablesContainer& container) {
 }
 
 gd::Variable& RuntimeVariablesContainer::Get(const gd::String& name) {
-  std::map<gd::String, gd::Variable*>::const_iterator var =
-      variables.find(name);
+  auto var = variables.find(name);
 
   if (var != variables.end()) return *(var->second);
 
@@ -63,8 +90,7 @@ gd::Variable& RuntimeVariablesContainer::Get(const gd::String& name) {
 
 const gd::Variable& RuntimeVariablesContainer::Get(
     const gd::String& name) const {
-  std::map<gd::String, gd::Variable*>::const_iterator var =
-      variables.find(name);
+  auto var = variables.find(name);
 
   if (var != variables.end()) return *(var->second);
 
@@ -6,8 +6,8 @@
 
 #ifndef RUNTIMEVARIABLESCONTAINER_H
 #define RUNTIMEVARIABLESCONTAINER_H
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/Project/Variable.h"
 namespace gd {
@@ -42,6 +42,18 @@ class GD_API RuntimeVariablesContainer {
    */
   RuntimeVariablesContainer(){};
 
+  /**
+   * \brief Copy constructor: the variables are copied, and are accessible at
+   * the same index as in the original container.
+   */
+  RuntimeVariablesContainer(const RuntimeVariablesContainer& other);
+
+  /**
+   * \brief Assignment operator: the variables are copied, and are accessible
+   * at the same index as in the original container.
+   */
+  RuntimeVariablesContainer& operator=(const RuntimeVariablesContainer& other);
+
   /**
    * \brief Initialize a RuntimeVariablesContainer from a
    * gd::VariablesContainer.
@@ -128,7 +140,7 @@ class GD_API RuntimeVariablesContainer {
   /**
    * Get a map containing all variables.
    */
-  const std::map<gd::String, gd::Variable*>& DumpAllVariables() {
+  const std::unordered_map<gd::String, gd::Variable*>& DumpAllVariables() {
     return variables;
   };
 
@@ -138,8 +150,13 @@ class GD_API RuntimeVariablesContainer {
    */
   void Clear();
 
+  /**
+   * \brief Copy the variables of another container in this empty container.
+   */
+  void Init(const RuntimeVariablesContainer& other);
+
   std::vector<gd::Variable*> variablesArray;
-  mutable std::map<gd::String, gd::Variable*> variables;
+  mutable std::unordered_map<gd::String, gd::Variable*> variables;
   static BadVariable badVariable;
   static BadRuntimeVariablesContainer badVariablesContainer;
 };
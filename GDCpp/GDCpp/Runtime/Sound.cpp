@@ -14,15 +14,34 @@
 using namespace std;
 
 Sound::Sound(gd::String pFile) : file(pFile), volume(100) {
-  buffer = gd::ResourcesLoader::Get()->LoadSoundBuffer(file);
-  sound.setBuffer(buffer);
+  buffer = std::make_shared<sf::SoundBuffer>();
+  gd::ResourcesLoader::Get()->LoadSoundBuffer(file, *buffer);
+  sound.setBuffer(*buffer);
 }
 
-Sound::Sound() : volume(100) { sound.setBuffer(buffer); }
+Sound::Sound() : volume(100) {}
 
-Sound::Sound(const Sound& copy) : file(copy.file) {
-  buffer = gd::ResourcesLoader::Get()->LoadSoundBuffer(file);
-  sound.setBuffer(buffer);
+Sound::Sound(std::shared_ptr<sf::SoundBuffer> buffer_, gd::String pFile)
+    : volume(100) {
+  SetBuffer(buffer_, pFile);
+}
+
+Sound::Sound(const Sound& copy) : volume(copy.volume) {
+  SetBuffer(copy.buffer, copy.file);
+}
+
+void Sound::SetBuffer(std::shared_ptr<sf::SoundBuffer> buffer_,
+                      gd::String file_) {
+  ResetBuffer();
+  buffer = buffer_;
+  file = file_;
+  if (buffer) sound.setBuffer(*buffer);
+}
+
+void Sound::ResetBuffer() {
+  // The sound must not use the buffer anymore before it's released.
+  sound.resetBuffer();
+  buffer.reset();
 }
 
 void Sound::SetVolume(float volume_, float globalVolume) {
@@ -6,6 +6,7 @@
 #ifndef SOUND_H
 #define SOUND_H
 #include <SFML/Audio.hpp>
+#include <memory>
 #include "GDCpp/Runtime/String.h"
 
 /**
@@ -18,9 +19,31 @@ class GD_API Sound : sf::NonCopyable {
  public:
   Sound();
   Sound(gd::String file);
+
+  /**
+   * \brief Create a sound playing a buffer already loaded, which can be shared
+   * with other sounds (see SoundManager::GetSoundBuffer).
+   */
+  Sound(std::shared_ptr<sf::SoundBuffer> buffer, gd::String file);
+
+  /**
+   * \brief Create a sound playing the same buffer as \a copy. The buffer is
+   * shared, not loaded again.
+   */
   Sound(const Sound& copy);
   virtual ~Sound(){};
 
+  /**
+   * \brief Change the buffer played by the sound, so that the sound can be
+   * reused to play another file.
+   */
+  void SetBuffer(std::shared_ptr<sf::SoundBuffer> buffer_, gd::String file_);
+
+  /**
+   * \brief Stop the sound and release its buffer.
+   */
+  void ResetBuffer();
+
   /**
    * \brief Get the sound status
    * \return sf::Music::Paused, sf::Music::Playing or sf::Music::Stopped.
@@ -63,8 +86,8 @@ class GD_API Sound : sf::NonCopyable {
     return sound.getPlayingOffset().asSeconds();
   };
 
-  // Order is important :
-  sf::SoundBuffer buffer;
+  // Order is important: the buffer must outlive the sound.
+  std::shared_ptr<sf::SoundBuffer> buffer;
   sf::Sound sound;
 
   gd::String file;
@@ -4,6 +4,7 @@
  * reserved. This project is released under the MIT License.
  */
 #include "GDCpp/Runtime/SoundManager.h"
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -13,7 +14,14 @@
 #include "GDCpp/Runtime/Sound.h"
 #include "GDCpp/Runtime/String.h"
 
-SoundManager::SoundManager() : globalVolume(100), resourcesManager(nullptr) {}
+SoundManager::SoundManager()
+    : soundBuffersSize(0),
+      soundBuffersMemoryBudget(64 * 1024 * 1024),
+      soundBuffersUses(0),
+      soundBuffersHits(0),
+      soundBuffersMisses(0),
+      globalVolume(100),
+      resourcesManager(nullptr) {}
 
 const gd::String& SoundManager::GetFileFromSoundName(
     const gd::String& name) const {
@@ -27,8 +35,8 @@ void SoundManager::PlaySoundOnChannel(const gd::String& name,
                                       bool repeat,
                                       float volume,
                                       float pitch) {
-  std::shared_ptr<Sound> sound =
-      std::make_shared<Sound>(GetFileFromSoundName(name));
+  std::shared_ptr<Sound> sound = std::make_shared<Sound>(
+      GetSoundBuffer(name), GetFileFromSoundName(name));
   sound->sound.play();
   sound->sound.setRelativeToListener(true);
 
@@ -42,8 +50,7 @@ void SoundManager::PlaySound(const gd::String& name,
                              bool repeat,
                              float volume,
                              float pitch) {
-  sounds.push_back(
-      std::shared_ptr<Sound>(new Sound(GetFileFromSoundName(name))));
+  sounds.push_back(GetSoundFromPool(name));
   sounds.back()->sound.play();
   sounds.back()->sound.setRelativeToListener(true);
 
@@ -62,7 +69,9 @@ void SoundManager::PlayMusic(const gd::String& name,
   gd::ResourcesLoader* ressourcesLoader = gd::ResourcesLoader::Get();
   if (ressourcesLoader->HasFile(file)) {
     std::size_t size = ressourcesLoader->GetBinaryFileSize(file);
-    music->SetBuffer(ressourcesLoader->LoadBinaryFile(file), size);
+    char* buffer = ressourcesLoader->LoadBinaryFile(file);
+    music->SetBuffer(buffer, size);  // The music keeps a copy of the buffer.
+    delete[] buffer;
     music->OpenFromMemory(size);
   } else
 #endif
@@ -90,7 +99,9 @@ void SoundManager::PlayMusicOnChannel(const gd::String& name,
   gd::ResourcesLoader* ressourcesLoader = gd::ResourcesLoader::Get();
   if (ressourcesLoader->HasFile(file)) {
     std::size_t size = ressourcesLoader->GetBinaryFileSize(file);
-    music->SetBuffer(ressourcesLoader->LoadBinaryFile(file), size);
+    char* buffer = ressourcesLoader->LoadBinaryFile(file);
+    music->SetBuffer(buffer, size);  // The music keeps a copy of the buffer.
+    delete[] buffer;
     music->OpenFromMemory(size);
   } else
 #endif
@@ -108,14 +119,91 @@ void SoundManager::PlayMusicOnChannel(const gd::String& name,
 }
 
 void SoundManager::ManageGarbage() {
+  std::size_t playingSoundsCount = 0;
   for (std::size_t i = 0; i < sounds.size(); i++) {
-    if (sounds[i]->sound.getStatus() == sf::Sound::Stopped)
-      sounds.erase(sounds.begin() + i);
+    if (sounds[i]->sound.getStatus() == sf::Sound::Stopped) {
+      // Release the buffer so that it can be removed from the cache.
+      sounds[i]->ResetBuffer();
+      soundsPool.push_back(std::move(sounds[i]));
+    } else {
+      if (i != playingSoundsCount)
+        sounds[playingSoundsCount] = std::move(sounds[i]);
+      playingSoundsCount++;
+    }
   }
+  sounds.resize(playingSoundsCount);
 
-  for (std::size_t i = 0; i < musics.size(); i++) {
-    if (musics[i]->GetStatus() == sf::Music::Stopped)
-      musics.erase(musics.begin() + i);
+  musics.erase(std::remove_if(musics.begin(),
+                              musics.end(),
+                              [](const std::shared_ptr<Music>& music) {
+                                return music->GetStatus() == sf::Music::Stopped;
+                              }),
+               musics.end());
+}
+
+std::shared_ptr<Sound> SoundManager::GetSoundFromPool(const gd::String& name) {
+  if (soundsPool.empty())
+    return std::make_shared<Sound>(GetSoundBuffer(name),
+                                   GetFileFromSoundName(name));
+
+  std::shared_ptr<Sound> sound = std::move(soundsPool.back());
+  soundsPool.pop_back();
+  sound->SetBuffer(GetSoundBuffer(name), GetFileFromSoundName(name));
+  return sound;
+}
+
+std::shared_ptr<sf::SoundBuffer> SoundManager::GetSoundBuffer(
+    const gd::String& name) {
+  soundBuffersUses++;
+  auto it = soundBuffers.find(name);
+  if (it != soundBuffers.end()) {
+    soundBuffersHits++;
+    it->second.lastUse = soundBuffersUses;
+    return it->second.buffer;
+  }
+
+  soundBuffersMisses++;
+  CachedSoundBuffer& cachedBuffer = soundBuffers[name];
+  cachedBuffer.buffer = std::make_shared<sf::SoundBuffer>();
+  gd::ResourcesLoader::Get()->LoadSoundBuffer(GetFileFromSoundName(name),
+                                              *cachedBuffer.buffer);
+  cachedBuffer.size = cachedBuffer.buffer->getSampleCount() * sizeof(sf::Int16);
+  cachedBuffer.lastUse = soundBuffersUses;
+  soundBuffersSize += cachedBuffer.size;
+
+  // Keep a reference, as the buffer can be evicted if it's over the budget.
+  std::shared_ptr<sf::SoundBuffer> buffer = cachedBuffer.buffer;
+  ApplySoundBuffersMemoryBudget();
+  return buffer;
+}
+
+void SoundManager::EvictSoundBuffer(const gd::String& name) {
+  auto it = soundBuffers.find(name);
+  if (it == soundBuffers.end()) return;
+
+  soundBuffersSize -= it->second.size;
+  soundBuffers.erase(it);
+}
+
+void SoundManager::SetSoundBuffersMemoryBudget(std::size_t budget) {
+  soundBuffersMemoryBudget = budget;
+  ApplySoundBuffersMemoryBudget();
+}
+
+void SoundManager::ApplySoundBuffersMemoryBudget() {
+  while (soundBuffersSize > soundBuffersMemoryBudget) {
+    // Buffers only referenced by the cache are not played by any sound.
+    auto leastRecentlyUsed = soundBuffers.end();
+    for (auto it = soundBuffers.begin(); it != soundBuffers.end(); ++it) {
+      if (it->second.buffer.use_count() == 1 &&
+          (leastRecentlyUsed == soundBuffers.end() ||
+           it->second.lastUse < leastRecentlyUsed->second.lastUse))
+        leastRecentlyUsed = it;
+    }
+    if (leastRecentlyUsed == soundBuffers.end()) return;
+
+    soundBuffersSize -= leastRecentlyUsed->second.size;
+    soundBuffers.erase(leastRecentlyUsed);
   }
 }
 
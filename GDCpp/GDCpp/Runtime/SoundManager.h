@@ -128,25 +128,112 @@ class GD_API SoundManager {
   void SetGlobalVolume(float volume);
 
   /**
-   * Destroy all sounds and musics
+   * Destroy all sounds and musics, and the cached sound buffers.
    */
   void ClearAllSoundsAndMusics() {
     musicsChannel.clear();
     soundsChannel.clear();
     sounds.clear();
     musics.clear();
+    soundsPool.clear();
+    soundBuffers.clear();
+    soundBuffersSize = 0;
   }
 
   /**
-   * Ensure sounds and musics without channels and stopped are destroyed.
+   * Ensure sounds without channels and stopped are reused by the next sounds,
+   * and that musics without channels and stopped are destroyed.
    */
   void ManageGarbage();
 
+  /** \name Sound buffers cache
+   * Sounds are decoded once and their buffers are shared by all the sounds
+   * playing the same resource.
+   */
+  ///@{
+  /**
+   * \brief Return the decoded buffer of a sound, loading it if it's not in the
+   * cache.
+   * \param name The resource name, or filename to load.
+   */
+  std::shared_ptr<sf::SoundBuffer> GetSoundBuffer(const gd::String& name);
+
+  /**
+   * \brief Load the buffer of a sound in the cache, so that it's not decoded
+   * when the sound is first played.
+   */
+  void PreloadSoundBuffer(const gd::String& name) { GetSoundBuffer(name); }
+
+  /**
+   * \brief Remove the buffer of a sound from the cache. Sounds being played
+   * keep the buffer until they are stopped.
+   */
+  void EvictSoundBuffer(const gd::String& name);
+
+  /**
+   * \brief Set the memory, in bytes, that the cached buffers can use.
+   *
+   * When the budget is exceeded, the least recently used buffers that are not
+   * played anymore are removed from the cache.
+   */
+  void SetSoundBuffersMemoryBudget(std::size_t budget);
+
+  /**
+   * \brief Return the memory, in bytes, that the cached buffers can use.
+   */
+  std::size_t GetSoundBuffersMemoryBudget() const {
+    return soundBuffersMemoryBudget;
+  }
+
+  /**
+   * \brief Return the memory, in bytes, used by the cached buffers.
+   */
+  std::size_t GetSoundBuffersMemorySize() const { return soundBuffersSize; }
+
+  /**
+   * \brief Return the number of times a sound buffer was found in the cache.
+   */
+  std::size_t GetSoundBuffersCacheHits() const { return soundBuffersHits; }
+
+  /**
+   * \brief Return the number of times a sound buffer had to be loaded.
+   */
+  std::size_t GetSoundBuffersCacheMisses() const { return soundBuffersMisses; }
+  ///@}
+
  private:
   const gd::String& GetFileFromSoundName(const gd::String& name) const;
 
+  /**
+   * \brief Return a sound playing the buffer of the sound called \a name,
+   * reusing a stopped sound if possible.
+   */
+  std::shared_ptr<Sound> GetSoundFromPool(const gd::String& name);
+
+  /**
+   * \brief Remove the least recently used buffers that are not played until
+   * the cached buffers fit in the memory budget.
+   */
+  void ApplySoundBuffersMemoryBudget();
+
+  struct CachedSoundBuffer {
+    std::shared_ptr<sf::SoundBuffer> buffer;
+    std::size_t size;     ///< The memory used by the samples, in bytes.
+    std::size_t lastUse;  ///< The value of soundBuffersUses when last used.
+  };
+
   std::map<std::size_t, std::shared_ptr<Sound> > soundsChannel;
   std::map<std::size_t, std::shared_ptr<Music> > musicsChannel;
+  vector<std::shared_ptr<Sound> >
+      soundsPool;  ///< Stopped sounds, without buffer, to be reused.
+
+  std::map<gd::String, CachedSoundBuffer>
+      soundBuffers;  ///< The decoded sounds, by resource name.
+  std::size_t soundBuffersSize;
+  std::size_t soundBuffersMemoryBudget;
+  std::size_t soundBuffersUses;
+  std::size_t soundBuffersHits;
+  std::size_t soundBuffersMisses;
 
   float globalVolume;
   gd::ResourcesManager* resourcesManager;
@@ -0,0 +1,9 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#if !defined(GD_IDE_ONLY)
+#include "GDCore/Tools/NamesIndex.cpp"
+#endif
@@ -0,0 +1,30 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/TransformedHitBoxes.h"
+#include <algorithm>
+
+void TransformedHitBoxes::Update() {
+  aabbs.resize(polygons.size());
+  for (std::size_t i = 0; i < polygons.size(); ++i) {
+    const Polygon2d& polygon = polygons[i];
+    polygon.ComputeEdges();
+
+    if (polygon.vertices.empty()) {
+      aabbs[i] = sf::FloatRect();
+      continue;
+    }
+
+    float minX = polygon.vertices[0].x, maxX = polygon.vertices[0].x;
+    float minY = polygon.vertices[0].y, maxY = polygon.vertices[0].y;
+    for (std::size_t j = 1; j < polygon.vertices.size(); ++j) {
+      minX = std::min(minX, polygon.vertices[j].x);
+      maxX = std::max(maxX, polygon.vertices[j].x);
+      minY = std::min(minY, polygon.vertices[j].y);
+      maxY = std::max(maxY, polygon.vertices[j].y);
+    }
+    aabbs[i] = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef TRANSFORMEDHITBOXES_H
+#define TRANSFORMEDHITBOXES_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+#include "GDCpp/Runtime/Polygon2d.h"
+
+/**
+ * \brief The hitboxes of an object in scene coordinates, with the edges and
+ * the bounding box of each polygon precomputed.
+ *
+ * Used by RuntimeObject to let collision tests read the hitboxes of an object
+ * without copying them.
+ *
+ * \see RuntimeObject::GetTransformedHitBoxes
+ * \ingroup GameEngine
+ */
+class GD_API TransformedHitBoxes {
+ public:
+  TransformedHitBoxes(){};
+  virtual ~TransformedHitBoxes(){};
+
+  /**
+   * \brief Get the polygons.
+   * \warning Call Update() after modifying them.
+   */
+  std::vector<Polygon2d>& GetPolygons() { return polygons; }
+
+  /**
+   * \brief Get the polygons. Their edges are computed.
+   */
+  const std::vector<Polygon2d>& GetPolygons() const { return polygons; }
+
+  /**
+   * \brief Get the bounding box of the polygon at the specified index.
+   */
+  const sf::FloatRect& GetPolygonAABB(std::size_t index) const {
+    return aabbs[index];
+  }
+
+  /**
+   * \brief Compute the edges and the bounding boxes of the polygons.
+   */
+  void Update();
+
+  /**
+   * \brief Return true if two bounding boxes are strictly separated, meaning
+   * that the polygons they contain can't be colliding (not even touching).
+   */
+  static bool AreSeparated(const sf::FloatRect& a, const sf::FloatRect& b) {
+    return a.left > b.left + b.width || b.left > a.left + a.width ||
+           a.top > b.top + b.height || b.top > a.top + a.height;
+  }
+
+ private:
+  std::vector<Polygon2d> polygons;
+  std::vector<sf::FloatRect> aabbs;  ///< The bounding box of each polygon.
+};
+
+#endif  // TRANSFORMEDHITBOXES_H
@@ -10,7 +10,7 @@
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/CodeExecutionEngine.h"
-#include "GDCpp/Runtime/Serialization/Serializer.h"
+#include "GDCpp/Runtime/Serialization/JSONReader.h"
 #include "GDCpp/Runtime/SceneStack.h"
 #include "GDCpp/Runtime/ResourcesLoader.h"
 
@@ -32,7 +32,10 @@ extern "C" ExtensionBase * CreateGDCppPlatformBehaviorExtension();
 extern "C" ExtensionBase * CreateGDCppPanelSpriteObjectExtension();
 
 //TODO: move me to an android specific
+#include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <android/log.h>
 class androidbuf : public std::streambuf {
 public:
@@ -86,11 +89,21 @@ int main(int argc, char *argv[])
 
     GDLogBanner();
 
+    //Read the project while parsing the JSON, without building the elements of
+    //the whole document (and in particular of all the initial instances), nor
+    //copying the file in memory.
     gd::Project game;
-    gd::String json = gd::ResourcesLoader::Get()->LoadPlainText("gd-project.json");
+    {
+        std::unique_ptr<std::istream> jsonStream =
+            gd::ResourcesLoader::Get()->OpenFileStream("gd-project.json");
+        if (!jsonStream) {
+            std::cout << "Unable to read game data. Aborting." << std::endl;
+            return EXIT_FAILURE;
+        }
 
-    SerializerElement rootElement = Serializer::FromJSON(json);
-    game.UnserializeFrom(rootElement);
+        gd::JSONReader reader(*jsonStream);
+        game.UnserializeFrom(reader);
+    }
 
     RuntimeGame runtimeGame;
     runtimeGame.LoadFromProject(game);
@@ -111,7 +111,12 @@ int main( int argc, char *p_argv[] )
 
         cout << "Getting src raw data..." << endl;
         char * ibuffer = resLoader->LoadBinaryFile( "src" );
-        char * obuffer = new char[size];
+        if ( !ibuffer )
+            return DisplayMessage("Unable to read game data. Aborting.");
+
+        //One more byte for the terminating null character, so that the
+        //decrypted data can be parsed in place.
+        char * obuffer = new char[size+1];
 
         unsigned char key[] = "-P:j$4t&OHIUVM/Z+u4DeDP.";
         const unsigned char iv[16] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F };
@@ -120,13 +125,14 @@ int main( int argc, char *p_argv[] )
         aes_setks_decrypt(key, 192, &keySetting);
         aes_cbc_decrypt(reinterpret_cast<const unsigned char*>(ibuffer), reinterpret_cast<unsigned char*>(obuffer),
             (uint8_t*)iv, size/AES_BLOCK_SIZE, &keySetting);
-
-        std::string uncryptedSrc = std::string(obuffer, size);
-        delete [] obuffer;
+        obuffer[size] = '\0';
+        delete [] ibuffer;
 
         cout << "Loading game data..." << endl;
         TiXmlDocument doc;
-        if ( !doc.Parse(uncryptedSrc.c_str()) )
+        bool parsed = doc.Parse(obuffer) != NULL;
+        delete [] obuffer;
+        if ( !parsed )
         {
             return DisplayMessage("Unable to parse game data. Aborting.");
         }
@@ -9,7 +9,11 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "catch.hpp"
 
@@ -41,6 +45,47 @@ TEST_CASE("RuntimeScene", "[common]") {
     REQUIRE(scene.GetVariables().Get("MaVar").GetString() == "Hello");
     REQUIRE(scene.GetVariables().Get("MaVar2").GetValue() == 42);
   }
+  SECTION("Loading instances from a layout") {
+    gd::Layout layout;
+    gd::Variable var;
+    var.SetValue(1);
+    gd::Object object("MyObject");
+    object.GetVariables().Insert("MyVar", var, 0);
+    layout.InsertObject(object, 0);
+    gd::SerializerElement instancesElement;
+    instancesElement.ConsiderAsArrayOf("instance");
+    for (std::size_t i = 0; i < 3; ++i) {
+      gd::SerializerElement& instanceElement =
+          instancesElement.AddChild("instance");
+      instanceElement.SetAttribute("name",
+                                   i == 2 ? "UnknownObject" : "MyObject");
+      instanceElement.SetAttribute("x", 10.0 * i);
+      instanceElement.SetAttribute("y", 20.0);
+      if (i == 1) {
+        gd::VariablesContainer instanceVariables;
+        var.SetValue(2);
+        instanceVariables.Insert("MyVar", var, 0);
+        instanceVariables.SerializeTo(
+            instanceElement.AddChild("initialVariables"));
+      }
+    }
+    layout.GetInitialInstances().UnserializeFrom(instancesElement);
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    scene.LoadFromScene(layout);
+
+    const RuntimeObjList& objects =
+        scene.objectsInstances.GetObjects("MyObject");
+    REQUIRE(objects.size() == 2);
+    REQUIRE(scene.objectsInstances.GetAllObjects().size() == 2);
+    REQUIRE(objects[0] != objects[1]);
+    REQUIRE(objects[0]->GetX() == 0);
+    REQUIRE(objects[1]->GetX() == 10);
+    REQUIRE(objects[1]->GetY() == 20);
+    REQUIRE(objects[0]->GetVariables().Get("MyVar").GetValue() == 1);
+    REQUIRE(objects[1]->GetVariables().Get("MyVar").GetValue() == 2);
+  }
 }
 
 TEST_CASE("gd::Project", "[common]") {
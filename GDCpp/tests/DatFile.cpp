@@ -0,0 +1,106 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the creation and reading of DAT files.
+ */
+#include "GDCpp/Runtime/DatFile.h"
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "catch.hpp"
+
+namespace {
+void WriteTestFile(const std::string& filename, const std::string& content) {
+  std::ofstream file(filename, std::ios_base::out | std::ios_base::binary);
+  file << content;
+}
+
+std::string ReadFromDatFile(DatFile& datFile, const gd::String& filename) {
+  std::shared_ptr<char> data = datFile.GetFile(filename);
+  if (!data) return "";
+  return std::string(data.get(), datFile.GetFileSize(filename));
+}
+}  // namespace
+
+TEST_CASE("DatFile", "[game-engine]") {
+  std::string text;
+  for (int i = 0; i < 1000; ++i)
+    text += "Line " + std::to_string(i % 20) + " of the text.\n";
+  std::string binary;
+  for (int i = 0; i < 5000; ++i)
+    binary.push_back(static_cast<char>((i * 7919) % 251));
+  WriteTestFile("DatFileTest.txt", text);
+  WriteTestFile("DatFileTest.bin", binary);
+  WriteTestFile("DatFileTest.empty", "");
+
+  std::vector<gd::String> files = {
+      "DatFileTest.txt", "DatFileTest.bin", "DatFileTest.empty"};
+
+  SECTION("Compressed files") {
+    DatFile datFile;
+    REQUIRE(datFile.Create(files, ".", "DatFileTest.dat"));
+    REQUIRE(datFile.Read("DatFileTest.dat"));
+
+    REQUIRE(datFile.ContainsFile("DatFileTest.txt"));
+    REQUIRE(datFile.ContainsFile("DatFileTest.bin"));
+    REQUIRE(datFile.ContainsFile("DatFileTest.empty"));
+    REQUIRE(!datFile.ContainsFile("DatFileTest"));
+    REQUIRE(datFile.GetFile("DatFileTest") == nullptr);
+    REQUIRE(datFile.GetFileSize("DatFileTest") == 0);
+
+    REQUIRE(datFile.GetFileSize("DatFileTest.txt") == text.size());
+    REQUIRE(ReadFromDatFile(datFile, "DatFileTest.txt") == text);
+    REQUIRE(ReadFromDatFile(datFile, "DatFileTest.bin") == binary);
+    REQUIRE(ReadFromDatFile(datFile, "DatFileTest.empty") == "");
+
+    // Uncompressed files are shared while they are used, then freed.
+    std::shared_ptr<char> data = datFile.GetFile("DatFileTest.txt");
+    REQUIRE(datFile.GetFile("DatFileTest.txt") == data);
+    std::weak_ptr<char> releasedData = data;
+    data.reset();
+    REQUIRE(releasedData.expired());
+
+    // The text is compressed, so the DAT file is smaller than the files.
+    std::ifstream datFileStream("DatFileTest.dat",
+                                std::ios_base::in | std::ios_base::binary);
+    datFileStream.seekg(0, std::ios::end);
+    REQUIRE(static_cast<std::size_t>(datFileStream.tellg()) <
+            text.size() / 2 + binary.size() + 1024);
+  }
+
+  SECTION("Files stored as is") {
+    DatFile datFile;
+    REQUIRE(datFile.Create(files, ".", "DatFileTest.dat", false));
+    REQUIRE(datFile.Read("DatFileTest.dat"));
+
+    REQUIRE(ReadFromDatFile(datFile, "DatFileTest.txt") == text);
+    REQUIRE(ReadFromDatFile(datFile, "DatFileTest.bin") == binary);
+
+    // Files data are aligned and are read directly from the DAT file.
+    std::shared_ptr<char> data = datFile.GetFile("DatFileTest.bin");
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(data.get());
+    REQUIRE((address % DatFile::dataAlignment) == 0);
+    REQUIRE(datFile.GetFile("DatFileTest.bin") == data);
+
+    // The data stays valid after the DAT file is closed.
+    REQUIRE(datFile.Read("DatFileTest.dat"));
+    REQUIRE(std::string(data.get(), binary.size()) == binary);
+  }
+
+  SECTION("Invalid files") {
+    DatFile datFile;
+    REQUIRE(!datFile.Create({"DatFileTest.missing"}, ".", "DatFileTest.dat"));
+    REQUIRE(!datFile.Read("DatFileTest.txt"));
+    REQUIRE(!datFile.Read("DatFileTest.missing"));
+    REQUIRE(!datFile.ContainsFile("DatFileTest.txt"));
+  }
+
+  std::remove("DatFileTest.txt");
+  std::remove("DatFileTest.bin");
+  std::remove("DatFileTest.empty");
+  std::remove("DatFileTest.dat");
+}
@@ -62,4 +62,63 @@ TEST_CASE("ObjInstancesHolder", "[common]") {
     REQUIRE(container.GetObjects("2").size() == 3);
     REQUIRE(container.GetObjectsRawPointers("2").size() == 3);
   }
+  SECTION("Removing and renaming objects") {
+    gd::Object obj1("1");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder& container = scene.objectsInstances;
+    RuntimeObject* objA = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    RuntimeObject* objB = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    RuntimeObject* objC = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+
+    // Deleted objects are renamed and moved to the list of their new name.
+    objA->DeleteFromScene(scene);
+    REQUIRE(container.GetObjects("1").size() == 2);
+    REQUIRE(container.GetObjectsRawPointers("").size() == 1);
+    REQUIRE(container.GetObjectsRawPointers("")[0] == objA);
+    REQUIRE(container.GetObjectsToBeDeleted().size() == 1);
+    REQUIRE(container.GetAllObjects().size() == 3);
+
+    // The objects are still found after the lists were reordered.
+    container.RemoveObject(objB);
+    REQUIRE(container.GetObjectsRawPointers("1").size() == 1);
+    REQUIRE(container.GetObjectsRawPointers("1")[0] == objC);
+    REQUIRE(container.GetAllObjects().size() == 2);
+
+    container.RemoveObject(objA);
+    REQUIRE(container.GetObjects("").size() == 0);
+    REQUIRE(container.GetAllObjects().size() == 1);
+    REQUIRE(container.GetAllObjects()[0] == objC);
+
+    container.RemoveObject(objC);
+    REQUIRE(container.GetAllObjects().empty());
+    REQUIRE(container.GetObjects("1").size() == 0);
+  }
+  SECTION("Adding objects in batch") {
+    gd::Object obj1("1");
+    gd::Object obj2("2");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    std::vector<std::unique_ptr<RuntimeObject>> objects;
+    for (std::size_t i = 0; i < 10; ++i) {
+      objects.push_back(std::unique_ptr<RuntimeObject>(
+          new RuntimeObject(scene, i % 2 == 0 ? obj1 : obj2)));
+    }
+    RuntimeObject* firstObject = objects[0].get();
+
+    ObjInstancesHolder container;
+    container.AddObjects(std::move(objects));
+    REQUIRE(objects.empty());
+    REQUIRE(container.GetAllObjects().size() == 10);
+    REQUIRE(container.GetObjects("1").size() == 5);
+    REQUIRE(container.GetObjects("2").size() == 5);
+    REQUIRE(container.GetObjectsRawPointers("1")[0] == firstObject);
+  }
 }
@@ -11,6 +11,7 @@
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
 #include "GDCpp/Extensions/Builtin/RuntimeSceneTools.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
@@ -31,6 +32,74 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
   RuntimeObject obj2A(scene, obj2);
   RuntimeObject obj2B(scene, obj2);
   RuntimeObject obj2C(scene, obj2);
+  SECTION("RuntimeObjectsLists") {
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+
+    RuntimeObjectsLists lists;
+    lists["2"] = &list2;
+    lists["1"] = &list1;
+    REQUIRE(lists.size() == 2);
+    REQUIRE(lists.begin()->first == "1");  // Lists are sorted by name.
+    REQUIRE(lists.begin()->second == &list1);
+    REQUIRE(lists.find("2")->second == &list2);
+    REQUIRE(lists.find("3") == lists.end());
+
+    lists.clear();
+    REQUIRE(lists.empty());
+    lists["3"] = &list1;
+    REQUIRE(lists.size() == 1);
+    REQUIRE(lists.find("1") == lists.end());
+    REQUIRE(lists.find("3")->second == &list1);
+
+    std::map<gd::String, std::vector<RuntimeObject*>*> map = lists;
+    REQUIRE(map.size() == 1);
+    REQUIRE(map["3"] == &list1);
+  }
+  SECTION("RuntimeContext objects lists") {
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+    RuntimeContext context(&scene);
+
+    {
+      // Lists stay valid whatever the number of lists used at once.
+      std::vector<RuntimeContext::ObjectListsHandle> handles;
+      for (std::size_t i = 0; i < 100; ++i) {
+        handles.push_back(context.ClearObjectListsMap()
+                              .AddObjectListToMap("1", list1)
+                              .ReturnObjectListsMap());
+      }
+      handles.push_back(context.ClearObjectListsMap()
+                            .AddObjectListToMap("2", list2)
+                            .ReturnObjectListsMap());
+      for (std::size_t i = 0; i < 100; ++i) {
+        const RuntimeObjectsLists& lists = handles[i];
+        REQUIRE(lists.size() == 1);
+        REQUIRE(lists.find("1")->second == &list1);
+      }
+      const RuntimeObjectsLists& lastLists = handles.back();
+      REQUIRE(lastLists.find("1") == lastLists.end());
+      REQUIRE(lastLists.find("2")->second == &list2);
+    }
+
+    // Released lists are reused.
+    const RuntimeObjectsLists* releasedLists = nullptr;
+    {
+      RuntimeContext::ObjectListsHandle handle =
+          context.ClearObjectListsMap()
+              .AddObjectListToMap("1", list1)
+              .ReturnObjectListsMap();
+      releasedLists = &static_cast<RuntimeObjectsLists&>(handle);
+    }
+    RuntimeContext::ObjectListsHandle handle =
+        context.ClearObjectListsMap()
+            .AddObjectListToMap("2", list2)
+            .ReturnObjectListsMap();
+    const RuntimeObjectsLists& lists = handle;
+    REQUIRE(&lists == releasedLists);
+    REQUIRE(lists.size() == 1);
+    REQUIRE(lists.find("2")->second == &list2);
+  }
   SECTION("PickObjectsIf") {
     std::map<gd::String, std::vector<RuntimeObject*>*> map;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
@@ -101,6 +170,53 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
     REQUIRE(list1[0] == &obj1A);
     REQUIRE(list2[0] == &obj2C);
   }
+  SECTION("TwoObjectListsTest with a spatial hash") {
+    std::map<gd::String, std::vector<RuntimeObject*>*> map1;
+    std::map<gd::String, std::vector<RuntimeObject*>*> map2;
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+    map1["1"] = &list1;
+    map2["2"] = &list2;
+    obj1A.SetX(0);
+    obj1B.SetX(1000);
+    obj1C.SetX(2000);
+    obj2A.SetX(0);
+    obj2B.SetX(3000);
+    obj2C.SetX(4000);
+
+    RuntimeObjectsSpatialHash spatialHash;
+    spatialHash.Rebuild({&obj1A, &obj1B, &obj1C, &obj2A, &obj2B, &obj2C});
+
+    // Objects moved after the index was built must still be found.
+    obj2B.SetX(2000);
+
+    std::size_t predicateCallsCount = 0;
+    auto isSamePosition = [&predicateCallsCount](RuntimeObject* obj1,
+                                                 RuntimeObject* obj2) {
+      predicateCallsCount++;
+      return obj1->GetX() == obj2->GetX() && obj1->GetY() == obj2->GetY();
+    };
+
+    SECTION("Picking") {
+      REQUIRE(TwoObjectListsTest(
+                  map1, map2, false, spatialHash, isSamePosition) == true);
+      REQUIRE(predicateCallsCount == 2);  // Only near objects are tested.
+      REQUIRE(list1.size() == 2);
+      REQUIRE(list1[0] == &obj1A);
+      REQUIRE(list1[1] == &obj1C);
+      REQUIRE(list2.size() == 2);
+      REQUIRE(list2[0] == &obj2A);
+      REQUIRE(list2[1] == &obj2B);
+    }
+    SECTION("Inverted picking") {
+      REQUIRE(TwoObjectListsTest(
+                  map1, map2, true, spatialHash, isSamePosition) == true);
+      REQUIRE(predicateCallsCount == 2);
+      REQUIRE(list1.size() == 1);
+      REQUIRE(list1[0] == &obj1B);
+      REQUIRE(list2.size() == 3);
+    }
+  }
   SECTION("PickNearestObject") {
     std::map<gd::String, std::vector<RuntimeObject*>*> map;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
@@ -0,0 +1,62 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering RuntimeObject class.
+ */
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+gd::Behavior* NewBehavior(const gd::String& name) {
+  gd::Behavior* behavior = new gd::Behavior;
+  behavior->SetName(name);
+  return behavior;
+}
+}  // namespace
+
+TEST_CASE("RuntimeObject", "[game-engine]") {
+  SECTION("Behaviors slots") {
+    gd::Object obj1("1");
+    obj1.AddBehavior(NewBehavior("Platformer"));
+    obj1.AddBehavior(NewBehavior("Pathfinding"));
+    gd::Object obj2("2");
+    obj2.AddBehavior(NewBehavior("Pathfinding"));
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    RuntimeObject object1(scene, obj1);
+    RuntimeObject object2(scene, obj2);
+
+    std::size_t platformerSlot = RuntimeObject::GetBehaviorSlot("Platformer");
+    std::size_t pathfindingSlot = RuntimeObject::GetBehaviorSlot("Pathfinding");
+    std::size_t unusedSlot = RuntimeObject::GetBehaviorSlot("Unused");
+    REQUIRE(platformerSlot != pathfindingSlot);
+    REQUIRE(unusedSlot != pathfindingSlot);
+    REQUIRE(RuntimeObject::GetBehaviorSlot("Platformer") == platformerSlot);
+
+    // Slots are shared by objects of different types.
+    REQUIRE(object1.GetBehaviorInSlot(platformerSlot) ==
+            object1.GetBehaviorRawPointer("Platformer"));
+    REQUIRE(object1.GetBehaviorInSlot(pathfindingSlot) ==
+            object1.GetBehaviorRawPointer("Pathfinding"));
+    REQUIRE(object2.GetBehaviorInSlot(pathfindingSlot) ==
+            object2.GetBehaviorRawPointer("Pathfinding"));
+    REQUIRE(object2.GetBehaviorInSlot(platformerSlot) == NULL);
+    REQUIRE(object1.GetBehaviorInSlot(unusedSlot) == NULL);
+
+    // Copies have their own behaviors in the same slots.
+    RuntimeObject copy(object1);
+    REQUIRE(copy.GetBehaviorInSlot(platformerSlot) != NULL);
+    REQUIRE(copy.GetBehaviorInSlot(platformerSlot) !=
+            object1.GetBehaviorInSlot(platformerSlot));
+    REQUIRE(copy.GetBehaviorInSlot(platformerSlot) ==
+            copy.GetBehaviorRawPointer("Platformer"));
+  }
+}
@@ -86,4 +86,47 @@ TEST_CASE("RuntimeSpriteObject", "[game-engine]") {
       REQUIRE(object.GetCurrentAnimationName() == "First animation");
     }
   }
+  SECTION("Hitboxes") {
+    gd::SpriteObject obj2("SpriteObjectWithCustomMask");
+    {
+      Polygon2d mask = Polygon2d::CreateRectangle(10, 10);
+      mask.Move(5, 5);
+
+      gd::Animation anim;
+      gd::Sprite sprite;
+      sprite.SetImageName("Image.png");
+      sprite.SetCustomCollisionMask({mask});
+      sprite.SetCollisionMaskAutomatic(false);
+      anim.SetDirectionsCount(1);
+      anim.GetDirection(0).AddSprite(sprite);
+      obj2.AddAnimation(anim);
+    }
+
+    RuntimeSpriteObject object2(scene, obj2);
+    const TransformedHitBoxes& hitBoxes =
+        object2.GetTransformedHitBoxes(sf::FloatRect());
+    REQUIRE(hitBoxes.GetPolygons().size() == 1);
+    REQUIRE(hitBoxes.GetPolygonAABB(0).left == 0);
+    REQUIRE(hitBoxes.GetPolygonAABB(0).width == 10);
+
+    // Hitboxes must be updated when the object is moved or scaled.
+    object2.SetX(100);
+    object2.SetY(50);
+    REQUIRE(object2.GetTransformedHitBoxes(sf::FloatRect())
+                .GetPolygonAABB(0)
+                .left == 100);
+    REQUIRE(object2.GetTransformedHitBoxes(sf::FloatRect())
+                .GetPolygonAABB(0)
+                .top == 50);
+    REQUIRE(object2.IsCollidingWithPoint(105, 55) == true);
+    REQUIRE(object2.IsCollidingWithPoint(5, 5) == false);
+
+    object2.SetScaleX(2);
+    REQUIRE(object2.GetTransformedHitBoxes(sf::FloatRect())
+                .GetPolygonAABB(0)
+                .width == 20);
+    REQUIRE(object2.GetHitBoxes().size() == 1);
+    REQUIRE(object2.GetHitBoxes()[0].vertices ==
+            hitBoxes.GetPolygons()[0].vertices);
+  }
 }
@@ -0,0 +1,90 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmark of the loading of a scene with many initial instances (like
+ * a level made of tiles).
+ *
+ * The benchmarks are not part of GDCpp_tests: run them with
+ * `GDCpp_benchmarks`.
+ */
+#include <iostream>
+#include "BenchmarkTools.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * Return a sprite object with a few animations, like the tiles of a level.
+ */
+gd::SpriteObject CreateTileObject(const gd::String &name) {
+  gd::SpriteObject object(name);
+  object.SetType("Sprite");
+  gd::Variable health;
+  health.SetValue(100);
+  object.GetVariables().Insert("Health", health, 0);
+  gd::Variable kind;
+  kind.SetString(name);
+  object.GetVariables().Insert("Kind", kind, 1);
+  for (std::size_t i = 0; i < 4; ++i) {
+    gd::Animation animation;
+    animation.SetName("Animation" + gd::String::From(i));
+    animation.SetDirectionsCount(1);
+    for (std::size_t j = 0; j < 4; ++j) {
+      gd::Sprite sprite;
+      sprite.SetImageName(name + gd::String::From(j) + ".png");
+      animation.GetDirection(0).AddSprite(sprite);
+    }
+    object.AddAnimation(animation);
+  }
+
+  return object;
+}
+
+}  // namespace
+
+TEST_CASE("Scene loading benchmark", "[benchmark]") {
+  const std::size_t objectsCount = 10;
+  const std::size_t instancesCount = 50000;
+
+  gd::Layout layout;
+  layout.SetName("Level");
+  for (std::size_t i = 0; i < objectsCount; ++i)
+    layout.InsertObject(CreateTileObject("Tile" + gd::String::From(i)), i);
+  gd::SerializerElement instancesElement;
+  instancesElement.ConsiderAsArrayOf("instance");
+  for (std::size_t i = 0; i < instancesCount; ++i) {
+    gd::SerializerElement &instanceElement =
+        instancesElement.AddChild("instance");
+    instanceElement.SetAttribute("name",
+                                 "Tile" + gd::String::From(i % objectsCount));
+    instanceElement.SetAttribute("x", 32.0 * (i % 500));
+    instanceElement.SetAttribute("y", 32.0 * (i / 500));
+  }
+  layout.GetInitialInstances().UnserializeFrom(instancesElement);
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  double loadingTime =
+      MeasureMilliseconds([&]() { scene.LoadFromScene(layout); });
+  REQUIRE(scene.objectsInstances.GetAllObjects().size() == instancesCount);
+
+  // Also measure the creation of the objects alone, without the copy of the
+  // layout done when loading the scene.
+  scene.objectsInstances.Clear();
+  double creationTime = MeasureMilliseconds(
+      [&]() { scene.CreateObjectsFrom(layout.GetInitialInstances()); });
+  REQUIRE(scene.objectsInstances.GetAllObjects().size() == instancesCount);
+
+  std::cout << instancesCount << " instances of " << objectsCount
+            << " objects: scene loaded in " << loadingTime
+            << "ms, objects created in " << creationTime << "ms" << std::endl;
+}
@@ -22,6 +22,7 @@
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/ParallelTasks.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDJS/IDE/ExporterHelper.h"
 #undef CopyFile  // Disable an annoying macro
@@ -34,6 +35,37 @@ static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
     container.push_back(str);
 }
 
+/**
+ * Read the code and the includes of a scene from the events code cache.
+ * \return false if the code is not in the cache.
+ */
+static bool ReadCachedEventsCode(gd::AbstractFileSystem &fs,
+                                 const gd::String &cacheFile,
+                                 gd::String &eventsOutput,
+                                 std::set<gd::String> &eventsIncludes) {
+  if (!fs.FileExists(cacheFile + ".js") ||
+      !fs.FileExists(cacheFile + ".includes"))
+    return false;
+
+  eventsOutput = fs.ReadFile(cacheFile + ".js");
+  for (auto &include : fs.ReadFile(cacheFile + ".includes").Split(U'\n'))
+    if (!include.empty()) eventsIncludes.insert(include);
+
+  return true;
+}
+
+static void WriteCachedEventsCode(gd::AbstractFileSystem &fs,
+                                  const gd::String &cacheFile,
+                                  const gd::String &eventsOutput,
+                                  const std::set<gd::String> &eventsIncludes) {
+  gd::String includes;
+  for (auto &include : eventsIncludes) includes += include + "\n";
+
+  // The code is written last, as the cache is only used if it exists.
+  fs.WriteToFile(cacheFile + ".includes", includes);
+  fs.WriteToFile(cacheFile + ".js", eventsOutput);
+}
+
 static void GenerateFontsDeclaration(
     const gd::ResourcesManager &resourcesManager,
     gd::AbstractFileSystem &fs,
@@ -600,24 +632,73 @@ bool ExporterHelper::ExportEventsCode(gd::Project &project,
                                       std::vector<gd::String> &includesFiles,
                                       bool exportForPreview) {
   fs.MkDir(outputDir);
-
-  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
-    std::set<gd::String> eventsIncludes;
-    gd::Layout &exportedLayout = project.GetLayout(i);
-    gd::String eventsOutput =
-        EventsCodeGenerator::GenerateSceneEventsCompleteCode(
+  gd::String cacheDir = outputDir + "/eventsCodeCache";
+  fs.MkDir(cacheDir);
+
+  // The code of each layout is generated independently of the other layouts
+  // (the generator works on a copy of the events), so layouts are hashed and
+  // generated in parallel. Files are then written in the order of the layouts
+  // so that the includes are always the same.
+  // The parts of the project shared by all the layouts are serialized once,
+  // before the parallel tasks, as serializing them modifies the variables.
+  std::size_t layoutsCount = project.GetLayoutsCount();
+  std::vector<gd::String> cacheFiles(layoutsCount);
+  const gd::String projectData =
+      EventsCodeGenerator::SerializeProjectForEventsCodeHash(project);
+  gd::ParallelTasks::Run(layoutsCount, [&](std::size_t i) {
+    const gd::Layout &exportedLayout = project.GetLayout(i);
+    cacheFiles[i] =
+        cacheDir + "/" +
+        EventsCodeGenerator::GenerateSceneEventsCompleteCodeHash(
             project,
             exportedLayout,
             exportedLayout.GetEvents(),
-            eventsIncludes,
+            projectData,
             !exportForPreview);
+  });
+
+  // Only generate the code of layouts that changed since the code was cached.
+  std::vector<gd::String> eventsOutputs(layoutsCount);
+  std::vector<std::set<gd::String> > eventsIncludes(layoutsCount);
+  std::vector<std::size_t> generatedLayouts;
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    if (!ReadCachedEventsCode(
+            fs, cacheFiles[i], eventsOutputs[i], eventsIncludes[i]))
+      generatedLayouts.push_back(i);
+  }
+
+  gd::ParallelTasks::Run(generatedLayouts.size(), [&](std::size_t j) {
+    std::size_t i = generatedLayouts[j];
+    const gd::Layout &exportedLayout = project.GetLayout(i);
+    eventsOutputs[i] = EventsCodeGenerator::GenerateSceneEventsCompleteCode(
+        project,
+        exportedLayout,
+        exportedLayout.GetEvents(),
+        eventsIncludes[i],
+        !exportForPreview);
+  });
+
+  // Old versions of the code are never used again: empty the cache when it
+  // gets much bigger than the project, and cache again the current code.
+  if (fs.ReadDir(cacheDir, ".js").size() + generatedLayouts.size() >
+      layoutsCount * 4 + 16) {
+    fs.ClearDir(cacheDir);
+    generatedLayouts.clear();
+    for (std::size_t i = 0; i < layoutsCount; ++i)
+      generatedLayouts.push_back(i);
+  }
+  for (std::size_t i : generatedLayouts)
+    WriteCachedEventsCode(
+        fs, cacheFiles[i], eventsOutputs[i], eventsIncludes[i]);
+
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
     // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (std::set<gd::String>::iterator include = eventsIncludes.begin();
-           include != eventsIncludes.end();
+    if (fs.WriteToFile(filename, eventsOutputs[i])) {
+      for (std::set<gd::String>::iterator include = eventsIncludes[i].begin();
+           include != eventsIncludes[i].end();
            ++include)
         InsertUnique(includesFiles, *include);
 
@@ -102,7 +102,10 @@ class ExporterHelper {
    * \brief Generate the events JS code, and save them to the export directory.
    *
    * Files are named "codeX.js", X being the number of the layout in the
-   * project. \param project The project with resources to be exported. \param
+   * project. The code of each layout is cached in the "eventsCodeCache"
+   * directory of \a outputDir and is only generated again when the layout or
+   * anything used by its events changed (see
+   * EventsCodeGenerator::GenerateSceneEventsCompleteCodeHash). \param project The project with resources to be exported. \param
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).